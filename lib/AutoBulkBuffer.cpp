@@ -0,0 +1,185 @@
+#include "AutoBulkBuffer.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+constexpr uint32_t AutoBulkBuffer::DEFAULT_MAX_SIZE;
+constexpr uint64_t AutoBulkBuffer::DEFAULT_MAX_DELAY_MS;
+
+AutoBulkBuffer::AutoBulkBuffer():
+    m_api(SAI_COMMON_API_MAX),
+    m_objectType(SAI_OBJECT_TYPE_NULL),
+    m_maxSize(DEFAULT_MAX_SIZE),
+    m_maxDelayMs(DEFAULT_MAX_DELAY_MS)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool AutoBulkBuffer::isSupported(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+        case SAI_COMMON_API_REMOVE:
+        case SAI_COMMON_API_SET:
+            break;
+
+        default:
+            return false;
+    }
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NEXT_HOP:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool AutoBulkBuffer::canAppend(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_entries.empty())
+    {
+        return true;
+    }
+
+    if (api != m_api || objectType != m_objectType || isFull())
+    {
+        return false;
+    }
+
+    if (m_objectIds.find(serializedObjectId) != m_objectIds.end())
+    {
+        return false;
+    }
+
+    auto delay = std::chrono::steady_clock::now() - m_start;
+
+    return delay < std::chrono::milliseconds(m_maxDelayMs);
+}
+
+void AutoBulkBuffer::append(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId,
+        _In_ const std::string& serializedAttributes)
+{
+    SWSS_LOG_ENTER();
+
+    if (!canAppend(api, objectType, serializedObjectId))
+    {
+        SWSS_LOG_THROW("can't append %s to auto bulk buffer", serializedObjectId.c_str());
+    }
+
+    if (m_entries.empty())
+    {
+        m_api = api;
+        m_objectType = objectType;
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    m_entries.emplace_back(serializedObjectId, serializedAttributes);
+
+    m_objectIds.insert(serializedObjectId);
+}
+
+bool AutoBulkBuffer::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.empty();
+}
+
+size_t AutoBulkBuffer::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size();
+}
+
+bool AutoBulkBuffer::isFull() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size() >= m_maxSize;
+}
+
+sai_common_api_t AutoBulkBuffer::getBulkApi() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_api)
+    {
+        case SAI_COMMON_API_CREATE:
+            return SAI_COMMON_API_BULK_CREATE;
+
+        case SAI_COMMON_API_REMOVE:
+            return SAI_COMMON_API_BULK_REMOVE;
+
+        case SAI_COMMON_API_SET:
+            return SAI_COMMON_API_BULK_SET;
+
+        default:
+            SWSS_LOG_THROW("auto bulk buffer is empty");
+    }
+}
+
+sai_object_type_t AutoBulkBuffer::getObjectType() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectType;
+}
+
+const std::vector<swss::FieldValueTuple>& AutoBulkBuffer::getEntries() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries;
+}
+
+void AutoBulkBuffer::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_api = SAI_COMMON_API_MAX;
+    m_objectType = SAI_OBJECT_TYPE_NULL;
+
+    m_entries.clear();
+    m_objectIds.clear();
+}
+
+void AutoBulkBuffer::setMaxSize(
+        _In_ uint32_t maxSize)
+{
+    SWSS_LOG_ENTER();
+
+    // max size 0 would never allow to append
+
+    m_maxSize = (maxSize == 0) ? 1 : maxSize;
+}
+
+void AutoBulkBuffer::setMaxDelay(
+        _In_ uint64_t maxDelayMs)
+{
+    SWSS_LOG_ENTER();
+
+    m_maxDelayMs = maxDelayMs;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "swss/table.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Automatic bulk buffer.
+     *
+     * Holds consecutive single create/remove/set operations of the same
+     * object type and API, which are later sent to syncd as single bulk
+     * request. Operation on object which is already in buffer can't be
+     * appended, so order of operations on each object is preserved.
+     */
+    class AutoBulkBuffer
+    {
+        public:
+
+            static constexpr uint32_t DEFAULT_MAX_SIZE = 1000;
+
+            static constexpr uint64_t DEFAULT_MAX_DELAY_MS = 10;
+
+        public:
+
+            AutoBulkBuffer();
+
+            virtual ~AutoBulkBuffer() = default;
+
+        public:
+
+            /**
+             * @brief Checks whether given API on given object type can be
+             * automatically bulked.
+             *
+             * Only high scale objects are supported: route, neighbor and FDB
+             * entries and next hops.
+             */
+            static bool isSupported(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType);
+
+            /**
+             * @brief Checks whether operation can be appended to buffer.
+             *
+             * Operation can't be appended when buffer holds operations of
+             * different object type or API, already contains given object,
+             * is full, or first operation is older than max delay.
+             */
+            bool canAppend(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId) const;
+
+            /**
+             * @brief Append operation to buffer.
+             *
+             * @param[in] api Single API, create, remove or set.
+             * @param[in] objectType Object type.
+             * @param[in] serializedObjectId Serialized object id.
+             * @param[in] serializedAttributes Attributes joined the same way
+             * as in bulk request.
+             */
+            void append(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ const std::string& serializedAttributes);
+
+            bool empty() const;
+
+            size_t size() const;
+
+            bool isFull() const;
+
+            /**
+             * @brief Get bulk API corresponding to buffered single API.
+             */
+            sai_common_api_t getBulkApi() const;
+
+            sai_object_type_t getObjectType() const;
+
+            /**
+             * @brief Get bulk entries, field is object id and value are
+             * joined attributes.
+             */
+            const std::vector<swss::FieldValueTuple>& getEntries() const;
+
+            void clear();
+
+            void setMaxSize(
+                    _In_ uint32_t maxSize);
+
+            void setMaxDelay(
+                    _In_ uint64_t maxDelayMs);
+
+        private:
+
+            sai_common_api_t m_api;
+
+            sai_object_type_t m_objectType;
+
+            std::vector<swss::FieldValueTuple> m_entries;
+
+            std::unordered_set<std::string> m_objectIds;
+
+            std::chrono::steady_clock::time_point m_start;
+
+            uint32_t m_maxSize;
+
+            uint64_t m_maxDelayMs;
+    };
+}
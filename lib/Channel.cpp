@@ -9,7 +9,8 @@ using namespace sairedis;
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_syncMode(false)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +38,25 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+void Channel::setSyncMode(
+        _In_ bool syncMode)
+{
+    SWSS_LOG_ENTER();
+
+    m_syncMode = syncMode;
+}
+
+bool Channel::getSyncMode() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_syncMode;
+}
+
+bool Channel::supportsConcurrentWait() const
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include <memory>
 #include <functional>
+#include <atomic>
 
 namespace sairedis
 {
@@ -35,6 +36,26 @@ namespace sairedis
 
             uint64_t getResponseTimeout() const;
 
+            /**
+             * @brief Set sync mode.
+             *
+             * In sync mode every request is followed by wait for response,
+             * channel can use this information to match responses with
+             * requests.
+             */
+            void setSyncMode(
+                    _In_ bool syncMode);
+
+            bool getSyncMode() const;
+
+            /**
+             * @brief Whether multiple threads can wait for responses at
+             * the same time.
+             *
+             * Each thread then receives response to its own request.
+             */
+            virtual bool supportsConcurrentWait() const;
+
         public:
 
             virtual void setBuffered(
@@ -65,6 +86,12 @@ namespace sairedis
 
             uint64_t m_responseTimeoutMs;
 
+            /**
+             * @brief Sync mode, set by API thread and read also by
+             * response thread.
+             */
+            std::atomic<bool> m_syncMode;
+
         protected: // notification
 
             /**
@@ -26,12 +26,16 @@ Context::Context(
     m_meta = std::make_shared<saimeta::Meta>(m_redisSai);
 
     m_redisSai->setMeta(m_meta);
+
+    m_redisSai->setContextMutex(&m_mutex);
 }
 
 Context::~Context()
 {
     SWSS_LOG_ENTER();
 
+    saveMetaSnapshot();
+
     m_redisSai->apiUninitialize(); // will stop threads
 
     m_redisSai = nullptr;
@@ -52,16 +56,85 @@ void Context::populateMetadata(
 {
     SWSS_LOG_ENTER();
 
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_SWITCH, .objectkey = { .key = { .object_id = switchId } } };
+
+    if (m_meta->objectExists(mk))
+    {
+        SWSS_LOG_NOTICE("skipping populate metadata for switch %s, (probably connecting to already existing switch)",
+                sai_serialize_object_id(switchId).c_str());
+        return;
+    }
+
+    if (loadMetaSnapshot(switchId))
+    {
+        return;
+    }
+
+    m_redisSai->refreshTableDump();
+
     auto& dump = m_redisSai->getTableDump();
 
     SWSS_LOG_NOTICE("dump size: %zu", dump.size());
 
-    if (dump.size() == 0)
+    auto it = dump.find(switchId);
+
+    if (it == dump.end())
     {
-        SWSS_LOG_NOTICE("skipping populate metadata for switch %s, (probably connecting to already existing switch)",
+        SWSS_LOG_ERROR("switch %s not found in ASIC view, skipping populate metadata",
                 sai_serialize_object_id(switchId).c_str());
         return;
     }
 
-    m_meta->populate(dump.at(switchId));
+    m_meta->populate(it->second);
+}
+
+bool Context::loadMetaSnapshot(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    auto& fileName = m_contextConfig->m_metaSnapshot;
+
+    if (fileName.empty())
+    {
+        return false;
+    }
+
+    auto generation = m_redisSai->getAsicStateGeneration();
+
+    if (!m_meta->loadSnapshot(fileName, generation, switchId))
+    {
+        SWSS_LOG_NOTICE("meta snapshot %s not used, populating metadata from ASIC view", fileName.c_str());
+
+        return false;
+    }
+
+    // metadata will diverge from snapshot from now on, so it can't be used again
+
+    m_redisSai->incrementAsicStateGeneration();
+
+    return true;
+}
+
+void Context::saveMetaSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    auto& fileName = m_contextConfig->m_metaSnapshot;
+
+    if (fileName.empty() || m_meta->isEmpty())
+    {
+        return;
+    }
+
+    try
+    {
+        auto generation = m_redisSai->incrementAsicStateGeneration();
+
+        m_meta->saveSnapshot(fileName, generation);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to save meta snapshot %s: %s", fileName.c_str(), e.what());
+    }
 }
@@ -2,10 +2,13 @@
 
 #include "RedisRemoteSaiInterface.h"
 #include "ContextConfig.h"
+#include "ContextMutex.h"
 
 #include "meta/Notification.h"
 #include "meta/Meta.h"
 
+#include <mutex>
+
 namespace sairedis
 {
     class Context
@@ -26,6 +29,14 @@ namespace sairedis
 
         private:
 
+            /**
+             * @brief Load metadata from meta snapshot if configured and valid.
+             */
+            bool loadMetaSnapshot(
+                    _In_ sai_object_id_t switchId);
+
+            void saveMetaSnapshot();
+
             sai_switch_notifications_t handle_notification(
                     _In_ std::shared_ptr<Notification> notification);
 
@@ -42,5 +53,14 @@ namespace sairedis
             std::shared_ptr<RedisRemoteSaiInterface> m_redisSai;
 
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>, Context*)> m_notificationCallback;
+
+            /**
+             * @brief Context mutex.
+             *
+             * Serializes api calls and notifications of this context, calls
+             * to different contexts can be executed concurrently. Get and
+             * query calls release it while waiting for response.
+             */
+            ContextMutex m_mutex;
     };
 }
@@ -46,6 +46,15 @@ namespace sairedis
 
             std::string m_zmqNtfEndpoint;
 
+            /**
+             * @brief Meta snapshot file.
+             *
+             * If not empty, metadata is saved to this file on uninitialize,
+             * and loaded from it when connecting to existing switch, if
+             * snapshot is not stale.
+             */
+            std::string m_metaSnapshot;
+
             std::shared_ptr<SwitchConfigContainer> m_scc;
     };
 }
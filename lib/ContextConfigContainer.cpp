@@ -132,6 +132,12 @@ std::shared_ptr<ContextConfigContainer> ContextConfigContainer::loadFromFile(
                     cc->m_zmqEndpoint.c_str(),
                     cc->m_zmqNtfEndpoint.c_str());
 
+            // optional
+
+            cc->m_metaSnapshot = item.value("meta_snapshot", std::string());
+
+            SWSS_LOG_NOTICE("contextConfig meta snapshot: '%s'", cc->m_metaSnapshot.c_str());
+
             for (size_t k = 0; k < item["switches"].size(); k++)
             {
                 json& sw = item["switches"][k];
@@ -0,0 +1,51 @@
+#include "ContextMutex.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+ContextMutex::ContextMutex():
+    m_owner(std::thread::id()),
+    m_depth(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void ContextMutex::lock()
+{
+    SWSS_LOG_ENTER();
+
+    m_mutex.lock();
+
+    m_owner = std::this_thread::get_id();
+
+    m_depth++;
+}
+
+void ContextMutex::unlock()
+{
+    SWSS_LOG_ENTER();
+
+    if (--m_depth == 0)
+    {
+        m_owner = std::thread::id();
+    }
+
+    m_mutex.unlock();
+}
+
+bool ContextMutex::unlockForWait()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_owner != std::this_thread::get_id() || m_depth != 1)
+    {
+        return false;
+    }
+
+    unlock();
+
+    return true;
+}
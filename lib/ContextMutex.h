@@ -0,0 +1,53 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+namespace sairedis
+{
+    /**
+     * @brief Context mutex.
+     *
+     * Recursive mutex which knows its owner and lock depth, so API call
+     * can release it while waiting for response, when it is not held by
+     * any outer call on the same thread.
+     */
+    class ContextMutex
+    {
+        public:
+
+            ContextMutex();
+
+            virtual ~ContextMutex() = default;
+
+        public:
+
+            void lock();
+
+            void unlock();
+
+            /**
+             * @brief Unlock mutex before waiting for response.
+             *
+             * Mutex is unlocked only when it is held by current thread
+             * exactly once, and then must be locked again after wait.
+             *
+             * @return True if mutex was unlocked.
+             */
+            bool unlockForWait();
+
+        private:
+
+            std::recursive_mutex m_mutex;
+
+            std::atomic<std::thread::id> m_owner;
+
+            /**
+             * @brief Lock depth, accessed only by owner.
+             */
+            uint32_t m_depth;
+    };
+}
@@ -582,6 +582,25 @@ void Recorder::recordGenericCounterPolling(
     recordLine("p|" + key + "|" + Globals::joinFieldValues(arguments));
 }
 
+void Recorder::recordBulkGenericCounterPolling(
+        _In_ const std::vector<swss::FieldValueTuple>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::string joined;
+
+    for (const auto &e: entries)
+    {
+        // ||key|field=value|field=value||key|field=value
+
+        joined += "||" + fvField(e) + "|" + fvValue(e);
+    }
+
+    // capital 'P' stands for bulk counter Polling
+
+    recordLine("P|" + std::to_string(entries.size()) + joined);
+}
+
 void Recorder::recordGenericSetResponse(
         _In_ sai_status_t status)
 {
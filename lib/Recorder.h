@@ -183,6 +183,15 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& arguments);
 
+            /**
+             * @brief Record bulk counter polling.
+             *
+             * Each entry field is counter key and value is joined counter
+             * fields, empty value stops polling.
+             */
+            void recordBulkGenericCounterPolling(
+                    _In_ const std::vector<swss::FieldValueTuple>& entries);
+
             void recordGenericGetStats(
                     _In_ sai_object_type_t object_type,
                     _In_ sai_object_id_t object_id,
@@ -0,0 +1,542 @@
+#include "RecordingIndex.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+using namespace sairedis;
+
+constexpr uint32_t RecordingIndex::MAGIC;
+constexpr uint32_t RecordingIndex::VERSION;
+constexpr uint64_t RecordingIndex::INVALID_LINE;
+
+#define OID_PREFIX "oid:0x"
+#define OID_PREFIX_LENGTH (sizeof(OID_PREFIX) - 1)
+
+RecordingIndex::RecordingIndex():
+    m_recording(nullptr),
+    m_recordingSize(0),
+    m_index(nullptr),
+    m_indexSize(0),
+    m_header(nullptr),
+    m_lines(nullptr),
+    m_objects(nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+RecordingIndex::~RecordingIndex()
+{
+    SWSS_LOG_ENTER();
+
+    close();
+}
+
+std::string RecordingIndex::getIndexFileName(
+        _In_ const std::string& recordingFile)
+{
+    SWSS_LOG_ENTER();
+
+    return recordingFile + ".idx";
+}
+
+bool RecordingIndex::parseTimestamp(
+        _In_ const char* str,
+        _In_ size_t length,
+        _Out_ uint64_t& timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    timestamp = 0;
+
+    // YYYY-MM-DD.hh:mm:ss.uuuuuu
+
+    static const char format[] = "dddd-dd-dd.dd:dd:dd";
+
+    const size_t formatLength = sizeof(format) - 1;
+
+    if (length < formatLength)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < formatLength; i++)
+    {
+        if (format[i] == 'd' ? (str[i] < '0' || str[i] > '9') : str[i] != format[i])
+        {
+            return false;
+        }
+    }
+
+    auto number = [&](size_t pos, size_t digits)
+    {
+        int value = 0;
+
+        for (size_t i = pos; i < pos + digits; i++)
+        {
+            value = value * 10 + (str[i] - '0');
+        }
+
+        return value;
+    };
+
+    struct tm tm;
+
+    memset(&tm, 0, sizeof(tm));
+
+    tm.tm_year = number(0, 4) - 1900;
+    tm.tm_mon = number(5, 2) - 1;
+    tm.tm_mday = number(8, 2);
+    tm.tm_hour = number(11, 2);
+    tm.tm_min = number(14, 2);
+    tm.tm_sec = number(17, 2);
+
+    uint64_t usec = 0;
+
+    if (length > formatLength && str[formatLength] == '.')
+    {
+        size_t digits = 0;
+
+        for (size_t i = formatLength + 1; i < length && digits < 6 && str[i] >= '0' && str[i] <= '9'; i++, digits++)
+        {
+            usec = usec * 10 + (uint64_t)(str[i] - '0');
+        }
+
+        for (; digits < 6; digits++)
+        {
+            usec *= 10;
+        }
+    }
+
+    // local time is kept as is, since value is only compared
+
+    timestamp = (uint64_t)timegm(&tm) * 1000000 + usec;
+
+    return true;
+}
+
+bool RecordingIndex::map(
+        _In_ const std::string& fileName,
+        _Out_ void*& addr,
+        _Out_ uint64_t& size)
+{
+    SWSS_LOG_ENTER();
+
+    addr = nullptr;
+    size = 0;
+
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open %s: %s", fileName.c_str(), strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        SWSS_LOG_ERROR("failed to stat %s: %s", fileName.c_str(), strerror(errno));
+
+        ::close(fd);
+        return false;
+    }
+
+    if (st.st_size == 0)
+    {
+        ::close(fd);
+        return true; // empty file can't be mapped
+    }
+
+    void* ptr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if (ptr == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("failed to mmap %s: %s", fileName.c_str(), strerror(errno));
+        return false;
+    }
+
+    // recording is mostly read sequentially
+
+    madvise(ptr, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    addr = ptr;
+    size = (uint64_t)st.st_size;
+
+    return true;
+}
+
+void RecordingIndex::unmap(
+        _Inout_ void*& addr,
+        _Inout_ uint64_t& size)
+{
+    SWSS_LOG_ENTER();
+
+    if (addr)
+    {
+        munmap(addr, size);
+    }
+
+    addr = nullptr;
+    size = 0;
+}
+
+bool RecordingIndex::build(
+        _In_ const std::string& recordingFile,
+        _In_ const std::string& indexFile)
+{
+    SWSS_LOG_ENTER();
+
+    void* addr;
+    uint64_t recordingSize;
+
+    if (!map(recordingFile, addr, recordingSize))
+    {
+        return false;
+    }
+
+    const char* recording = (const char*)addr;
+
+    std::vector<RecordingIndexLine> lines;
+    std::vector<RecordingIndexObject> objects;
+    std::vector<uint64_t> vids;
+
+    uint64_t timestamp = 0;
+
+    for (uint64_t offset = 0; offset < recordingSize; )
+    {
+        const char* line = recording + offset;
+
+        const char* end = (const char*)memchr(line, '\n', recordingSize - offset);
+
+        size_t length = end ? (size_t)(end - line) : (size_t)(recordingSize - offset);
+
+        RecordingIndexLine entry;
+
+        memset(&entry, 0, sizeof(entry));
+
+        entry.offset = offset;
+        entry.length = (uint32_t)length;
+
+        // timestamp|op|..., line without timestamp keeps previous one
+
+        uint64_t ts;
+
+        if (parseTimestamp(line, length, ts))
+        {
+            timestamp = ts;
+        }
+
+        entry.timestamp = timestamp;
+
+        const char* bar = (const char*)memchr(line, '|', length);
+
+        entry.op = (bar && bar + 1 < line + length) ? bar[1] : 0;
+
+        vids.clear();
+
+        const char* pos = line;
+        const char* lineEnd = line + length;
+
+        while ((pos = (const char*)memmem(pos, (size_t)(lineEnd - pos), OID_PREFIX, OID_PREFIX_LENGTH)) != nullptr)
+        {
+            pos += OID_PREFIX_LENGTH;
+
+            uint64_t vid = 0;
+
+            for (; pos < lineEnd && isxdigit((unsigned char)*pos); pos++)
+            {
+                vid = (vid << 4) | (uint64_t)(isdigit((unsigned char)*pos) ? *pos - '0' : (tolower((unsigned char)*pos) - 'a' + 10));
+            }
+
+            if (vid)
+            {
+                vids.push_back(vid);
+            }
+        }
+
+        // bulk line can reference the same object many times
+
+        std::sort(vids.begin(), vids.end());
+
+        vids.erase(std::unique(vids.begin(), vids.end()), vids.end());
+
+        for (auto vid: vids)
+        {
+            objects.push_back({vid, (uint64_t)lines.size()});
+        }
+
+        lines.push_back(entry);
+
+        offset += length + 1;
+    }
+
+    uint64_t mappedSize = recordingSize;
+
+    unmap(addr, mappedSize);
+
+    // lines are already in order for each vid
+
+    std::stable_sort(objects.begin(), objects.end(),
+            [](const RecordingIndexObject& a, const RecordingIndexObject& b) { return a.vid < b.vid; });
+
+    RecordingIndexHeader header;
+
+    memset(&header, 0, sizeof(header));
+
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.recordingSize = recordingSize;
+    header.lineCount = lines.size();
+    header.linesOffset = sizeof(RecordingIndexHeader);
+    header.objectCount = objects.size();
+    header.objectsOffset = header.linesOffset + header.lineCount * sizeof(RecordingIndexLine);
+    header.size = header.objectsOffset + header.objectCount * sizeof(RecordingIndexObject);
+
+    std::string tmp = indexFile + ".tmp";
+
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", tmp.c_str());
+        return false;
+    }
+
+    ofs.write((const char*)&header, sizeof(header));
+    ofs.write((const char*)lines.data(), (std::streamsize)(lines.size() * sizeof(RecordingIndexLine)));
+    ofs.write((const char*)objects.data(), (std::streamsize)(objects.size() * sizeof(RecordingIndexObject)));
+
+    ofs.close();
+
+    if (!ofs)
+    {
+        SWSS_LOG_ERROR("failed to write %s", tmp.c_str());
+
+        unlink(tmp.c_str());
+        return false;
+    }
+
+    if (rename(tmp.c_str(), indexFile.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s: %s", tmp.c_str(), indexFile.c_str(), strerror(errno));
+
+        unlink(tmp.c_str());
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("built index %s: %zu lines, %zu object references", indexFile.c_str(), lines.size(), objects.size());
+
+    return true;
+}
+
+bool RecordingIndex::open(
+        _In_ const std::string& recordingFile,
+        _In_ const std::string& indexFile)
+{
+    SWSS_LOG_ENTER();
+
+    close();
+
+    if (!map(recordingFile, m_recording, m_recordingSize) || !map(indexFile, m_index, m_indexSize))
+    {
+        close();
+        return false;
+    }
+
+    auto header = (const RecordingIndexHeader*)m_index;
+
+    if (m_indexSize < sizeof(RecordingIndexHeader) ||
+            header->magic != MAGIC ||
+            header->version != VERSION ||
+            header->size != m_indexSize ||
+            header->linesOffset != sizeof(RecordingIndexHeader) ||
+            header->objectsOffset != header->linesOffset + header->lineCount * sizeof(RecordingIndexLine) ||
+            header->size != header->objectsOffset + header->objectCount * sizeof(RecordingIndexObject))
+    {
+        SWSS_LOG_ERROR("file %s is not valid recording index", indexFile.c_str());
+
+        close();
+        return false;
+    }
+
+    if (header->recordingSize != m_recordingSize)
+    {
+        SWSS_LOG_WARN("index %s was built for different recording, size %" PRIu64 " vs %" PRIu64,
+                indexFile.c_str(),
+                header->recordingSize,
+                m_recordingSize);
+
+        close();
+        return false;
+    }
+
+    m_header = header;
+    // lines follow header and objects follow lines, see header validation above
+
+    m_lines = (const RecordingIndexLine*)(header + 1);
+    m_objects = (const RecordingIndexObject*)(m_lines + header->lineCount);
+
+    // index is accessed randomly
+
+    madvise(m_index, m_indexSize, MADV_RANDOM);
+
+    return true;
+}
+
+void RecordingIndex::close()
+{
+    SWSS_LOG_ENTER();
+
+    unmap(m_recording, m_recordingSize);
+    unmap(m_index, m_indexSize);
+
+    m_header = nullptr;
+    m_lines = nullptr;
+    m_objects = nullptr;
+}
+
+uint64_t RecordingIndex::getLineCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header ? m_header->lineCount : 0;
+}
+
+const RecordingIndexLine& RecordingIndex::getIndexLine(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    if (line >= getLineCount())
+    {
+        SWSS_LOG_THROW("line %" PRIu64 " is out of range, line count %" PRIu64, line, getLineCount());
+    }
+
+    return m_lines[line];
+}
+
+std::string RecordingIndex::getLine(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& entry = getIndexLine(line);
+
+    return std::string((const char*)m_recording + entry.offset, entry.length);
+}
+
+uint64_t RecordingIndex::getOffset(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    return getIndexLine(line).offset;
+}
+
+uint64_t RecordingIndex::getTimestamp(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    return getIndexLine(line).timestamp;
+}
+
+char RecordingIndex::getOp(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    return getIndexLine(line).op;
+}
+
+uint64_t RecordingIndex::findTimestamp(
+        _In_ uint64_t timestamp) const
+{
+    SWSS_LOG_ENTER();
+
+    auto begin = m_lines;
+    auto end = m_lines + getLineCount();
+
+    auto it = std::lower_bound(begin, end, timestamp,
+            [](const RecordingIndexLine& entry, uint64_t ts) { return entry.timestamp < ts; });
+
+    return it == end ? INVALID_LINE : (uint64_t)(it - begin);
+}
+
+uint64_t RecordingIndex::findCheckpoint(
+        _In_ uint64_t line) const
+{
+    SWSS_LOG_ENTER();
+
+    if (getLineCount() == 0)
+    {
+        return INVALID_LINE;
+    }
+
+    static const char initView[] = "|a|INIT_VIEW";
+
+    const size_t initViewLength = sizeof(initView) - 1;
+
+    for (uint64_t idx = std::min(line, getLineCount() - 1) + 1; idx-- > 0; )
+    {
+        auto& entry = m_lines[idx];
+
+        if (entry.op != 'a')
+        {
+            continue;
+        }
+
+        const char* str = (const char*)m_recording + entry.offset;
+
+        const char* bar = (const char*)memchr(str, '|', entry.length);
+
+        if (bar && (size_t)(str + entry.length - bar) >= initViewLength && memcmp(bar, initView, initViewLength) == 0)
+        {
+            return idx;
+        }
+    }
+
+    return INVALID_LINE;
+}
+
+std::vector<uint64_t> RecordingIndex::getObjectHistory(
+        _In_ uint64_t vid) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint64_t> history;
+
+    if (m_header == nullptr)
+    {
+        return history;
+    }
+
+    auto begin = m_objects;
+    auto end = m_objects + m_header->objectCount;
+
+    auto it = std::lower_bound(begin, end, vid,
+            [](const RecordingIndexObject& obj, uint64_t v) { return obj.vid < v; });
+
+    for (; it != end && it->vid == vid; it++)
+    {
+        history.push_back(it->line);
+    }
+
+    return history;
+}
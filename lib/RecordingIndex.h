@@ -0,0 +1,216 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Recording index header.
+     *
+     * File layout:
+     *
+     *   RecordingIndexHeader
+     *   RecordingIndexLine lines[lineCount]         - in recording order
+     *   RecordingIndexObject objects[objectCount]   - sorted by vid, line
+     *
+     * Index is valid only for recording of the same size as the one it was
+     * built from.
+     */
+    struct RecordingIndexHeader
+    {
+        uint32_t magic;
+
+        uint32_t version;
+
+        uint64_t recordingSize;
+
+        uint64_t lineCount;
+
+        uint64_t linesOffset;
+
+        uint64_t objectCount;
+
+        uint64_t objectsOffset;
+
+        uint64_t size;
+    };
+
+    struct RecordingIndexLine
+    {
+        /**
+         * @brief Offset of line in recording file.
+         */
+        uint64_t offset;
+
+        /**
+         * @brief Line timestamp in microseconds, see parseTimestamp.
+         */
+        uint64_t timestamp;
+
+        /**
+         * @brief Line length without new line.
+         */
+        uint32_t length;
+
+        /**
+         * @brief Recorded operation (c, r, s, g, C, ...).
+         */
+        char op;
+
+        char reserved[3];
+    };
+
+    struct RecordingIndexObject
+    {
+        uint64_t vid;
+
+        uint64_t line;
+    };
+
+    /**
+     * @brief Recording index.
+     *
+     * Maps line timestamps, operations and object VIDs referenced on each
+     * line to recording file offsets. Index is built by scanning recording
+     * once, and both recording and index are memory mapped, so any line
+     * can be accessed without reading recording from the start.
+     */
+    class RecordingIndex
+    {
+        private:
+
+            RecordingIndex(const RecordingIndex&) = delete;
+            RecordingIndex& operator=(const RecordingIndex&) = delete;
+
+        public:
+
+            static constexpr uint32_t MAGIC = 0x58444952; // "RIDX"
+
+            static constexpr uint32_t VERSION = 1;
+
+            /**
+             * @brief Value returned when line was not found.
+             */
+            static constexpr uint64_t INVALID_LINE = UINT64_MAX;
+
+        public:
+
+            RecordingIndex();
+
+            virtual ~RecordingIndex();
+
+        public:
+
+            /**
+             * @brief Get default index file name of recording.
+             */
+            static std::string getIndexFileName(
+                    _In_ const std::string& recordingFile);
+
+            /**
+             * @brief Build index of recording and write it to index file.
+             */
+            static bool build(
+                    _In_ const std::string& recordingFile,
+                    _In_ const std::string& indexFile);
+
+            /**
+             * @brief Parse recording timestamp.
+             *
+             * Timestamp format is YYYY-MM-DD.hh:mm:ss.uuuuuu, microseconds
+             * are optional. Result is in microseconds and is used only for
+             * ordering, local time is not converted.
+             */
+            static bool parseTimestamp(
+                    _In_ const char* str,
+                    _In_ size_t length,
+                    _Out_ uint64_t& timestamp);
+
+        public:
+
+            /**
+             * @brief Map recording and its index.
+             *
+             * @return False if files can't be mapped or index is not valid
+             * for given recording.
+             */
+            bool open(
+                    _In_ const std::string& recordingFile,
+                    _In_ const std::string& indexFile);
+
+            void close();
+
+            uint64_t getLineCount() const;
+
+            std::string getLine(
+                    _In_ uint64_t line) const;
+
+            uint64_t getOffset(
+                    _In_ uint64_t line) const;
+
+            uint64_t getTimestamp(
+                    _In_ uint64_t line) const;
+
+            char getOp(
+                    _In_ uint64_t line) const;
+
+            /**
+             * @brief Find first line with timestamp equal or greater than given.
+             *
+             * @return INVALID_LINE if there is no such line.
+             */
+            uint64_t findTimestamp(
+                    _In_ uint64_t timestamp) const;
+
+            /**
+             * @brief Find last INIT_VIEW line at or before given line.
+             *
+             * Replay can start from INIT_VIEW, since it's followed by whole
+             * switch state.
+             *
+             * @return INVALID_LINE if there is no such line.
+             */
+            uint64_t findCheckpoint(
+                    _In_ uint64_t line) const;
+
+            /**
+             * @brief Get all lines which reference given VID, in recording order.
+             */
+            std::vector<uint64_t> getObjectHistory(
+                    _In_ uint64_t vid) const;
+
+        private:
+
+            static bool map(
+                    _In_ const std::string& fileName,
+                    _Out_ void*& addr,
+                    _Out_ uint64_t& size);
+
+            static void unmap(
+                    _Inout_ void*& addr,
+                    _Inout_ uint64_t& size);
+
+            const RecordingIndexLine& getIndexLine(
+                    _In_ uint64_t line) const;
+
+        private:
+
+            void* m_recording;
+
+            uint64_t m_recordingSize;
+
+            void* m_index;
+
+            uint64_t m_indexSize;
+
+            const RecordingIndexHeader* m_header;
+
+            const RecordingIndexLine* m_lines;
+
+            const RecordingIndexObject* m_objects;
+    };
+}
@@ -7,13 +7,23 @@
 #include "swss/logger.h"
 #include "swss/select.h"
 
+#include <atomic>
+#include <cinttypes>
+#include <chrono>
+#include <deque>
+
+#include <unistd.h>
+
 using namespace sairedis;
 
+static std::atomic<uint64_t> g_channelIndex(0);
+
 RedisChannel::RedisChannel(
         _In_ const std::string& dbAsic,
         _In_ Channel::Callback callback):
     Channel(callback),
-    m_dbAsic(dbAsic)
+    m_dbAsic(dbAsic),
+    m_requestIndex(0)
 {
     SWSS_LOG_ENTER();
 
@@ -22,11 +32,19 @@ RedisChannel::RedisChannel(
     m_db                    = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_redisPipeline         = std::make_shared<swss::RedisPipeline>(m_db.get()); // enable default pipeline 128
     m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), ASIC_STATE_TABLE, true);
-    m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), REDIS_TABLE_GETRESPONSE);
+
+    m_dbResponse            = std::make_shared<swss::DBConnector>(dbAsic, 0);
+    m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_dbResponse.get(), REDIS_TABLE_GETRESPONSE);
 
     m_dbNtf                 = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_notificationConsumer  = std::make_shared<swss::NotificationConsumer>(m_dbNtf.get(), REDIS_TABLE_NOTIFICATIONS_PER_DB(dbAsic));
 
+    m_requestIdPrefix = std::to_string(getpid()) + ":" + std::to_string(g_channelIndex++) + ":";
+
+    SWSS_LOG_NOTICE("creating response thread");
+
+    m_responseThread = std::make_shared<std::thread>(&RedisChannel::responseThreadFunction, this);
+
     m_runNotificationThread = true;
 
     SWSS_LOG_NOTICE("creating notification thread");
@@ -38,6 +56,14 @@ RedisChannel::~RedisChannel()
 {
     SWSS_LOG_ENTER();
 
+    m_responseThreadShouldEndEvent.notify();
+
+    SWSS_LOG_NOTICE("join response thread begin");
+
+    m_responseThread->join();
+
+    SWSS_LOG_NOTICE("join response thread end");
+
     m_runNotificationThread = false;
 
     // notify thread that it should end
@@ -99,11 +125,179 @@ void RedisChannel::notificationThreadFunction()
     }
 }
 
+void RedisChannel::responseThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    swss::Select s;
+
+    s.addSelectable(m_getConsumer.get());
+    s.addSelectable(&m_responseThreadShouldEndEvent);
+
+    while (true)
+    {
+        swss::Selectable *sel;
+
+        int result = s.select(&sel);
+
+        if (sel == &m_responseThreadShouldEndEvent)
+        {
+            break;
+        }
+
+        if (result == swss::Select::OBJECT)
+        {
+            std::deque<swss::KeyOpFieldsValuesTuple> entries;
+
+            m_getConsumer->pops(entries);
+
+            for (auto& kco: entries)
+            {
+                processResponse(kco);
+            }
+        }
+        else
+        {
+            SWSS_LOG_ERROR("select failed: %s", swss::Select::resultToString(result).c_str());
+        }
+    }
+}
+
+void RedisChannel::processResponse(
+        _Inout_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& values = kfvFieldsValues(kco);
+
+    std::lock_guard<std::mutex> lock(m_responseMutex);
+
+    std::shared_ptr<PendingRequest> request;
+
+    if (values.size() && fvField(values.back()) == REDIS_FIELD_REQUEST_ID)
+    {
+        std::string requestId = fvValue(values.back());
+
+        values.pop_back();
+
+        if (requestId.compare(0, m_requestIdPrefix.size(), m_requestIdPrefix) != 0)
+        {
+            SWSS_LOG_WARN("response %s is not for this channel, ignoring", requestId.c_str());
+            return;
+        }
+
+        uint64_t index = std::stoull(requestId.substr(m_requestIdPrefix.size()));
+
+        auto it = m_pendingRequests.find(index);
+
+        if (it == m_pendingRequests.end())
+        {
+            // request already timed out
+
+            SWSS_LOG_WARN("no pending request %s, ignoring response: %s:%s",
+                    requestId.c_str(),
+                    kfvKey(kco).c_str(),
+                    kfvOp(kco).c_str());
+            return;
+        }
+
+        request = it->second;
+    }
+    else
+    {
+        // response without request id is matched by order with requests
+        // which were sent without request id
+
+        for (auto& kvp: m_pendingRequests)
+        {
+            if (!kvp.second->correlated && !kvp.second->ready)
+            {
+                request = kvp.second;
+                break;
+            }
+        }
+
+        if (request == nullptr)
+        {
+            SWSS_LOG_WARN("got not expected response: %s:%s", kfvKey(kco).c_str(), kfvOp(kco).c_str());
+            return;
+        }
+    }
+
+    request->response = std::move(kco);
+    request->ready = true;
+
+    request->cv.notify_one();
+}
+
+bool RedisChannel::expectsResponse(
+        _In_ const std::string& command) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_syncMode)
+    {
+        return true;
+    }
+
+    // in async mode there are no responses for those commands
+
+    return command != REDIS_ASIC_STATE_COMMAND_CREATE &&
+        command != REDIS_ASIC_STATE_COMMAND_REMOVE &&
+        command != REDIS_ASIC_STATE_COMMAND_SET &&
+        command != REDIS_ASIC_STATE_COMMAND_BULK_CREATE &&
+        command != REDIS_ASIC_STATE_COMMAND_BULK_REMOVE &&
+        command != REDIS_ASIC_STATE_COMMAND_BULK_SET &&
+        command != REDIS_FLEX_COUNTER_COMMAND_START_POLL &&
+        command != REDIS_FLEX_COUNTER_COMMAND_STOP_POLL &&
+        command != REDIS_FLEX_COUNTER_COMMAND_SET_GROUP &&
+        command != REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP &&
+        command != REDIS_FLEX_COUNTER_COMMAND_BULK_POLL;
+}
+
+uint64_t RedisChannel::registerRequest(
+        _In_ bool correlated)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_responseMutex);
+
+    uint64_t index = ++m_requestIndex;
+
+    auto request = std::make_shared<PendingRequest>();
+
+    request->correlated = correlated;
+    request->ready = false;
+
+    m_pendingRequests[index] = request;
+
+    auto tid = std::this_thread::get_id();
+
+    auto it = m_threadRequests.find(tid);
+
+    if (it != m_threadRequests.end())
+    {
+        // previous request of this thread was never waited for
+
+        m_pendingRequests.erase(it->second);
+
+        it->second = index;
+    }
+    else
+    {
+        m_threadRequests[tid] = index;
+    }
+
+    return index;
+}
+
 void RedisChannel::setBuffered(
         _In_ bool buffered)
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+
     m_asicState->setBuffered(buffered);
 }
 
@@ -111,6 +305,8 @@ void RedisChannel::flush()
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+
     m_asicState->flush();
 }
 
@@ -121,7 +317,25 @@ void RedisChannel::set(
 {
     SWSS_LOG_ENTER();
 
-    m_asicState->set(key, values, command);
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+
+    if (!expectsResponse(command))
+    {
+        m_asicState->set(key, values, command);
+        return;
+    }
+
+    auto index = registerRequest(true);
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(values.size() + 1);
+
+    entry.insert(entry.end(), values.begin(), values.end());
+
+    entry.emplace_back(REDIS_FIELD_REQUEST_ID, m_requestIdPrefix + std::to_string(index));
+
+    m_asicState->set(key, entry, command);
 }
 
 void RedisChannel::del(
@@ -130,57 +344,97 @@ void RedisChannel::del(
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+
+    if (expectsResponse(command))
+    {
+        // del can't carry request id, response will be matched by order
+
+        registerRequest(false);
+    }
+
     m_asicState->del(key, command);
 }
 
+bool RedisChannel::supportsConcurrentWait() const
+{
+    SWSS_LOG_ENTER();
+
+    // responses are matched with requests by request id
+
+    return true;
+}
+
 sai_status_t RedisChannel::wait(
         _In_ const std::string& command,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
     SWSS_LOG_ENTER();
 
-    swss::Select s;
+    SWSS_LOG_DEBUG("wait for %s response", command.c_str());
 
-    s.addSelectable(m_getConsumer.get());
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-    while (true)
+    uint64_t index;
+
+    auto it = m_threadRequests.find(std::this_thread::get_id());
+
+    if (it == m_threadRequests.end())
     {
-        SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+        // no request was sent from this thread, take next response
 
-        swss::Selectable *sel;
+        index = ++m_requestIndex;
 
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
+        auto request = std::make_shared<PendingRequest>();
 
-        if (result == swss::Select::OBJECT)
-        {
-            m_getConsumer->pop(kco);
+        request->correlated = false;
+        request->ready = false;
 
-            const std::string &op = kfvOp(kco);
-            const std::string &opkey = kfvKey(kco);
+        m_pendingRequests[index] = request;
+    }
+    else
+    {
+        index = it->second;
 
-            SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+        m_threadRequests.erase(it);
+    }
 
-            if (op != command)
-            {
-                SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+    auto request = m_pendingRequests.at(index);
 
-                // ignore non response messages
-                continue;
-            }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
 
-            sai_status_t status;
-            sai_deserialize_status(opkey, status);
+    while (request->cv.wait_until(lock, deadline, [&request]{ return request->ready; }))
+    {
+        kco = std::move(request->response);
+
+        request->ready = false;
+
+        const std::string &op = kfvOp(kco);
+        const std::string &opkey = kfvKey(kco);
 
-            SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+        SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+
+        if (op != command)
+        {
+            SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
 
-            return status;
+            // ignore non response messages
+            continue;
         }
 
-        SWSS_LOG_ERROR("SELECT operation result: %s on %s", swss::Select::resultToString(result).c_str(), command.c_str());
-        break;
+        m_pendingRequests.erase(index);
+
+        sai_status_t status;
+        sai_deserialize_status(opkey, status);
+
+        SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+
+        return status;
     }
 
-    SWSS_LOG_ERROR("failed to get response for %s", command.c_str());
+    m_pendingRequests.erase(index);
+
+    SWSS_LOG_ERROR("failed to get response for %s, timeout %" PRIu64 " ms", command.c_str(), m_responseTimeoutMs);
 
     return SAI_STATUS_FAILURE;
 }
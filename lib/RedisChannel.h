@@ -16,6 +16,11 @@
 
 #include <memory>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <unordered_map>
 
 namespace sairedis
 {
@@ -34,6 +39,8 @@ namespace sairedis
 
             std::shared_ptr<swss::DBConnector> getDbConnector() const;
 
+            virtual bool supportsConcurrentWait() const override;
+
             virtual void setBuffered(
                     _In_ bool buffered) override;
 
@@ -56,6 +63,48 @@ namespace sairedis
 
             virtual void notificationThreadFunction() override;
 
+        private:
+
+            /**
+             * @brief Request waiting for response.
+             */
+            struct PendingRequest
+            {
+                /**
+                 * @brief Request id was sent with request.
+                 *
+                 * Otherwise response is matched by order.
+                 */
+                bool correlated;
+
+                bool ready;
+
+                swss::KeyOpFieldsValuesTuple response;
+
+                std::condition_variable cv;
+            };
+
+            /**
+             * @brief Whether request with given command will be followed by
+             * wait for response.
+             */
+            bool expectsResponse(
+                    _In_ const std::string& command) const;
+
+            /**
+             * @brief Register request of current thread.
+             *
+             * Must be called before request is sent, so response can't
+             * arrive before request is registered.
+             */
+            uint64_t registerRequest(
+                    _In_ bool correlated);
+
+            void responseThreadFunction();
+
+            void processResponse(
+                    _Inout_ swss::KeyOpFieldsValuesTuple& kco);
+
         private:
 
             std::string m_dbAsic;
@@ -67,16 +116,68 @@ namespace sairedis
              */
             std::shared_ptr<swss::ProducerTable>  m_asicState;
 
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
+
+            /**
+             * @brief Serializes sending requests.
+             *
+             * Request is registered and sent under this lock, so order of
+             * pending requests is the same as order in which syncd will
+             * process them.
+             */
+            std::mutex m_requestMutex;
+
+        private: // response
+
+            /**
+             * @brief Database connector used for responses.
+             */
+            std::shared_ptr<swss::DBConnector> m_dbResponse;
+
             /**
              * @brief Get consumer.
              *
-             * Channel used to receive responses from syncd.
+             * Channel used to receive responses from syncd, it's only used
+             * by response thread.
              */
             std::shared_ptr<swss::ConsumerTable> m_getConsumer;
 
-            std::shared_ptr<swss::DBConnector> m_db;
+            /**
+             * @brief Guards pending requests.
+             */
+            std::mutex m_responseMutex;
 
-            std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
+            uint64_t m_requestIndex;
+
+            /**
+             * @brief Request id prefix, unique per channel.
+             */
+            std::string m_requestIdPrefix;
+
+            /**
+             * @brief Pending requests by request index.
+             */
+            std::map<uint64_t, std::shared_ptr<PendingRequest>> m_pendingRequests;
+
+            /**
+             * @brief Last sent request index of each thread, consumed by wait.
+             */
+            std::unordered_map<std::thread::id, uint64_t> m_threadRequests;
+
+            /**
+             * @brief Event used to end response thread.
+             */
+            swss::SelectableEvent m_responseThreadShouldEndEvent;
+
+            /**
+             * @brief Response thread.
+             *
+             * Pops all responses from get consumer and passes them to
+             * waiting threads.
+             */
+            std::shared_ptr<std::thread> m_responseThread;
 
         private: // notification
 
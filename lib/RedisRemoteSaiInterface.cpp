@@ -5,6 +5,7 @@
 #include "SkipRecordAttrContainer.h"
 #include "SwitchContainer.h"
 #include "ZeroMQChannel.h"
+#include "AutoBulkBuffer.h"
 
 #include "sairediscommon.h"
 
@@ -37,6 +38,7 @@ RedisRemoteSaiInterface::RedisRemoteSaiInterface(
     m_contextConfig(contextConfig),
     m_redisCommunicationMode(SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC),
     m_recorder(recorder),
+    m_contextMutex(nullptr),
     m_notificationCallback(notificationCallback)
 {
     SWSS_LOG_ENTER();
@@ -78,6 +80,10 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
     m_syncMode = false;
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 
+    m_autoBulk = false;
+    m_autoBulkBuffer = std::make_shared<AutoBulkBuffer>();
+    m_autoBulkStatus = SAI_STATUS_SUCCESS;
+
     if (m_contextConfig->m_zmqEnable)
     {
         m_communicationChannel = std::make_shared<ZeroMQChannel>(
@@ -96,6 +102,8 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
                 std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3));
     }
 
+    m_communicationChannel->setSyncMode(m_syncMode);
+
     m_responseTimeoutMs = m_communicationChannel->getResponseTimeout();
 
     m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
@@ -124,6 +132,8 @@ sai_status_t RedisRemoteSaiInterface::apiUninitialize(void)
         return SAI_STATUS_FAILURE;
     }
 
+    flushAutoBulk();
+
     m_communicationChannel = nullptr; // will stop thread
 
     // clear local state after stopping threads
@@ -186,9 +196,12 @@ sai_status_t RedisRemoteSaiInterface::create(
                 return SAI_STATUS_SUCCESS;
             }
 
-            refreshTableDump();
+            // ASIC view is not dumped here, since metadata may be loaded
+            // from snapshot, see Context::populateMetadata
+
+            auto key = std::string(ASIC_STATE_TABLE) + ":" + sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH) + ":" + sai_serialize_object_id(switchId);
 
-            if (m_tableDump.find(switchId) == m_tableDump.end())
+            if (!m_db->exists(key))
             {
                 SWSS_LOG_ERROR("failed to find switch %s to connect (init=false)",
                         sai_serialize_object_id(switchId).c_str());
@@ -345,6 +358,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             SWSS_LOG_WARN("sync mode is depreacated, use communication mode");
 
+            flushAutoBulk();
+
             m_syncMode = attr->value.booldata;
 
             if (m_contextConfig->m_zmqEnable)
@@ -354,6 +369,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                 m_syncMode = true;
             }
 
+            m_communicationChannel->setSyncMode(m_syncMode);
+
             if (m_syncMode)
             {
                 SWSS_LOG_NOTICE("disabling buffered pipeline in sync mode");
@@ -365,6 +382,10 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
         case SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE:
 
+            // pending operations must be sent on current channel
+
+            flushAutoBulk();
+
             m_redisCommunicationMode = (sai_redis_communication_mode_t)attr->value.s32;
 
             if (m_contextConfig->m_zmqEnable)
@@ -390,6 +411,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
 
+                    m_communicationChannel->setSyncMode(m_syncMode);
+
                     m_communicationChannel->setBuffered(true);
 
                     return SAI_STATUS_SUCCESS;
@@ -406,6 +429,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
 
+                    m_communicationChannel->setSyncMode(m_syncMode);
+
                     m_communicationChannel->setBuffered(false);
 
                     return SAI_STATUS_SUCCESS;
@@ -428,6 +453,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_syncMode = true;
 
+                    m_communicationChannel->setSyncMode(m_syncMode);
+
                     SWSS_LOG_NOTICE("disabling buffered pipeline in sync mode");
 
                     m_communicationChannel->setBuffered(false);
@@ -455,8 +482,42 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
             return SAI_STATUS_SUCCESS;
 
         case SAI_REDIS_SWITCH_ATTR_FLUSH:
+            {
+                flushAutoBulk();
+
+                m_communicationChannel->flush();
+
+                auto status = m_autoBulkStatus;
+
+                m_autoBulkStatus = SAI_STATUS_SUCCESS;
 
-            m_communicationChannel->flush();
+                return status;
+            }
+
+        case SAI_REDIS_SWITCH_ATTR_AUTO_BULK:
+
+            if (!attr->value.booldata)
+            {
+                flushAutoBulk();
+            }
+
+            m_autoBulk = attr->value.booldata;
+
+            SWSS_LOG_NOTICE("auto bulk %s", m_autoBulk ? "enabled" : "disabled");
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_SIZE:
+
+            flushAutoBulk();
+
+            m_autoBulkBuffer->setMaxSize(attr->value.u32);
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_DELAY:
+
+            m_autoBulkBuffer->setMaxDelay(attr->value.u64);
 
             return SAI_STATUS_SUCCESS;
 
@@ -486,6 +547,10 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
             return notifyCounterOperations(objectId,
                                            reinterpret_cast<sai_redis_flex_counter_parameter_t*>(attr->value.ptr));
 
+        case SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_BULK:
+            return notifyBulkCounterOperations(objectId,
+                                               reinterpret_cast<sai_redis_flex_counter_bulk_parameter_t*>(attr->value.ptr));
+
         default:
             break;
     }
@@ -559,6 +624,8 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterGroupOperations(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     std::vector<swss::FieldValueTuple> entries;
 
     if (flexCounterGroupParam == nullptr || !isSaiS8ListValidString(flexCounterGroupParam->counter_group_name))
@@ -591,6 +658,8 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     if (flexCounterParam == nullptr || !isSaiS8ListValidString(flexCounterParam->counter_key))
     {
         SWSS_LOG_ERROR("Invalid parameters when handling counter operation");
@@ -617,6 +686,76 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
     return waitForResponse(SAI_COMMON_API_SET);
 }
 
+sai_status_t RedisRemoteSaiInterface::notifyBulkCounterOperations(
+        _In_ sai_object_id_t objectId,
+        _In_ const sai_redis_flex_counter_bulk_parameter_t *flexCounterBulkParam)
+{
+    SWSS_LOG_ENTER();
+
+    flushAutoBulk();
+
+    if (flexCounterBulkParam == nullptr ||
+            flexCounterBulkParam->count == 0 ||
+            flexCounterBulkParam->params == nullptr ||
+            flexCounterBulkParam->statuses == nullptr)
+    {
+        SWSS_LOG_ERROR("Invalid parameters when handling bulk counter operation");
+        return SAI_STATUS_FAILURE;
+    }
+
+    bool invalidParams = false;
+
+    // field: counter key
+    // value: counter fields joined, empty to stop polling
+    std::vector<swss::FieldValueTuple> entries;
+    std::vector<uint32_t> indexes;
+
+    for (uint32_t idx = 0; idx < flexCounterBulkParam->count; idx++)
+    {
+        auto& flexCounterParam = flexCounterBulkParam->params[idx];
+
+        if (!isSaiS8ListValidString(flexCounterParam.counter_key))
+        {
+            SWSS_LOG_ERROR("Invalid counter key at index %u when handling bulk counter operation", idx);
+
+            flexCounterBulkParam->statuses[idx] = SAI_STATUS_FAILURE;
+
+            invalidParams = true;
+            continue;
+        }
+
+        std::vector<swss::FieldValueTuple> values;
+        std::string key((const char*)flexCounterParam.counter_key.list, flexCounterParam.counter_key.count);
+
+        if (emplaceStrings(flexCounterParam.counter_field_name, flexCounterParam.counter_ids, values))
+        {
+            emplaceStrings(STATS_MODE_FIELD, flexCounterParam.stats_mode, values);
+        }
+
+        entries.emplace_back(key, Globals::joinFieldValues(values));
+        indexes.push_back(idx);
+    }
+
+    if (entries.empty())
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    m_recorder->recordBulkGenericCounterPolling(entries);
+    m_communicationChannel->set(std::to_string(entries.size()), entries, REDIS_FLEX_COUNTER_COMMAND_BULK_POLL);
+
+    std::vector<sai_status_t> statuses(entries.size());
+
+    auto status = waitForBulkResponse(SAI_COMMON_API_BULK_SET, (uint32_t)entries.size(), statuses.data());
+
+    for (size_t idx = 0; idx < indexes.size(); idx++)
+    {
+        flexCounterBulkParam->statuses[indexes[idx]] = statuses[idx];
+    }
+
+    return invalidParams ? SAI_STATUS_FAILURE : status;
+}
+
 sai_status_t RedisRemoteSaiInterface::set(
         _In_ sai_object_type_t objectType,
         _In_ sai_object_id_t objectId,
@@ -824,6 +963,13 @@ sai_status_t RedisRemoteSaiInterface::create(
         entry.push_back(null);
     }
 
+    if (m_autoBulk && AutoBulkBuffer::isSupported(SAI_COMMON_API_CREATE, object_type))
+    {
+        return autoBulk(SAI_COMMON_API_CREATE, object_type, serializedObjectId, entry);
+    }
+
+    flushAutoBulk();
+
     auto serializedObjectType = sai_serialize_object_type(object_type);
 
     const std::string key = serializedObjectType + ":" + serializedObjectId;
@@ -847,6 +993,13 @@ sai_status_t RedisRemoteSaiInterface::remove(
 {
     SWSS_LOG_ENTER();
 
+    if (m_autoBulk && AutoBulkBuffer::isSupported(SAI_COMMON_API_REMOVE, objectType))
+    {
+        return autoBulk(SAI_COMMON_API_REMOVE, objectType, serializedObjectId, {});
+    }
+
+    flushAutoBulk();
+
     auto serializedObjectType = sai_serialize_object_type(objectType);
 
     const std::string key = serializedObjectType + ":" + serializedObjectId;
@@ -877,6 +1030,13 @@ sai_status_t RedisRemoteSaiInterface::set(
             attr,
             false);
 
+    if (m_autoBulk && AutoBulkBuffer::isSupported(SAI_COMMON_API_SET, objectType))
+    {
+        return autoBulk(SAI_COMMON_API_SET, objectType, serializedObjectId, entry);
+    }
+
+    flushAutoBulk();
+
     auto serializedObjectType = sai_serialize_object_type(objectType);
 
     std::string key = serializedObjectType + ":" + serializedObjectId;
@@ -918,6 +1078,39 @@ sai_status_t RedisRemoteSaiInterface::waitForResponse(
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t RedisRemoteSaiInterface::waitUnlocked(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    // channel can be replaced by other thread while we are waiting
+
+    auto channel = m_communicationChannel;
+
+    if (m_contextMutex == nullptr || !channel->supportsConcurrentWait() || !m_contextMutex->unlockForWait())
+    {
+        return channel->wait(command, kco);
+    }
+
+    sai_status_t status;
+
+    try
+    {
+        status = channel->wait(command, kco);
+    }
+    catch (...)
+    {
+        m_contextMutex->lock();
+
+        throw;
+    }
+
+    m_contextMutex->lock();
+
+    return status;
+}
+
 sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
         _In_ sai_object_type_t objectType,
         _In_ uint32_t attr_count,
@@ -927,7 +1120,7 @@ sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     auto &values = kfvFieldsValues(kco);
 
@@ -966,6 +1159,8 @@ sai_status_t RedisRemoteSaiInterface::get(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     /*
      * Since user may reuse buffers, then oid list buffers maybe not cleared
      * and contain some garbage, let's clean them so we send all oids as null to
@@ -1037,6 +1232,8 @@ sai_status_t RedisRemoteSaiInterface::flushFdbEntries(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto entry = SaiAttributeList::serialize_attr_list(
             SAI_OBJECT_TYPE_FDB_FLUSH,
             attrCount,
@@ -1071,6 +1268,8 @@ sai_status_t RedisRemoteSaiInterface::objectTypeGetAvailability(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto strSwitchId = sai_serialize_object_id(switchId);
 
     auto entry = SaiAttributeList::serialize_attr_list(objectType, attrCount, attrList, false);
@@ -1105,7 +1304,7 @@ sai_status_t RedisRemoteSaiInterface::waitForObjectTypeGetAvailabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1134,6 +1333,8 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeCapability(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto switchIdStr = sai_serialize_object_id(switchId);
     auto objectTypeStr = sai_serialize_object_type(objectType);
 
@@ -1181,7 +1382,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeCapabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1213,6 +1414,8 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeEnumValuesCapability(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     if (enumValuesCapability && enumValuesCapability->list)
     {
         // clear input list, since we use serialize to transfer values
@@ -1270,7 +1473,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityR
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1343,6 +1546,8 @@ sai_status_t RedisRemoteSaiInterface::getStats(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
 
     auto entry = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
@@ -1368,7 +1573,7 @@ sai_status_t RedisRemoteSaiInterface::waitForGetStatsResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1395,6 +1600,8 @@ sai_status_t RedisRemoteSaiInterface::queryStatsCapability(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto switchIdStr = sai_serialize_object_id(switchId);
     auto objectTypeStr = sai_serialize_object_type(objectType);
 
@@ -1450,7 +1657,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryStatsCapabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1502,6 +1709,8 @@ sai_status_t RedisRemoteSaiInterface::queryStatsStCapability(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto switchIdStr = sai_serialize_object_id(switchId);
     auto objectTypeStr = sai_serialize_object_type(objectType);
 
@@ -1556,7 +1765,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryStatsStCapabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE, kco);
+    auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1627,6 +1836,8 @@ sai_status_t RedisRemoteSaiInterface::clearStats(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
 
     auto values = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
@@ -1704,12 +1915,12 @@ sai_status_t RedisRemoteSaiInterface::bulkRemove(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     // TODO support mode, this will need to go as extra parameter and needs to
     // be supported by LUA script passed as first or last entry in values,
     // currently mode is ignored
 
-    std::string serializedObjectType = sai_serialize_object_type(object_type);
-
     std::vector<swss::FieldValueTuple> entries;
 
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
@@ -1721,21 +1932,7 @@ sai_status_t RedisRemoteSaiInterface::bulkRemove(
         entries.push_back(fvtNoStatus);
     }
 
-    /*
-     * We are adding number of entries to actually add ':' to be compatible
-     * with previous
-     */
-
-    // key:         object_type:count
-    // field:       object_id
-    // value:       object_attrs
-    std::string key = serializedObjectType + ":" + std::to_string(entries.size());
-
-    m_recorder->recordBulkGenericRemove(serializedObjectType, entries);
-
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
-
-    return waitForBulkResponse(SAI_COMMON_API_BULK_REMOVE, (uint32_t)serialized_object_ids.size(), object_statuses);
+    return sendBulkRequest(SAI_COMMON_API_BULK_REMOVE, object_type, entries, object_statuses);
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForBulkResponse(
@@ -1794,7 +1991,7 @@ sai_status_t RedisRemoteSaiInterface::waitForBulkGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    const auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    const auto status = waitUnlocked(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     const auto &values = kfvFieldsValues(kco);
 
@@ -1902,6 +2099,8 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     // TODO support mode
 
     std::vector<swss::FieldValueTuple> entries;
@@ -1917,20 +2116,7 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
         entries.push_back(value);
     }
 
-    /*
-     * We are adding number of entries to actually add ':' to be compatible
-     * with previous
-     */
-
-    auto serializedObjectType = sai_serialize_object_type(object_type);
-
-    std::string key = serializedObjectType + ":" + std::to_string(entries.size());
-
-    m_recorder->recordBulkGenericSet(serializedObjectType, entries);
-
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
-
-    return waitForBulkResponse(SAI_COMMON_API_BULK_SET, (uint32_t)serialized_object_ids.size(), object_statuses);
+    return sendBulkRequest(SAI_COMMON_API_BULK_SET, object_type, entries, object_statuses);
 }
 
 sai_status_t RedisRemoteSaiInterface::bulkGet(
@@ -1965,6 +2151,8 @@ sai_status_t RedisRemoteSaiInterface::bulkGet(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     const auto serializedObjectType = sai_serialize_object_type(object_type);
 
     std::vector<swss::FieldValueTuple> entries;
@@ -2063,9 +2251,9 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
 {
     SWSS_LOG_ENTER();
 
-    // TODO support mode
+    flushAutoBulk();
 
-    std::string str_object_type = sai_serialize_object_type(object_type);
+    // TODO support mode
 
     std::vector<swss::FieldValueTuple> entries;
 
@@ -2089,6 +2277,19 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
         entries.push_back(fvtNoStatus);
     }
 
+    return sendBulkRequest(SAI_COMMON_API_BULK_CREATE, object_type, entries, object_statuses);
+}
+
+sai_status_t RedisRemoteSaiInterface::sendBulkRequest(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple>& entries,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    auto serializedObjectType = sai_serialize_object_type(objectType);
+
     /*
      * We are adding number of entries to actually add ':' to be compatible
      * with previous
@@ -2097,13 +2298,112 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
     // key:         object_type:count
     // field:       object_id
     // value:       object_attrs
-    std::string key = str_object_type + ":" + std::to_string(entries.size());
+    std::string key = serializedObjectType + ":" + std::to_string(entries.size());
 
-    m_recorder->recordBulkGenericCreate(str_object_type, entries);
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
 
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+            m_recorder->recordBulkGenericCreate(serializedObjectType, entries);
 
-    return waitForBulkResponse(SAI_COMMON_API_BULK_CREATE, (uint32_t)serialized_object_ids.size(), object_statuses);
+            m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+            break;
+
+        case SAI_COMMON_API_BULK_REMOVE:
+
+            m_recorder->recordBulkGenericRemove(serializedObjectType, entries);
+
+            m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+
+            break;
+
+        case SAI_COMMON_API_BULK_SET:
+
+            m_recorder->recordBulkGenericSet(serializedObjectType, entries);
+
+            m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
+
+            break;
+
+        default:
+
+            SWSS_LOG_THROW("api %s is not supported", sai_serialize_common_api(api).c_str());
+    }
+
+    return waitForBulkResponse(api, (uint32_t)entries.size(), object_statuses);
+}
+
+sai_status_t RedisRemoteSaiInterface::autoBulk(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId,
+        _In_ const std::vector<swss::FieldValueTuple>& entry)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_autoBulkBuffer->canAppend(api, objectType, serializedObjectId))
+    {
+        flushAutoBulk();
+    }
+
+    m_autoBulkBuffer->append(api, objectType, serializedObjectId, Globals::joinFieldValues(entry));
+
+    if (m_autoBulkBuffer->isFull())
+    {
+        flushAutoBulk();
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t RedisRemoteSaiInterface::flushAutoBulk()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_autoBulkBuffer == nullptr || m_autoBulkBuffer->empty())
+    {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    auto api = m_autoBulkBuffer->getBulkApi();
+    auto objectType = m_autoBulkBuffer->getObjectType();
+
+    // buffer is cleared before sending, since sending can throw
+
+    auto entries = m_autoBulkBuffer->getEntries();
+
+    m_autoBulkBuffer->clear();
+
+    std::vector<sai_status_t> statuses(entries.size());
+
+    auto status = sendBulkRequest(api, objectType, entries, statuses.data());
+
+    for (size_t idx = 0; idx < entries.size(); idx++)
+    {
+        if (statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        SWSS_LOG_ERROR("deferred %s %s:%s failed: %s",
+                sai_serialize_common_api(api).c_str(),
+                sai_serialize_object_type(objectType).c_str(),
+                fvField(entries[idx]).c_str(),
+                sai_serialize_status(statuses[idx]).c_str());
+
+        if (m_autoBulkStatus == SAI_STATUS_SUCCESS)
+        {
+            m_autoBulkStatus = statuses[idx];
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS && m_autoBulkStatus == SAI_STATUS_SUCCESS)
+    {
+        m_autoBulkStatus = status;
+    }
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::notifySyncd(
@@ -2112,6 +2412,8 @@ sai_status_t RedisRemoteSaiInterface::notifySyncd(
 {
     SWSS_LOG_ENTER();
 
+    flushAutoBulk();
+
     std::vector<swss::FieldValueTuple> entry;
 
     auto key = sai_serialize(redisNotifySyncd);
@@ -2349,6 +2651,14 @@ void RedisRemoteSaiInterface::setMeta(
     m_meta = meta;
 }
 
+void RedisRemoteSaiInterface::setContextMutex(
+        _In_ ContextMutex* contextMutex)
+{
+    SWSS_LOG_ENTER();
+
+    m_contextMutex = contextMutex;
+}
+
 sai_switch_notifications_t RedisRemoteSaiInterface::syncProcessNotification(
         _In_ std::shared_ptr<Notification> notification)
 {
@@ -2408,6 +2718,22 @@ const std::map<sai_object_id_t, swss::TableDump>& RedisRemoteSaiInterface::getTa
     return m_tableDump;
 }
 
+uint64_t RedisRemoteSaiInterface::getAsicStateGeneration() const
+{
+    SWSS_LOG_ENTER();
+
+    auto value = m_db->get(REDIS_KEY_ASIC_STATE_GENERATION);
+
+    return value ? std::stoull(*value) : 0;
+}
+
+uint64_t RedisRemoteSaiInterface::incrementAsicStateGeneration()
+{
+    SWSS_LOG_ENTER();
+
+    return (uint64_t)m_db->incr(REDIS_KEY_ASIC_STATE_GENERATION);
+}
+
 void RedisRemoteSaiInterface::refreshTableDump()
 {
     SWSS_LOG_ENTER();
@@ -9,6 +9,8 @@
 #include "RedisChannel.h"
 #include "SwitchConfigContainer.h"
 #include "ContextConfig.h"
+#include "AutoBulkBuffer.h"
+#include "ContextMutex.h"
 
 #include "meta/Notification.h"
 
@@ -227,11 +229,28 @@ namespace sairedis
             void setMeta(
                     _In_ std::weak_ptr<saimeta::Meta> meta);
 
+            /**
+             * @brief Set mutex of context which owns this interface.
+             *
+             * Get and query calls release it while waiting for response.
+             */
+            void setContextMutex(
+                    _In_ ContextMutex* contextMutex);
+
             sai_switch_notifications_t syncProcessNotification(
                     _In_ std::shared_ptr<Notification> notification);
 
             const std::map<sai_object_id_t, swss::TableDump>& getTableDump() const;
 
+            void refreshTableDump();
+
+            /**
+             * @brief Get current ASIC state generation, 0 if not set.
+             */
+            uint64_t getAsicStateGeneration() const;
+
+            uint64_t incrementAsicStateGeneration();
+
             bool containsSwitch(
                     _In_ sai_object_id_t switchId) const;
 
@@ -289,8 +308,57 @@ namespace sairedis
                     _In_ sai_bulk_op_error_mode_t mode,
                     _Out_ sai_status_t *object_statuses);
 
+        private: // auto bulk
+
+            /**
+             * @brief Buffer single API operation in auto bulk buffer.
+             *
+             * Pending operations are flushed first if operation can't be
+             * appended, and buffer is flushed when it becomes full.
+             *
+             * @return Always SAI_STATUS_SUCCESS, actual status is deferred.
+             */
+            sai_status_t autoBulk(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ const std::vector<swss::FieldValueTuple>& entry);
+
+            /**
+             * @brief Send pending auto bulk operations to syncd.
+             *
+             * Must be called before sending any other request to syncd, so
+             * syncd will receive operations in the same order as they were
+             * called. Failed operation statuses are accumulated and returned
+             * on SAI_REDIS_SWITCH_ATTR_FLUSH.
+             */
+            sai_status_t flushAutoBulk();
+
+            /**
+             * @brief Record and send bulk request and wait for response.
+             */
+            sai_status_t sendBulkRequest(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<swss::FieldValueTuple>& entries,
+                    _Out_ sai_status_t *object_statuses);
+
         private: // QUAD API response
 
+            /**
+             * @brief Wait on communication channel with context mutex released.
+             *
+             * Used by get and query calls. Request is already sent and Meta
+             * validated it under context mutex, so other calls on the same
+             * context can proceed until response arrives. Mutex is locked
+             * again before response is processed. Mutex is not released if
+             * channel doesn't support concurrent waits or it is held by outer
+             * call.
+             */
+            sai_status_t waitUnlocked(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
             /**
              * @brief Wait for response.
              *
@@ -415,6 +483,10 @@ namespace sairedis
                     _In_ sai_object_id_t objectId,
                     _In_ const sai_redis_flex_counter_parameter_t *flexCounterParam);
 
+            sai_status_t notifyBulkCounterOperations(
+                    _In_ sai_object_id_t objectId,
+                    _In_ const sai_redis_flex_counter_bulk_parameter_t *flexCounterBulkParam);
+
         private:
 
             sai_status_t sai_redis_notify_syncd(
@@ -426,8 +498,6 @@ namespace sairedis
             sai_switch_notifications_t processNotification(
                     _In_ std::shared_ptr<Notification> notification);
 
-            void refreshTableDump();
-
         private:
 
             std::shared_ptr<ContextConfig> m_contextConfig;
@@ -458,10 +528,22 @@ namespace sairedis
 
             std::shared_ptr<Channel> m_communicationChannel;
 
+            ContextMutex* m_contextMutex;
+
             uint64_t m_responseTimeoutMs;
 
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::map<sai_object_id_t, swss::TableDump> m_tableDump;
+
+            bool m_autoBulk;
+
+            std::shared_ptr<AutoBulkBuffer> m_autoBulkBuffer;
+
+            /**
+             * @brief First failed status of deferred operations since last
+             * flush requested by user.
+             */
+            sai_status_t m_autoBulkStatus;
     };
 }
@@ -23,7 +23,8 @@ using namespace std::placeholders;
         SWSS_LOG_ERROR("no context at index %u for oid %s",                 \
                 _globalContext,                                             \
                 sai_serialize_object_id(oid).c_str());                      \
-        return SAI_STATUS_FAILURE; }
+        return SAI_STATUS_FAILURE; }                                        \
+    CONTEXT_MUTEX(context);
 
 #define REDIS_CHECK_POINTER(pointer)                                        \
     if ((pointer) == nullptr) {                                             \
@@ -106,11 +107,23 @@ sai_status_t Sai::apiUninitialize(void)
 
     SWSS_LOG_NOTICE("begin");
 
-    m_contextMap.clear();
+    std::map<uint32_t, std::shared_ptr<Context>> contextMap;
+
+    {
+        MUTEX();
 
-    m_recorder = nullptr;
+        contextMap.swap(m_contextMap);
 
-    m_apiInitialized = false;
+        m_recorder = nullptr;
+
+        m_apiInitialized = false;
+    }
+
+    // Contexts are destroyed outside api mutex, since context destructor
+    // joins notification thread, which may be processing notification and
+    // calling api (and acquiring api mutex) from notification callback.
+
+    contextMap.clear();
 
     SWSS_LOG_NOTICE("end");
 
@@ -126,15 +139,14 @@ sai_status_t Sai::create(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    REDIS_CHECK_CONTEXT(switchId);
+    auto globalContext = VirtualObjectIdManager::getGlobalContext(switchId);
 
     if (objectType == SAI_OBJECT_TYPE_SWITCH && attr_count > 0 && attr_list)
     {
-        uint32_t globalContext = 0; // default
+        globalContext = 0; // default
 
         if (attr_list[attr_count - 1].id == SAI_REDIS_SWITCH_ATTR_CONTEXT)
         {
@@ -142,17 +154,19 @@ sai_status_t Sai::create(
         }
 
         SWSS_LOG_NOTICE("request switch create with context %u", globalContext);
+    }
 
-        context = getContext(globalContext);
+    auto context = getContext(globalContext);
 
-        if (context == nullptr)
-        {
-            SWSS_LOG_ERROR("no global context defined at index %u", globalContext);
+    if (context == nullptr)
+    {
+        SWSS_LOG_ERROR("no global context defined at index %u", globalContext);
 
-            return SAI_STATUS_FAILURE;
-        }
+        return SAI_STATUS_FAILURE;
     }
 
+    CONTEXT_MUTEX(context);
+
     auto status = context->m_meta->create(
             objectType,
             objectId,
@@ -184,7 +198,6 @@ sai_status_t Sai::remove(
         _In_ sai_object_type_t objectType,
         _In_ sai_object_id_t objectId)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -197,47 +210,50 @@ sai_status_t Sai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     if (RedisRemoteSaiInterface::isRedisAttribute(objectType, attr))
     {
-        if (attr->id == SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE)
-        {
-            // Since communication mode destroys current channel and creates
-            // new one, it may happen, that during this SET api execution when
-            // api mutex is acquired, channel destructor will be blocking on
-            // thread->join() and channel thread will start processing
-            // incoming notification. That notification will be synchronized
-            // with api mutex and will cause deadlock, so to mitigate this
-            // scenario we will unlock api mutex here.
-            //
-            // This is not the perfect, but assuming that communication mode is
-            // changed in single thread and before switch create then we should
-            // not hit race condition.
-
-            SWSS_LOG_NOTICE("unlocking api mutex for communication mode");
-
-            MUTEX_UNLOCK();
-        }
-
         // skip metadata if attribute is redis extension attribute
 
         bool success = true;
 
         // Setting on all contexts if objectType != SAI_OBJECT_TYPE_SWITCH or objectId == NULL
-        for (auto& kvp: m_contextMap)
+        for (auto& context: getAllContexts())
         {
+            std::unique_lock<ContextMutex> lock(context->m_mutex, std::defer_lock);
+
+            if (attr->id == SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE)
+            {
+                // Since communication mode destroys current channel and creates
+                // new one, it may happen, that during this SET api execution when
+                // context mutex is acquired, channel destructor will be blocking on
+                // thread->join() and channel thread will start processing
+                // incoming notification. That notification will be synchronized
+                // with context mutex and will cause deadlock, so to mitigate this
+                // scenario we will not lock context mutex here.
+                //
+                // This is not the perfect, but assuming that communication mode is
+                // changed in single thread and before switch create then we should
+                // not hit race condition.
+
+                SWSS_LOG_NOTICE("not locking context mutex for communication mode");
+            }
+            else
+            {
+                lock.lock();
+            }
+
             if (objectType == SAI_OBJECT_TYPE_SWITCH && objectId != SAI_NULL_OBJECT_ID)
             {
-                if (!kvp.second->m_redisSai->containsSwitch(objectId))
+                if (!context->m_redisSai->containsSwitch(objectId))
                 {
                     continue;
                 }
             }
 
-            sai_status_t status = kvp.second->m_redisSai->set(objectType, objectId, attr);
+            sai_status_t status = context->m_redisSai->set(objectType, objectId, attr);
 
             success &= (status == SAI_STATUS_SUCCESS);
 
@@ -260,7 +276,6 @@ sai_status_t Sai::get(
         _In_ uint32_t attr_count,
         _Inout_ sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -280,7 +295,6 @@ sai_status_t Sai::create(                                           \
         _In_ uint32_t attr_count,                                   \
         _In_ const sai_attribute_t *attr_list)                      \
 {                                                                   \
-    MUTEX();                                                        \
     SWSS_LOG_ENTER();                                               \
     REDIS_CHECK_API_INITIALIZED();                                  \
     REDIS_CHECK_POINTER(entry)                                      \
@@ -294,7 +308,6 @@ SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_CREATE_ENTRY);
 sai_status_t Sai::remove(                                   \
         _In_ const sai_ ## ot ## _t* entry)                 \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
@@ -309,7 +322,6 @@ sai_status_t Sai::set(                                      \
         _In_ const sai_ ## ot ## _t* entry,                 \
         _In_ const sai_attribute_t *attr)                   \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
@@ -325,7 +337,6 @@ sai_status_t Sai::get(                                          \
         _In_ uint32_t attr_count,                               \
         _Inout_ sai_attribute_t *attr_list)                     \
 {                                                               \
-    MUTEX();                                                    \
     SWSS_LOG_ENTER();                                           \
     REDIS_CHECK_API_INITIALIZED();                              \
     REDIS_CHECK_POINTER(entry)                                  \
@@ -344,7 +355,6 @@ sai_status_t Sai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -362,7 +372,6 @@ sai_status_t Sai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
@@ -378,7 +387,6 @@ sai_status_t Sai::queryStatsStCapability(
     _In_ sai_object_type_t objectType,
     _Inout_ sai_stat_st_capability_list_t *stats_capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
@@ -397,7 +405,6 @@ sai_status_t Sai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -417,7 +424,6 @@ sai_status_t Sai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -472,7 +478,6 @@ sai_status_t Sai::bulkCreate(
         _Out_ sai_object_id_t *object_id,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -495,7 +500,6 @@ sai_status_t Sai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_POINTER(object_id);
@@ -517,7 +521,6 @@ sai_status_t Sai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(*object_id);
@@ -540,7 +543,6 @@ sai_status_t Sai::bulkGet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(*object_id);
@@ -566,7 +568,6 @@ sai_status_t Sai::bulkCreate(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -591,7 +592,6 @@ sai_status_t Sai::bulkRemove(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -615,7 +615,6 @@ sai_status_t Sai::bulkSet(                                  \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -641,7 +640,6 @@ sai_status_t Sai::bulkGet(                                  \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(ot);                                \
@@ -661,7 +659,6 @@ sai_status_t Sai::flushFdbEntries(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -681,7 +678,6 @@ sai_status_t Sai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
@@ -700,7 +696,6 @@ sai_status_t Sai::queryAttributeCapability(
         _In_ sai_attr_id_t attr_id,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -718,7 +713,6 @@ sai_status_t Sai::queryAttributeEnumValuesCapability(
         _In_ sai_attr_id_t attr_id,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -764,13 +758,14 @@ sai_status_t Sai::logSet(
         _In_ sai_api_t api,
         _In_ sai_log_level_t log_level)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    for (auto&kvp: m_contextMap)
+    for (auto& context: getAllContexts())
     {
-        kvp.second->m_meta->logSet(api, log_level);
+        CONTEXT_MUTEX(context);
+
+        context->m_meta->logSet(api, log_level);
     }
 
     return SAI_STATUS_SUCCESS;
@@ -779,7 +774,6 @@ sai_status_t Sai::logSet(
 sai_status_t Sai::queryApiVersion(
         _Out_ sai_api_version_t *version)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -789,11 +783,13 @@ sai_status_t Sai::queryApiVersion(
     // currently we will return just first context on context map, since
     // user maybe not aware of trick with casting context
 
-    for (auto&kvp: m_contextMap)
+    for (auto& context: getAllContexts())
     {
         SWSS_LOG_WARN("using first context");
 
-        return kvp.second->m_meta->queryApiVersion(version);
+        CONTEXT_MUTEX(context);
+
+        return context->m_meta->queryApiVersion(version);
     }
 
     SWSS_LOG_ERROR("context map is empty");
@@ -807,8 +803,8 @@ sai_status_t Sai::queryApiVersion(
  * It is possible that when we create switch we will immediately start getting
  * notifications from it, and it may happen that this switch will not be yet
  * put to switch container and notification won't find it. But before
- * notification will be processed it will first try to acquire mutex, so create
- * switch function will end and switch will be put inside container.
+ * notification will be processed it will first try to acquire context mutex,
+ * so create switch function will end and switch will be put inside container.
  *
  * Similar it can happen that we receive notification when we are removing
  * switch, then switch will be removed from switch container and notification
@@ -820,7 +816,6 @@ sai_switch_notifications_t Sai::handle_notification(
         _In_ std::shared_ptr<Notification> notification,
         _In_ Context* context)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
 
     if (!m_apiInitialized)
@@ -830,12 +825,15 @@ sai_switch_notifications_t Sai::handle_notification(
         return { };
     }
 
+    CONTEXT_MUTEX(context);
+
     return context->m_redisSai->syncProcessNotification(notification);
 }
 
 std::shared_ptr<Context> Sai::getContext(
         _In_ uint32_t globalContext)
 {
+    MUTEX();
     SWSS_LOG_ENTER();
 
     auto it = m_contextMap.find(globalContext);
@@ -846,6 +844,21 @@ std::shared_ptr<Context> Sai::getContext(
     return it->second;
 }
 
+std::vector<std::shared_ptr<Context>> Sai::getAllContexts()
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<Context>> contexts;
+
+    for (auto& kvp: m_contextMap)
+    {
+        contexts.push_back(kvp.second);
+    }
+
+    return contexts;
+}
+
 std::vector<swss::FieldValueTuple> serialize_counter_id_list(
         _In_ const sai_enum_metadata_t *stats_enum,
         _In_ uint32_t count,
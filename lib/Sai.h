@@ -12,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <map>
 
 namespace sairedis
@@ -202,10 +203,18 @@ namespace sairedis
             std::shared_ptr<Context> getContext(
                     _In_ uint32_t globalContext);
 
+            std::vector<std::shared_ptr<Context>> getAllContexts();
+
         private:
 
-            bool m_apiInitialized;
+            std::atomic<bool> m_apiInitialized;
 
+            /**
+             * @brief Api mutex.
+             *
+             * Guards context map and global operations, data path api calls
+             * are serialized by context mutex.
+             */
             std::recursive_mutex m_apimutex;
 
             std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
@@ -2,3 +2,4 @@
 
 #define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
 #define MUTEX_UNLOCK() m_apimutex.unlock()
+#define CONTEXT_MUTEX(context) std::lock_guard<sairedis::ContextMutex> _contextLock((context)->m_mutex)
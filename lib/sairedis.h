@@ -182,6 +182,31 @@ typedef struct _sai_redis_flex_counter_parameter_t
 
 } sai_redis_flex_counter_parameter_t;
 
+/**
+ * @brief Bulk flex counter operations.
+ *
+ * Each parameter has the same meaning as in SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER,
+ * but all of them are sent to syncd in single request.
+ */
+typedef struct _sai_redis_flex_counter_bulk_parameter_t
+{
+    /**
+     * @brief Number of counter operations.
+     */
+    uint32_t count;
+
+    /**
+     * @brief List of counter operations.
+     */
+    sai_redis_flex_counter_parameter_t *params;
+
+    /**
+     * @brief List of operation statuses, filled by the call.
+     */
+    sai_status_t *statuses;
+
+} sai_redis_flex_counter_bulk_parameter_t;
+
 typedef enum _sai_redis_switch_attr_t
 {
     /**
@@ -364,6 +389,64 @@ typedef enum _sai_redis_switch_attr_t
      */
     SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER,
 
+    /**
+     * @brief Automatic bulking of single API calls.
+     *
+     * When enabled, consecutive single create, remove and set calls on route,
+     * neighbor and FDB entries and next hops with the same object type and
+     * API are not sent to syncd one by one, but aggregated and sent as single
+     * bulk request. Those calls return SAI_STATUS_SUCCESS right away and
+     * actual status is deferred.
+     *
+     * Pending operations are sent before any other API call (including GET),
+     * when SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_SIZE operations are pending,
+     * on next call when SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_DELAY passed since
+     * first pending operation, and when SAI_REDIS_SWITCH_ATTR_FLUSH is set.
+     *
+     * Setting SAI_REDIS_SWITCH_ATTR_FLUSH returns first failed status of
+     * deferred operations since previous flush. Disabling sends pending
+     * operations.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_AUTO_BULK,
+
+    /**
+     * @brief Maximum number of operations in automatic bulk request.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 1000
+     */
+    SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_SIZE,
+
+    /**
+     * @brief Maximum delay of first pending automatic bulk operation in
+     * milliseconds.
+     *
+     * Delay is checked on next API call, pending operations are never sent
+     * from background.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 10
+     */
+    SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_DELAY,
+
+    /**
+     * @brief Bulk flex counter operations
+     *
+     * Registers or unregisters counters of many keys in single request.
+     * Status of each key is returned in statuses list of the parameter.
+     *
+     * @type sai_redis_flex_counter_bulk_parameter_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_BULK,
+
 } sai_redis_switch_attr_t;
 
 /**
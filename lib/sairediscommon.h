@@ -57,6 +57,7 @@
 #define REDIS_FLEX_COUNTER_COMMAND_SET_GROUP        "set_counter_group"
 #define REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP        "del_counter_group"
 #define REDIS_FLEX_COUNTER_COMMAND_RESPONSE         "counter_response"
+#define REDIS_FLEX_COUNTER_COMMAND_BULK_POLL        "bulk_poll"
 
 #define REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY      "stats_capability_query"
 #define REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE   "stats_capability_response"
@@ -75,6 +76,15 @@
  */
 #define REDIS_KEY_VIDCOUNTER "VIDCOUNTER"
 
+/**
+ * @brief Redis ASIC state generation key name.
+ *
+ * Incremented by syncd after every ASIC state write and on start, and by
+ * sairedis when it saves or consumes meta snapshot.
+ * Meta snapshot is valid only if its generation is equal to this value.
+ */
+#define REDIS_KEY_ASIC_STATE_GENERATION "ASIC_STATE_GENERATION"
+
 /**
  * @brief Table which will be used to forward notifications from syncd.
  */
@@ -97,6 +107,16 @@
  */
 #define REDIS_TABLE_GETRESPONSE     "GETRESPONSE"
 
+/**
+ * @brief Request id field.
+ *
+ * Appended by sairedis as last field of request which expects response and
+ * echoed by syncd as last field of response, so responses can be matched
+ * with requests when multiple requests are in flight. Syncd removes this
+ * field before processing request.
+ */
+#define REDIS_FIELD_REQUEST_ID      "REQUEST_ID"
+
 // REDIS default database defines
 
 #define REDIS_DEFAULT_DATABASE_ASIC         "ASIC_DB"
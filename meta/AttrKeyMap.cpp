@@ -2,6 +2,9 @@
 
 #include "sai_serialize.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace saimeta;
 
 void AttrKeyMap::clear()
@@ -9,6 +12,8 @@ void AttrKeyMap::clear()
     SWSS_LOG_ENTER();
 
     m_map.clear();
+
+    m_attrKeys.clear();
 }
 
 void AttrKeyMap::insert(
@@ -17,9 +22,12 @@ void AttrKeyMap::insert(
 {
     SWSS_LOG_ENTER();
 
+    eraseMetaKey(metaKey);
+
     m_map[metaKey] = attrKey;
-}
 
+    m_attrKeys[attrKey] = metaKey;
+}
 
 void AttrKeyMap::eraseMetaKey(
         _In_ const std::string& metaKey)
@@ -30,7 +38,14 @@ void AttrKeyMap::eraseMetaKey(
 
     if (it != m_map.end())
     {
-        SWSS_LOG_DEBUG("erasing attributes key %s", it->second.c_str());
+        SWSS_LOG_DEBUG("erasing attributes key of %s", metaKey.c_str());
+
+        auto ait = m_attrKeys.find(it->second);
+
+        if (ait != m_attrKeys.end() && ait->second == metaKey)
+        {
+            m_attrKeys.erase(ait);
+        }
 
         m_map.erase(it);
     }
@@ -41,15 +56,38 @@ bool AttrKeyMap::attrKeyExists(
 {
     SWSS_LOG_ENTER();
 
-    for (auto& it: m_map)
+    return m_attrKeys.find(attrKey) != m_attrKeys.end();
+}
+
+template <typename T>
+static void appendValue(
+        _Inout_ std::string& key,
+        _In_ T value)
+{
+    SWSS_LOG_ENTER();
+
+    key.append((const char*)&value, sizeof(value));
+}
+
+template <typename T>
+static T readValue(
+        _In_ const std::string& key,
+        _Inout_ size_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    if (key.size() - offset < sizeof(T))
     {
-        if (it.second == attrKey)
-        {
-            return true;
-        }
+        SWSS_LOG_THROW("binary attr key is truncated");
     }
 
-    return false;
+    T value;
+
+    memcpy(&value, key.data() + offset, sizeof(T));
+
+    offset += sizeof(T);
+
+    return value;
 }
 
 std::string AttrKeyMap::constructKey(
@@ -60,15 +98,28 @@ std::string AttrKeyMap::constructKey(
 {
     SWSS_LOG_ENTER();
 
+    auto key = keyToString(constructBinaryKey(switchId, metaKey, attrCount, attrList));
+
+    SWSS_LOG_DEBUG("constructed key: %s", key.c_str());
+
+    return key;
+}
+
+std::string AttrKeyMap::constructBinaryKey(
+        _In_ sai_object_id_t switchId,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
     if (switchId == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_THROW("switchId is NULL for %s",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    // Use map to make sure that keys will be always sorted by attr id.
-
-    std::map<int32_t, std::string> keys;
+    std::vector<std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>> keys;
 
     for (uint32_t idx = 0; idx < attrCount; ++idx)
     {
@@ -83,14 +134,35 @@ std::string AttrKeyMap::constructKey(
                     attr.id);
         }
 
-        const auto& value = attr.value;
-
-        if (!SAI_HAS_FLAG_KEY(md->flags))
+        if (SAI_HAS_FLAG_KEY(md->flags))
         {
-            continue;
+            keys.emplace_back(md, &attr);
         }
+    }
+
+    // make sure that keys will be always sorted by attr id
 
-        std::string name = md->attridname + std::string(":");
+    std::sort(keys.begin(), keys.end(), [](
+                const std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>& a,
+                const std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>& b) {
+            return a.first->attrid < b.first->attrid; });
+
+    // switch ID is added, since same key pattern is allowed on different switch objects
+
+    std::string key;
+
+    key.reserve(sizeof(sai_object_id_t) + sizeof(int32_t) + keys.size() * (sizeof(sai_attr_id_t) + sizeof(sai_object_id_t)));
+
+    appendValue(key, switchId);
+    appendValue(key, (int32_t)metaKey.objecttype);
+
+    for (auto& k: keys)
+    {
+        auto* md = k.first;
+
+        const auto& value = k.second->value;
+
+        appendValue(key, md->attrid);
 
         switch (md->attrvaluetype)
         {
@@ -98,36 +170,30 @@ std::string AttrKeyMap::constructKey(
 
                 // NOTE: this list should be sorted
 
-                for (uint32_t i = 0; i < value.u32list.count; ++i)
-                {
-                    name += std::to_string(value.u32list.list[i]);
+                appendValue(key, value.u32list.count);
 
-                    if (i != value.u32list.count - 1)
-                    {
-                        name += ",";
-                    }
-                }
+                key.append((const char*)value.u32list.list, value.u32list.count * sizeof(uint32_t));
 
                 break;
 
             case SAI_ATTR_VALUE_TYPE_INT32:
-                name += std::to_string(value.s32); // if enum then get enum name?
+                appendValue(key, value.s32);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_UINT32:
-                name += std::to_string(value.u32);
+                appendValue(key, value.u32);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_UINT8:
-                name += std::to_string(value.u8);
+                appendValue(key, value.u8);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_UINT16:
-                name += std::to_string(value.u16);
+                appendValue(key, value.u16);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                name += sai_serialize_object_id(value.oid);
+                appendValue(key, value.oid);
                 break;
 
             default:
@@ -136,20 +202,84 @@ std::string AttrKeyMap::constructKey(
                 SWSS_LOG_THROW("FATAL: attribute %s marked as key, but have invalid serialization type, FIXME",
                         md->attridname);
         }
-
-        keys[md->attrid] = name;
     }
 
-    // switch ID is added, since same key pattern is allowed on different switch objects
+    return key;
+}
+
+std::string AttrKeyMap::keyToString(
+        _In_ const std::string& binaryKey)
+{
+    SWSS_LOG_ENTER();
+
+    size_t offset = 0;
+
+    auto switchId = readValue<sai_object_id_t>(binaryKey, offset);
+    auto objectType = (sai_object_type_t)readValue<int32_t>(binaryKey, offset);
 
     std::string key = sai_serialize_object_id(switchId) + ";";
 
-    for (auto& k: keys)
+    while (offset < binaryKey.size())
     {
-        key += k.second + ";";
-    }
+        auto attrId = readValue<sai_attr_id_t>(binaryKey, offset);
 
-    SWSS_LOG_DEBUG("constructed key: %s", key.c_str());
+        auto* md = sai_metadata_get_attr_metadata(objectType, attrId);
+
+        if (!md)
+        {
+            SWSS_LOG_THROW("failed to get metadata for object type: %s and attr id: %d",
+                    sai_serialize_object_type(objectType).c_str(),
+                    attrId);
+        }
+
+        key += md->attridname + std::string(":");
+
+        switch (md->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            {
+                auto count = readValue<uint32_t>(binaryKey, offset);
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    key += std::to_string(readValue<uint32_t>(binaryKey, offset));
+
+                    if (i != count - 1)
+                    {
+                        key += ",";
+                    }
+                }
+
+                break;
+            }
+
+            case SAI_ATTR_VALUE_TYPE_INT32:
+                key += std::to_string(readValue<int32_t>(binaryKey, offset));
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT32:
+                key += std::to_string(readValue<uint32_t>(binaryKey, offset));
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT8:
+                key += std::to_string(readValue<uint8_t>(binaryKey, offset));
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT16:
+                key += std::to_string(readValue<uint16_t>(binaryKey, offset));
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                key += sai_serialize_object_id(readValue<sai_object_id_t>(binaryKey, offset));
+                break;
+
+            default:
+                SWSS_LOG_THROW("FATAL: attribute %s marked as key, but have invalid serialization type, FIXME",
+                        md->attridname);
+        }
+
+        key += ";";
+    }
 
     return key;
 }
@@ -167,3 +297,10 @@ std::vector<std::string> AttrKeyMap::getAllKeys() const
 
     return vec;
 }
+
+std::unordered_map<std::string, std::string> AttrKeyMap::getAllAttrKeys() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_map; // copy
+}
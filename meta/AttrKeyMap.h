@@ -33,7 +33,10 @@ namespace saimeta
                     _In_ const std::string& metaKey);
 
             /**
-             * @brief Construct key based on attributes marked as keys.
+             * @brief Construct human readable key based on attributes marked as keys.
+             *
+             * Intended for logging and debugging, returns the same as
+             * keyToString(constructBinaryKey(...)).
              */
             static std::string constructKey(
                     _In_ sai_object_id_t switchId,
@@ -41,8 +44,33 @@ namespace saimeta
                     _In_ uint32_t attrCount,
                     _In_ const sai_attribute_t* attrList);
 
+            /**
+             * @brief Construct compact binary key based on attributes marked as keys.
+             *
+             * Key contains switch id, object type and then key attributes
+             * sorted by attr id, each as attr id followed by raw value (lists
+             * are prefixed with element count). All numbers are in host byte
+             * order.
+             */
+            static std::string constructBinaryKey(
+                    _In_ sai_object_id_t switchId,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t* attrList);
+
+            /**
+             * @brief Render binary key in human readable form.
+             */
+            static std::string keyToString(
+                    _In_ const std::string& binaryKey);
+
             std::vector<std::string> getAllKeys() const;
 
+            /**
+             * @brief Get copy of entire map, meta key to attributes key.
+             */
+            std::unordered_map<std::string, std::string> getAllAttrKeys() const;
+
         private:
 
             /**
@@ -57,5 +85,14 @@ namespace saimeta
              * could since we have local db, but this way is safer).
              */
             std::unordered_map<std::string, std::string> m_map;
+
+            /**
+             * @brief Reverse index of m_map.
+             *
+             * Key is constructed key from attributes, value is serialized
+             * meta key, used to check attribute key existence in constant
+             * time.
+             */
+            std::unordered_map<std::string, std::string> m_attrKeys;
     };
 }
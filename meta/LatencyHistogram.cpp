@@ -0,0 +1,290 @@
+#include "LatencyHistogram.h"
+
+#include "swss/logger.h"
+
+#include <functional>
+#include <sstream>
+#include <cmath>
+
+using namespace sairediscommon;
+
+LatencyHistogram::LatencyHistogram()
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+}
+
+unsigned int LatencyHistogram::bucketIndex(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return (unsigned int)value;
+    }
+
+    unsigned int msb = 63 - (unsigned int)__builtin_clzll(value);
+
+    unsigned int shift = msb - SUB_BUCKET_BITS;
+
+    unsigned int sub = (unsigned int)((value >> shift) & (SUB_BUCKET_COUNT - 1));
+
+    return (shift + 1) * SUB_BUCKET_COUNT + sub;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(
+        _In_ unsigned int index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    unsigned int shift = index / SUB_BUCKET_COUNT - 1;
+
+    uint64_t sub = index % SUB_BUCKET_COUNT;
+
+    return (SUB_BUCKET_COUNT + sub) << shift;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(
+        _In_ unsigned int index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    unsigned int shift = index / SUB_BUCKET_COUNT - 1;
+
+    return bucketLowerBound(index) + ((1ULL << shift) - 1);
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+
+    while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {
+        // max reloaded by compare_exchange_weak
+    }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    SWSS_LOG_ENTER();
+
+    Snapshot snapshot;
+
+    snapshot.count = m_count.load(std::memory_order_relaxed);
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.max = m_max.load(std::memory_order_relaxed);
+
+    snapshot.buckets.resize(BUCKET_COUNT);
+
+    for (unsigned int idx = 0; idx < BUCKET_COUNT; idx++)
+    {
+        snapshot.buckets[idx] = m_buckets[idx].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void LatencyHistogram::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 0;
+    m_sum = 0;
+    m_max = 0;
+
+    for (auto& bucket: m_buckets)
+    {
+        bucket = 0;
+    }
+}
+
+uint64_t LatencyHistogram::Snapshot::percentile(
+        _In_ double p) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t total = 0;
+
+    for (auto b: buckets)
+    {
+        total += b;
+    }
+
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    // rank of requested sample, 1 based
+
+    uint64_t rank = (uint64_t)std::ceil(p * (double)total);
+
+    rank = (rank == 0) ? 1 : ((rank > total) ? total : rank);
+
+    uint64_t seen = 0;
+
+    for (unsigned int idx = 0; idx < buckets.size(); idx++)
+    {
+        seen += buckets[idx];
+
+        if (seen >= rank)
+        {
+            uint64_t upper = LatencyHistogram::bucketUpperBound(idx);
+
+            return (max && upper > max) ? max : upper;
+        }
+    }
+
+    return max;
+}
+
+LatencyHistogramRegistry::Entry::Entry(
+        _In_ const std::string& _api,
+        _In_ sai_object_type_t _objectType,
+        _In_ sai_object_id_t _switchId):
+    api(_api),
+    objectType(_objectType),
+    switchId(_switchId)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::string LatencyHistogramRegistry::Entry::key() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    const char* ot = sai_metadata_get_object_type_name(objectType);
+
+    ss << api << "|" << (ot ? ot : "SAI_OBJECT_TYPE_NULL") << "|0x" << std::hex << switchId;
+
+    return ss.str();
+}
+
+LatencyHistogramRegistry::LatencyHistogramRegistry()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_slots)
+    {
+        slot = nullptr;
+    }
+}
+
+LatencyHistogramRegistry& LatencyHistogramRegistry::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    // never destroyed, static timers may still record during process exit
+
+    static LatencyHistogramRegistry* registry = new LatencyHistogramRegistry();
+
+    return *registry;
+}
+
+LatencyHistogram* LatencyHistogramRegistry::getHistogram(
+        _In_ const std::string& api,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    size_t hash = std::hash<std::string>()(api);
+
+    hash ^= std::hash<uint64_t>()(((uint64_t)objectType << 56) ^ switchId) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+
+    Entry* created = nullptr;
+
+    for (size_t probe = 0; probe < MAX_ENTRIES; probe++)
+    {
+        auto& slot = m_slots[(hash + probe) % MAX_ENTRIES];
+
+        Entry* entry = slot.load(std::memory_order_acquire);
+
+        if (entry == nullptr)
+        {
+            if (created == nullptr)
+            {
+                created = new Entry(api, objectType, switchId);
+            }
+
+            if (slot.compare_exchange_strong(entry, created, std::memory_order_acq_rel))
+            {
+                return &created->histogram;
+            }
+
+            // other thread won this slot, entry now holds its value
+        }
+
+        if (entry->objectType == objectType && entry->switchId == switchId && entry->api == api)
+        {
+            delete created;
+
+            return &entry->histogram;
+        }
+    }
+
+    delete created;
+
+    SWSS_LOG_WARN("latency histogram registry is full, %s not tracked", api.c_str());
+
+    return nullptr;
+}
+
+std::vector<const LatencyHistogramRegistry::Entry*> LatencyHistogramRegistry::getEntries() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const Entry*> entries;
+
+    for (auto& slot: m_slots)
+    {
+        const Entry* entry = slot.load(std::memory_order_acquire);
+
+        if (entry)
+        {
+            entries.push_back(entry);
+        }
+    }
+
+    return entries;
+}
+
+void LatencyHistogramRegistry::reset()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_slots)
+    {
+        Entry* entry = slot.load(std::memory_order_acquire);
+
+        if (entry)
+        {
+            entry->histogram.reset();
+        }
+    }
+}
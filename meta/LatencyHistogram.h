@@ -0,0 +1,159 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace sairediscommon
+{
+    /**
+     * @brief Lock free latency histogram.
+     *
+     * Uses log-linear buckets: each power of two range is split into
+     * SUB_BUCKET_COUNT linear sub buckets, so relative bucket error is
+     * bounded by 1/SUB_BUCKET_COUNT over the whole uint64_t range.
+     * Recording is a few relaxed atomic increments and can be done
+     * concurrently from any thread.
+     */
+    class LatencyHistogram
+    {
+        private:
+
+            LatencyHistogram(const LatencyHistogram&) = delete;
+            LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        public:
+
+            static constexpr unsigned int SUB_BUCKET_BITS = 3;
+
+            static constexpr unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+            static constexpr unsigned int BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        public:
+
+            /**
+             * @brief Histogram snapshot, not synchronized with concurrent
+             * recording, but each field is consistent on its own.
+             */
+            struct Snapshot
+            {
+                uint64_t count;
+
+                uint64_t sum;
+
+                uint64_t max;
+
+                std::vector<uint64_t> buckets;
+
+                uint64_t percentile(
+                        _In_ double p) const;
+            };
+
+        public:
+
+            LatencyHistogram();
+
+            ~LatencyHistogram() = default; // non virtual
+
+        public:
+
+            void record(
+                    _In_ uint64_t value);
+
+            Snapshot snapshot() const;
+
+            void reset();
+
+        public:
+
+            static unsigned int bucketIndex(
+                    _In_ uint64_t value);
+
+            static uint64_t bucketLowerBound(
+                    _In_ unsigned int index);
+
+            static uint64_t bucketUpperBound(
+                    _In_ unsigned int index);
+
+        private:
+
+            std::atomic<uint64_t> m_count;
+
+            std::atomic<uint64_t> m_sum;
+
+            std::atomic<uint64_t> m_max;
+
+            std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+    };
+
+    /**
+     * @brief Process wide registry of latency histograms.
+     *
+     * Histograms are keyed by API name, object type and switch ID. Lookup
+     * and insert are lock free (open addressing with CAS on slot), entries
+     * are never removed, so returned pointers stay valid for process
+     * lifetime.
+     */
+    class LatencyHistogramRegistry
+    {
+        private:
+
+            LatencyHistogramRegistry();
+
+            LatencyHistogramRegistry(const LatencyHistogramRegistry&) = delete;
+            LatencyHistogramRegistry& operator=(const LatencyHistogramRegistry&) = delete;
+
+        public:
+
+            static constexpr size_t MAX_ENTRIES = 4096;
+
+            struct Entry
+            {
+                Entry(
+                        _In_ const std::string& api,
+                        _In_ sai_object_type_t objectType,
+                        _In_ sai_object_id_t switchId);
+
+                const std::string api;
+
+                const sai_object_type_t objectType;
+
+                const sai_object_id_t switchId;
+
+                LatencyHistogram histogram;
+
+                std::string key() const;
+            };
+
+        public:
+
+            static LatencyHistogramRegistry& getInstance();
+
+        public:
+
+            /**
+             * @brief Get or create histogram.
+             *
+             * @return Histogram or nullptr when registry is full.
+             */
+            LatencyHistogram* getHistogram(
+                    _In_ const std::string& api,
+                    _In_ sai_object_type_t objectType = SAI_OBJECT_TYPE_NULL,
+                    _In_ sai_object_id_t switchId = SAI_NULL_OBJECT_ID);
+
+            std::vector<const Entry*> getEntries() const;
+
+            void reset();
+
+        private:
+
+            std::atomic<Entry*> m_slots[MAX_ENTRIES];
+    };
+}
@@ -0,0 +1,323 @@
+#include "LatencyHistogramExporter.h"
+
+#include "swss/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace sairediscommon;
+
+using json = nlohmann::json;
+
+constexpr const char* LatencyHistogramExporter::TABLE_NAME;
+
+LatencyHistogramExporter::LatencyHistogramExporter(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ std::chrono::seconds interval):
+    m_db(db),
+    m_interval(interval),
+    m_run(false)
+{
+    SWSS_LOG_ENTER();
+
+    m_table = std::make_shared<swss::Table>(m_db.get(), TABLE_NAME);
+}
+
+LatencyHistogramExporter::LatencyHistogramExporter(
+        _In_ const std::string& fileName,
+        _In_ std::chrono::seconds interval):
+    m_fileName(fileName),
+    m_interval(interval),
+    m_run(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+LatencyHistogramExporter::~LatencyHistogramExporter()
+{
+    SWSS_LOG_ENTER();
+
+    stop();
+}
+
+void LatencyHistogramExporter::start()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_thread)
+    {
+        SWSS_LOG_WARN("latency histogram exporter already started");
+        return;
+    }
+
+    m_run = true;
+
+    m_thread = std::make_shared<std::thread>(&LatencyHistogramExporter::threadFunction, this);
+
+    SWSS_LOG_NOTICE("latency histogram exporter started, interval %ld sec", (long)m_interval.count());
+}
+
+void LatencyHistogramExporter::stop()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_thread)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_cv.notify_all();
+
+    m_thread->join();
+
+    m_thread = nullptr;
+
+    exportOnce(); // final export, so short runs are not lost
+}
+
+void LatencyHistogramExporter::threadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_run)
+    {
+        if (m_cv.wait_for(lock, m_interval, [this]{ return !m_run; }))
+        {
+            break;
+        }
+
+        lock.unlock();
+
+        exportOnce();
+
+        lock.lock();
+    }
+}
+
+bool LatencyHistogramExporter::exportOnce()
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, std::vector<swss::FieldValueTuple>> histograms;
+
+    for (auto* entry: LatencyHistogramRegistry::getInstance().getEntries())
+    {
+        auto snapshot = entry->histogram.snapshot();
+
+        if (snapshot.count == 0)
+        {
+            continue;
+        }
+
+        histograms[entry->key()] = serialize(snapshot);
+    }
+
+    if (m_table)
+    {
+        for (auto& kvp: histograms)
+        {
+            m_table->set(kvp.first, kvp.second);
+        }
+
+        return true;
+    }
+
+    return exportToFile(histograms);
+}
+
+bool LatencyHistogramExporter::exportToFile(
+        _In_ const std::map<std::string, std::vector<swss::FieldValueTuple>>& histograms)
+{
+    SWSS_LOG_ENTER();
+
+    json j = json::object();
+
+    for (auto& kvp: histograms)
+    {
+        json fields = json::object();
+
+        for (auto& fv: kvp.second)
+        {
+            fields[fvField(fv)] = fvValue(fv);
+        }
+
+        j[kvp.first] = fields;
+    }
+
+    std::string tmp = m_fileName + ".tmp";
+
+    std::ofstream ofs(tmp);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s for writing", tmp.c_str());
+        return false;
+    }
+
+    ofs << j.dump(4) << std::endl;
+
+    ofs.close();
+
+    if (std::rename(tmp.c_str(), m_fileName.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s", tmp.c_str(), m_fileName.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<swss::FieldValueTuple> LatencyHistogramExporter::serialize(
+        _In_ const LatencyHistogram::Snapshot& snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("count", std::to_string(snapshot.count));
+    values.emplace_back("sum", std::to_string(snapshot.sum));
+    values.emplace_back("max", std::to_string(snapshot.max));
+    values.emplace_back("p50", std::to_string(snapshot.percentile(0.5)));
+    values.emplace_back("p99", std::to_string(snapshot.percentile(0.99)));
+    values.emplace_back("p999", std::to_string(snapshot.percentile(0.999)));
+
+    // sparse bucket list "index:count,index:count"
+
+    std::stringstream ss;
+
+    const char* sep = "";
+
+    for (size_t idx = 0; idx < snapshot.buckets.size(); idx++)
+    {
+        if (snapshot.buckets[idx])
+        {
+            ss << sep << idx << ":" << snapshot.buckets[idx];
+
+            sep = ",";
+        }
+    }
+
+    values.emplace_back("buckets", ss.str());
+
+    return values;
+}
+
+bool LatencyHistogramExporter::deserialize(
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _Out_ LatencyHistogram::Snapshot& snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    snapshot.count = 0;
+    snapshot.sum = 0;
+    snapshot.max = 0;
+    snapshot.buckets.assign(LatencyHistogram::BUCKET_COUNT, 0);
+
+    try
+    {
+        for (auto& fv: values)
+        {
+            auto& field = fvField(fv);
+            auto& value = fvValue(fv);
+
+            if (field == "count")
+            {
+                snapshot.count = std::stoull(value);
+            }
+            else if (field == "sum")
+            {
+                snapshot.sum = std::stoull(value);
+            }
+            else if (field == "max")
+            {
+                snapshot.max = std::stoull(value);
+            }
+            else if (field == "buckets")
+            {
+                std::stringstream ss(value);
+
+                std::string item;
+
+                while (std::getline(ss, item, ','))
+                {
+                    auto pos = item.find(':');
+
+                    if (pos == std::string::npos)
+                    {
+                        SWSS_LOG_ERROR("invalid bucket '%s'", item.c_str());
+                        return false;
+                    }
+
+                    size_t idx = std::stoul(item.substr(0, pos));
+
+                    if (idx >= snapshot.buckets.size())
+                    {
+                        SWSS_LOG_ERROR("bucket index %zu out of range", idx);
+                        return false;
+                    }
+
+                    snapshot.buckets[idx] = std::stoull(item.substr(pos + 1));
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to deserialize histogram: %s", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool LatencyHistogramExporter::readFile(
+        _In_ const std::string& fileName,
+        _Out_ std::map<std::string, std::vector<swss::FieldValueTuple>>& histograms)
+{
+    SWSS_LOG_ENTER();
+
+    histograms.clear();
+
+    std::ifstream ifs(fileName);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", fileName.c_str());
+        return false;
+    }
+
+    try
+    {
+        json j = json::parse(ifs);
+
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            auto& values = histograms[it.key()];
+
+            for (auto f = it.value().begin(); f != it.value().end(); ++f)
+            {
+                values.emplace_back(f.key(), f.value().get<std::string>());
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to parse %s: %s", fileName.c_str(), e.what());
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "LatencyHistogram.h"
+
+#include "swss/sal.h"
+#include "swss/table.h"
+#include "swss/dbconnector.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sairediscommon
+{
+    /**
+     * @brief Periodic exporter of LatencyHistogramRegistry.
+     *
+     * Each histogram is written as single hash with count, sum, max,
+     * p50, p99, p999 (all in nanoseconds) and sparse bucket list, either
+     * into redis table or into JSON file which is replaced atomically on
+     * each export.
+     */
+    class LatencyHistogramExporter
+    {
+        private:
+
+            LatencyHistogramExporter(const LatencyHistogramExporter&) = delete;
+            LatencyHistogramExporter& operator=(const LatencyHistogramExporter&) = delete;
+
+        public:
+
+            static constexpr const char* TABLE_NAME = "LATENCY_HISTOGRAM";
+
+        public:
+
+            /**
+             * @brief Export to redis table TABLE_NAME in given database.
+             */
+            LatencyHistogramExporter(
+                    _In_ std::shared_ptr<swss::DBConnector> db,
+                    _In_ std::chrono::seconds interval);
+
+            /**
+             * @brief Export to local JSON file.
+             */
+            LatencyHistogramExporter(
+                    _In_ const std::string& fileName,
+                    _In_ std::chrono::seconds interval);
+
+            virtual ~LatencyHistogramExporter();
+
+        public:
+
+            void start();
+
+            void stop();
+
+            bool exportOnce();
+
+        public:
+
+            static std::vector<swss::FieldValueTuple> serialize(
+                    _In_ const LatencyHistogram::Snapshot& snapshot);
+
+            static bool deserialize(
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _Out_ LatencyHistogram::Snapshot& snapshot);
+
+            static bool readFile(
+                    _In_ const std::string& fileName,
+                    _Out_ std::map<std::string, std::vector<swss::FieldValueTuple>>& histograms);
+
+        private:
+
+            void threadFunction();
+
+            bool exportToFile(
+                    _In_ const std::map<std::string, std::vector<swss::FieldValueTuple>>& histograms);
+
+        private:
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::shared_ptr<swss::Table> m_table;
+
+            std::string m_fileName;
+
+            std::chrono::seconds m_interval;
+
+            bool m_run;
+
+            std::shared_ptr<std::thread> m_thread;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+    };
+}
@@ -5,6 +5,7 @@
 
 #include "Globals.h"
 #include "SaiAttributeList.h"
+#include "MetaSnapshot.h"
 
 #include <inttypes.h>
 
@@ -3997,12 +3998,12 @@ sai_status_t Meta::meta_generic_validation_create(
 
     if (haskeys)
     {
-        std::string key = AttrKeyMap::constructKey(switch_id, meta_key, attr_count, attr_list);
+        std::string key = AttrKeyMap::constructBinaryKey(switch_id, meta_key, attr_count, attr_list);
 
         // since we didn't created oid yet, we don't know if attribute key exists, check all
         if (m_attrKeys.attrKeyExists(key))
         {
-            SWSS_LOG_ERROR("attribute key %s already exists, can't create", key.c_str());
+            SWSS_LOG_ERROR("attribute key %s already exists, can't create", AttrKeyMap::keyToString(key).c_str());
 
             return SAI_STATUS_INVALID_PARAMETER;
         }
@@ -5942,7 +5943,7 @@ void Meta::meta_generic_validation_post_create(
     {
         auto mKey = sai_serialize_object_meta_key(meta_key);
 
-        auto attrKey = AttrKeyMap::constructKey(switch_id, meta_key, attr_count, attr_list);
+        auto attrKey = AttrKeyMap::constructBinaryKey(switch_id, meta_key, attr_count, attr_list);
 
         m_attrKeys.insert(mKey, attrKey);
     }
@@ -7375,6 +7376,63 @@ bool Meta::objectExists(
     return m_saiObjectCollection.objectExists(mk);
 }
 
+bool Meta::saveSnapshot(
+        _In_ const std::string& fileName,
+        _In_ uint64_t generation) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> switches;
+
+    for (auto& mk: m_saiObjectCollection.getAllKeys())
+    {
+        if (mk.objecttype == SAI_OBJECT_TYPE_SWITCH)
+        {
+            switches.push_back(mk.objectkey.key.object_id);
+        }
+    }
+
+    if (switches.size() != 1)
+    {
+        SWSS_LOG_WARN("snapshot requires exactly one switch, have %zu, skipping", switches.size());
+
+        return false;
+    }
+
+    return MetaSnapshot::save(
+            fileName,
+            generation,
+            switches.at(0),
+            m_saiObjectCollection,
+            m_oids,
+            m_attrKeys,
+            m_portRelatedSet);
+}
+
+bool Meta::loadSnapshot(
+        _In_ const std::string& fileName,
+        _In_ uint64_t generation,
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isEmpty())
+    {
+        SWSS_LOG_ERROR("meta database is not empty, can't load snapshot");
+
+        return false;
+    }
+
+    return MetaSnapshot::load(
+            fileName,
+            generation,
+            switchId,
+            m_saiObjectCollection,
+            m_oids,
+            m_attrKeys,
+            m_portRelatedSet);
+}
+
 void Meta::populate(
         _In_ const swss::TableDump& dump)
 {
@@ -7530,7 +7588,7 @@ void Meta::populate(
 
             auto switchId = switchIdQuery(mk.objectkey.key.object_id);
 
-            auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+            auto attrKey = AttrKeyMap::constructBinaryKey(switchId, mk, attr_count, attr_list);
 
             m_attrKeys.insert(mKey, attrKey);
         }
@@ -643,6 +643,28 @@ namespace saimeta
             void populate(
                     _In_ const swss::TableDump& dump);
 
+            /**
+             * @brief Save database snapshot to file, see MetaSnapshot.
+             *
+             * Database must contain exactly one switch.
+             */
+            bool saveSnapshot(
+                    _In_ const std::string& fileName,
+                    _In_ uint64_t generation) const;
+
+            /**
+             * @brief Load database snapshot from file.
+             *
+             * Can be used instead of populate when connecting to existing
+             * switch. Database must be empty.
+             *
+             * @return False if snapshot is missing or stale.
+             */
+            bool loadSnapshot(
+                    _In_ const std::string& fileName,
+                    _In_ uint64_t generation,
+                    _In_ sai_object_id_t switchId);
+
         private:
 
             void clean_after_switch_remove(
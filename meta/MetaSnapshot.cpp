@@ -0,0 +1,436 @@
+#include "MetaSnapshot.h"
+
+#include "swss/logger.h"
+
+#include "sai_serialize.h"
+
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include <cinttypes>
+#include <fstream>
+
+using namespace saimeta;
+
+constexpr uint32_t MetaSnapshot::MAGIC;
+constexpr uint32_t MetaSnapshot::VERSION;
+
+template <typename T>
+static void snapshotWrite(
+        _Inout_ std::string& buffer,
+        _In_ const T& value)
+{
+    SWSS_LOG_ENTER();
+
+    buffer.append((const char*)&value, sizeof(T));
+}
+
+static void snapshotWriteString(
+        _Inout_ std::string& buffer,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    snapshotWrite(buffer, (uint32_t)value.size());
+
+    buffer.append(value);
+}
+
+template <typename T>
+static void snapshotRead(
+        _In_ const std::vector<char>& buffer,
+        _Inout_ size_t& offset,
+        _Out_ T& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (buffer.size() - offset < sizeof(T))
+    {
+        SWSS_LOG_THROW("snapshot truncated at offset %zu", offset);
+    }
+
+    memcpy(&value, buffer.data() + offset, sizeof(T));
+
+    offset += sizeof(T);
+}
+
+static std::string snapshotReadString(
+        _In_ const std::vector<char>& buffer,
+        _Inout_ size_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t length;
+
+    snapshotRead(buffer, offset, length);
+
+    if (buffer.size() - offset < length)
+    {
+        SWSS_LOG_THROW("snapshot truncated at offset %zu", offset);
+    }
+
+    std::string value(buffer.data() + offset, length);
+
+    offset += length;
+
+    return value;
+}
+
+bool MetaSnapshot::save(
+        _In_ const std::string& fileName,
+        _In_ uint64_t generation,
+        _In_ sai_object_id_t switchId,
+        _In_ const SaiObjectCollection& objects,
+        _In_ const OidRefCounter& references,
+        _In_ const AttrKeyMap& attrKeys,
+        _In_ const PortRelatedSet& portRelatedSet)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("meta snapshot save");
+
+    MetaSnapshotHeader header;
+
+    memset(&header, 0, sizeof(header));
+
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.saiApiVersion = SAI_API_VERSION;
+    header.metaKeySize = (uint32_t)sizeof(sai_object_meta_key_t);
+    header.attrValueSize = (uint32_t)sizeof(sai_attribute_value_t);
+    header.generation = generation;
+    header.switchId = switchId;
+
+    std::string buffer;
+
+    snapshotWrite(buffer, header); // updated when all counts are known
+
+    for (auto& mk: objects.getAllKeys())
+    {
+        auto attrs = objects.getObjectAttributes(mk);
+
+        snapshotWrite(buffer, mk);
+        snapshotWrite(buffer, (uint32_t)attrs.size());
+
+        for (auto& attr: attrs)
+        {
+            auto md = attr->getSaiAttrMetadata();
+
+            snapshotWrite(buffer, (uint32_t)md->attrid);
+            snapshotWrite(buffer, (uint8_t)md->isprimitive);
+
+            if (md->isprimitive)
+            {
+                snapshotWrite(buffer, attr->getSaiAttr()->value);
+            }
+            else
+            {
+                snapshotWriteString(buffer, sai_serialize_attr_value(*md, *attr->getSaiAttr(), false));
+            }
+        }
+
+        header.objectCount++;
+    }
+
+    for (auto& kvp: references.getAllReferences())
+    {
+        snapshotWrite(buffer, kvp.first);
+        snapshotWrite(buffer, kvp.second);
+
+        header.referenceCount++;
+    }
+
+    for (auto& kvp: attrKeys.getAllAttrKeys())
+    {
+        snapshotWriteString(buffer, kvp.first);
+        snapshotWriteString(buffer, kvp.second);
+
+        header.attrKeyCount++;
+    }
+
+    for (auto port: portRelatedSet.getAllPorts())
+    {
+        auto related = portRelatedSet.getPortRelatedObjects(port);
+
+        snapshotWrite(buffer, port);
+        snapshotWrite(buffer, (uint32_t)related.size());
+
+        for (auto oid: related)
+        {
+            snapshotWrite(buffer, oid);
+        }
+
+        header.portCount++;
+    }
+
+    header.size = buffer.size();
+
+    memcpy(&buffer[0], &header, sizeof(header));
+
+    // write to temporary file first, so snapshot is never seen half written
+
+    std::string tmp = fileName + ".tmp";
+
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", tmp.c_str());
+        return false;
+    }
+
+    ofs.write(buffer.data(), (std::streamsize)buffer.size());
+
+    ofs.close();
+
+    if (!ofs)
+    {
+        SWSS_LOG_ERROR("failed to write %s", tmp.c_str());
+
+        unlink(tmp.c_str());
+        return false;
+    }
+
+    if (rename(tmp.c_str(), fileName.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s: %s", tmp.c_str(), fileName.c_str(), strerror(errno));
+
+        unlink(tmp.c_str());
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("saved meta snapshot %s generation %" PRIu64 ": %" PRIu64 " objects, %" PRIu64 " references, %zu bytes",
+            fileName.c_str(),
+            generation,
+            header.objectCount,
+            header.referenceCount,
+            buffer.size());
+
+    return true;
+}
+
+bool MetaSnapshot::readFile(
+        _In_ const std::string& fileName,
+        _Out_ std::vector<char>& buffer)
+{
+    SWSS_LOG_ENTER();
+
+    buffer.clear();
+
+    std::ifstream ifs(fileName, std::ios::binary | std::ios::ate);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_NOTICE("meta snapshot %s not found", fileName.c_str());
+        return false;
+    }
+
+    auto size = ifs.tellg();
+
+    if (size < (std::streamoff)sizeof(MetaSnapshotHeader))
+    {
+        SWSS_LOG_ERROR("meta snapshot %s is too small", fileName.c_str());
+        return false;
+    }
+
+    buffer.resize((size_t)size);
+
+    ifs.seekg(0);
+
+    if (!ifs.read(buffer.data(), size))
+    {
+        SWSS_LOG_ERROR("failed to read meta snapshot %s", fileName.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool MetaSnapshot::load(
+        _In_ const std::string& fileName,
+        _In_ uint64_t generation,
+        _In_ sai_object_id_t switchId,
+        _Inout_ SaiObjectCollection& objects,
+        _Inout_ OidRefCounter& references,
+        _Inout_ AttrKeyMap& attrKeys,
+        _Inout_ PortRelatedSet& portRelatedSet)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("meta snapshot load");
+
+    std::vector<char> buffer;
+
+    if (!readFile(fileName, buffer))
+    {
+        return false;
+    }
+
+    MetaSnapshotHeader header;
+
+    memcpy(&header, buffer.data(), sizeof(header));
+
+    if (header.magic != MAGIC ||
+            header.version != VERSION ||
+            header.size != buffer.size())
+    {
+        SWSS_LOG_ERROR("file %s is not valid meta snapshot", fileName.c_str());
+        return false;
+    }
+
+    if (header.saiApiVersion != SAI_API_VERSION ||
+            header.metaKeySize != sizeof(sai_object_meta_key_t) ||
+            header.attrValueSize != sizeof(sai_attribute_value_t))
+    {
+        SWSS_LOG_WARN("meta snapshot %s was taken with different SAI headers", fileName.c_str());
+        return false;
+    }
+
+    if (header.generation != generation || header.switchId != switchId)
+    {
+        SWSS_LOG_WARN("meta snapshot %s is stale: generation %" PRIu64 " switch %s, expected generation %" PRIu64 " switch %s",
+                fileName.c_str(),
+                header.generation,
+                sai_serialize_object_id(header.switchId).c_str(),
+                generation,
+                sai_serialize_object_id(switchId).c_str());
+        return false;
+    }
+
+    try
+    {
+        loadBuffer(buffer, objects, references, attrKeys, portRelatedSet);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to load meta snapshot %s: %s", fileName.c_str(), e.what());
+
+        objects.clear();
+        references.clear();
+        attrKeys.clear();
+        portRelatedSet.clear();
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("loaded meta snapshot %s generation %" PRIu64 ": %" PRIu64 " objects, %" PRIu64 " references",
+            fileName.c_str(),
+            generation,
+            header.objectCount,
+            header.referenceCount);
+
+    return true;
+}
+
+void MetaSnapshot::loadBuffer(
+        _In_ const std::vector<char>& buffer,
+        _Inout_ SaiObjectCollection& objects,
+        _Inout_ OidRefCounter& references,
+        _Inout_ AttrKeyMap& attrKeys,
+        _Inout_ PortRelatedSet& portRelatedSet)
+{
+    SWSS_LOG_ENTER();
+
+    size_t offset = 0;
+
+    MetaSnapshotHeader header;
+
+    snapshotRead(buffer, offset, header);
+
+    for (uint64_t i = 0; i < header.objectCount; i++)
+    {
+        sai_object_meta_key_t mk;
+
+        snapshotRead(buffer, offset, mk);
+
+        if (!sai_metadata_is_object_type_valid(mk.objecttype))
+        {
+            SWSS_LOG_THROW("invalid object type %d", mk.objecttype);
+        }
+
+        objects.createObject(mk);
+
+        auto obj = objects.getObject(mk);
+
+        uint32_t attrCount;
+
+        snapshotRead(buffer, offset, attrCount);
+
+        for (uint32_t j = 0; j < attrCount; j++)
+        {
+            uint32_t attrId;
+            uint8_t primitive;
+
+            snapshotRead(buffer, offset, attrId);
+            snapshotRead(buffer, offset, primitive);
+
+            auto md = sai_metadata_get_attr_metadata(mk.objecttype, attrId);
+
+            if (md == nullptr || md->isprimitive != (primitive != 0))
+            {
+                SWSS_LOG_THROW("invalid attribute 0x%x on %s",
+                        attrId,
+                        sai_serialize_object_type(mk.objecttype).c_str());
+            }
+
+            if (primitive)
+            {
+                sai_attribute_t attr;
+
+                attr.id = attrId;
+
+                snapshotRead(buffer, offset, attr.value);
+
+                obj->setAttr(std::make_shared<SaiAttrWrapper>(md, attr));
+            }
+            else
+            {
+                obj->setAttr(std::make_shared<SaiAttrWrapper>(md, snapshotReadString(buffer, offset)));
+            }
+        }
+    }
+
+    for (uint64_t i = 0; i < header.referenceCount; i++)
+    {
+        sai_object_id_t oid;
+        int32_t count;
+
+        snapshotRead(buffer, offset, oid);
+        snapshotRead(buffer, offset, count);
+
+        references.objectReferenceInsert(oid, count);
+    }
+
+    for (uint64_t i = 0; i < header.attrKeyCount; i++)
+    {
+        auto metaKey = snapshotReadString(buffer, offset);
+        auto attrKey = snapshotReadString(buffer, offset);
+
+        attrKeys.insert(metaKey, attrKey);
+    }
+
+    for (uint64_t i = 0; i < header.portCount; i++)
+    {
+        sai_object_id_t port;
+        uint32_t count;
+
+        snapshotRead(buffer, offset, port);
+        snapshotRead(buffer, offset, count);
+
+        for (uint32_t j = 0; j < count; j++)
+        {
+            sai_object_id_t oid;
+
+            snapshotRead(buffer, offset, oid);
+
+            portRelatedSet.insert(port, oid);
+        }
+    }
+
+    if (offset != buffer.size())
+    {
+        SWSS_LOG_THROW("unexpected %zu bytes at end of snapshot", buffer.size() - offset);
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "SaiObjectCollection.h"
+#include "OidRefCounter.h"
+#include "AttrKeyMap.h"
+#include "PortRelatedSet.h"
+
+#include <string>
+#include <vector>
+
+namespace saimeta
+{
+    /**
+     * @brief Meta snapshot header.
+     *
+     * File layout:
+     *
+     *   MetaSnapshotHeader
+     *   objects     - meta key, attr count, attributes (id, primitive flag,
+     *                 raw value or serialized value of list attribute)
+     *   references  - oid, reference count
+     *   attr keys   - meta key, attributes key
+     *   ports       - port oid, related objects count, related objects
+     *
+     * Snapshot is valid only for the same generation and the same SAI
+     * headers, since values are stored in raw form.
+     */
+    struct MetaSnapshotHeader
+    {
+        uint32_t magic;
+
+        uint32_t version;
+
+        uint64_t saiApiVersion;
+
+        uint32_t metaKeySize;
+
+        uint32_t attrValueSize;
+
+        uint64_t generation;
+
+        sai_object_id_t switchId;
+
+        uint64_t objectCount;
+
+        uint64_t referenceCount;
+
+        uint64_t attrKeyCount;
+
+        uint64_t portCount;
+
+        uint64_t size;
+    };
+
+    /**
+     * @brief Meta snapshot.
+     *
+     * Saves and restores meta database in compact binary form, so metadata
+     * after restart can be loaded with single sequential read, instead of
+     * being rebuilt from ASIC view dump.
+     */
+    class MetaSnapshot
+    {
+        private:
+
+            MetaSnapshot() = delete;
+
+        public:
+
+            static constexpr uint32_t MAGIC = 0x504e534d; // "MSNP"
+
+            static constexpr uint32_t VERSION = 1;
+
+        public:
+
+            static bool save(
+                    _In_ const std::string& fileName,
+                    _In_ uint64_t generation,
+                    _In_ sai_object_id_t switchId,
+                    _In_ const SaiObjectCollection& objects,
+                    _In_ const OidRefCounter& references,
+                    _In_ const AttrKeyMap& attrKeys,
+                    _In_ const PortRelatedSet& portRelatedSet);
+
+            /**
+             * @brief Load snapshot into empty database.
+             *
+             * @return False if snapshot can't be read, or it was taken for
+             * different generation, switch or SAI headers. Database is
+             * left empty in that case.
+             */
+            static bool load(
+                    _In_ const std::string& fileName,
+                    _In_ uint64_t generation,
+                    _In_ sai_object_id_t switchId,
+                    _Inout_ SaiObjectCollection& objects,
+                    _Inout_ OidRefCounter& references,
+                    _Inout_ AttrKeyMap& attrKeys,
+                    _Inout_ PortRelatedSet& portRelatedSet);
+
+        private:
+
+            static bool readFile(
+                    _In_ const std::string& fileName,
+                    _Out_ std::vector<char>& buffer);
+
+            static void loadBuffer(
+                    _In_ const std::vector<char>& buffer,
+                    _Inout_ SaiObjectCollection& objects,
+                    _Inout_ OidRefCounter& references,
+                    _Inout_ AttrKeyMap& attrKeys,
+                    _Inout_ PortRelatedSet& portRelatedSet);
+    };
+}
@@ -109,6 +109,25 @@ void OidRefCounter::objectReferenceInsert(
     SWSS_LOG_DEBUG("inserted reference on 0x%" PRIx64 "", oid);
 }
 
+void OidRefCounter::objectReferenceInsert(
+        _In_ sai_object_id_t oid,
+        _In_ int32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (count < 0)
+    {
+        SWSS_LOG_THROW("FATAL: negative reference count %d on object oid 0x%" PRIx64 "", count, oid);
+    }
+
+    if (objectReferenceExists(oid))
+    {
+        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " already in reference map", oid);
+    }
+
+    m_hash[oid] = count;
+}
+
 void OidRefCounter::objectReferenceRemove(
         _In_ sai_object_id_t oid)
 {
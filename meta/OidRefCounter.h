@@ -63,6 +63,16 @@ namespace saimeta
             void objectReferenceInsert(
                     _In_ sai_object_id_t oid);
 
+            /**
+             * @brief Insert object reference with given reference count.
+             *
+             * Used when restoring references from snapshot. Throws if object
+             * reference already exists or count is negative.
+             */
+            void objectReferenceInsert(
+                    _In_ sai_object_id_t oid,
+                    _In_ int32_t count);
+
             /**
              * @brief Remove object reference.
              *
@@ -16,6 +16,8 @@ PerformanceIntervalTimer::PerformanceIntervalTimer(
 {
     SWSS_LOG_ENTER();
 
+    m_histogram = LatencyHistogramRegistry::getInstance().getHistogram(m_msg);
+
     reset();
 }
 
@@ -42,7 +44,14 @@ void PerformanceIntervalTimer::inc(
 
     m_calls++;
 
-    m_total += std::chrono::duration_cast<std::chrono::nanoseconds>(m_stop-m_start).count();
+    uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(m_stop-m_start).count();
+
+    m_total += duration;
+
+    if (m_histogram)
+    {
+        m_histogram->record(duration);
+    }
 
     if (m_count >= m_limit)
     {
@@ -55,6 +64,30 @@ void PerformanceIntervalTimer::inc(
     }
 }
 
+void PerformanceIntervalTimer::inc(
+        _In_ uint64_t val,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = std::make_pair(objectType, switchId);
+
+    auto it = m_histograms.find(key);
+
+    if (it == m_histograms.end())
+    {
+        it = m_histograms.emplace(key, LatencyHistogramRegistry::getInstance().getHistogram(m_msg, objectType, switchId)).first;
+    }
+
+    if (it->second)
+    {
+        it->second->record(std::chrono::duration_cast<std::chrono::nanoseconds>(m_stop-m_start).count());
+    }
+
+    inc(val);
+}
+
 void PerformanceIntervalTimer::reset()
 {
     SWSS_LOG_ENTER();
@@ -1,12 +1,22 @@
 #pragma once
 
+#include "LatencyHistogram.h"
+
 #include "swss/sal.h"
 
 #include <chrono>
 #include <string>
+#include <map>
 
 namespace sairediscommon
 {
+    /**
+     * @brief Interval timer.
+     *
+     * Each inc() records duration of last start/stop interval into latency
+     * histogram named after timer message in LatencyHistogramRegistry,
+     * optionally also into histogram of given object type and switch.
+     */
     class PerformanceIntervalTimer
     {
         public:
@@ -30,6 +40,11 @@ namespace sairediscommon
             void inc(
                     _In_ uint64_t val = 1);
 
+            void inc(
+                    _In_ uint64_t val,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t switchId = SAI_NULL_OBJECT_ID);
+
             void reset();
 
         public:
@@ -47,5 +62,9 @@ namespace sairediscommon
             uint64_t m_count;
             uint64_t m_calls;
             uint64_t m_total;
+
+            LatencyHistogram* m_histogram;
+
+            std::map<std::pair<sai_object_type_t, sai_object_id_t>, LatencyHistogram*> m_histograms;
     };
 }
@@ -1,5 +1,7 @@
 #include "RedisSelectableChannel.h"
 
+#include "sairediscommon.h"
+
 #include "swss/logger.h"
 
 using namespace sairedis;
@@ -45,7 +47,23 @@ void RedisSelectableChannel::set(
 {
     SWSS_LOG_ENTER();
 
-    m_getResponse->set(key, values, op);
+    if (m_requestId.empty())
+    {
+        m_getResponse->set(key, values, op);
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(values.size() + 1);
+
+    entry.insert(entry.end(), values.begin(), values.end());
+
+    entry.emplace_back(REDIS_FIELD_REQUEST_ID, m_requestId);
+
+    m_requestId.clear();
+
+    m_getResponse->set(key, entry, op);
 }
 
 void RedisSelectableChannel::pop(
@@ -62,6 +80,19 @@ void RedisSelectableChannel::pop(
     {
         m_asicState->pop(kco);
     }
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() && fvField(values.back()) == REDIS_FIELD_REQUEST_ID)
+    {
+        m_requestId = fvValue(values.back());
+
+        values.pop_back();
+    }
+    else
+    {
+        m_requestId.clear();
+    }
 }
 
 // Selectable overrides
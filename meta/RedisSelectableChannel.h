@@ -61,5 +61,13 @@ namespace sairedis
             std::string m_tempPrefix;
 
             bool m_modifyRedis;
+
+            /**
+             * @brief Request id of last popped request.
+             *
+             * Removed from request values and appended to response, so
+             * client can match response with its request.
+             */
+            std::string m_requestId;
     };
 }
@@ -4,6 +4,8 @@
 
 #include "sai_serialize.h"
 
+#include <string.h>
+
 using namespace saimeta;
 
 SaiAttrWrapper::SaiAttrWrapper(
@@ -21,6 +23,13 @@ SaiAttrWrapper::SaiAttrWrapper(
 
     m_attr.id = attr.id;
 
+    if (meta->isprimitive)
+    {
+        // no lists or pointers to allocate, copy is enough
+
+        return;
+    }
+
     /*
      * We are making serialize and deserialize to get copy of attribute, it may
      * be a list so we need to allocate new memory.
@@ -35,6 +44,25 @@ SaiAttrWrapper::SaiAttrWrapper(
     sai_deserialize_attr_value(str, *meta, m_attr, false);
 }
 
+SaiAttrWrapper::SaiAttrWrapper(
+        _In_ const sai_attr_metadata_t* meta,
+        _In_ const std::string& value):
+    m_meta(meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (!meta)
+    {
+        SWSS_LOG_THROW("metadata can't be null");
+    }
+
+    memset(&m_attr, 0, sizeof(m_attr));
+
+    m_attr.id = meta->attrid;
+
+    sai_deserialize_attr_value(value, *meta, m_attr, false);
+}
+
 SaiAttrWrapper::~SaiAttrWrapper()
 {
     SWSS_LOG_ENTER();
@@ -6,6 +6,8 @@ extern "C" {
 
 #include "swss/sal.h"
 
+#include <string>
+
 namespace saimeta
 {
     class SaiAttrWrapper
@@ -16,6 +18,14 @@ namespace saimeta
                     _In_ const sai_attr_metadata_t* meta,
                     _In_ const sai_attribute_t& attr);
 
+            /**
+             * @brief Construct attribute from value serialized by
+             * sai_serialize_attr_value.
+             */
+            SaiAttrWrapper(
+                    _In_ const sai_attr_metadata_t* meta,
+                    _In_ const std::string& value);
+
             virtual ~SaiAttrWrapper();
 
         public:
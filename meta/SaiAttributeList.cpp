@@ -13,6 +13,9 @@ SaiAttributeList::SaiAttributeList(
 
     size_t attr_count = values.size();
 
+    m_attr_list.reserve(attr_count);
+    m_attr_value_type_list.reserve(attr_count);
+
     for (size_t i = 0; i < attr_count; ++i)
     {
         const std::string &str_attr_id = fvField(values[i]);
@@ -0,0 +1,147 @@
+#include "meta/LatencyHistogramExporter.h"
+
+#include "swss/logger.h"
+#include "swss/table.h"
+#include "swss/dbconnector.h"
+
+#include <getopt.h>
+
+#include <iostream>
+#include <iomanip>
+
+using namespace sairediscommon;
+
+void print_usage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cerr << "Usage: sailatency [-f file] [-d db] [-F filter] [-h]" << std::endl;
+    std::cerr << "    -f --file file" << std::endl;
+    std::cerr << "        Read latency histograms from exported JSON file" << std::endl;
+    std::cerr << "    -d --db db" << std::endl;
+    std::cerr << "        Read latency histograms from redis database, default: COUNTERS_DB" << std::endl;
+    std::cerr << "    -F --filter filter" << std::endl;
+    std::cerr << "        Show only histograms which key contains filter" << std::endl;
+    std::cerr << "    -h --help" << std::endl;
+    std::cerr << "        Print out this message" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    static struct option longOptions[] =
+    {
+        { "file",   required_argument, 0, 'f' },
+        { "db",     required_argument, 0, 'd' },
+        { "filter", required_argument, 0, 'F' },
+        { "help",   no_argument,       0, 'h' },
+        { 0,        0,                 0,  0  }
+    };
+
+    std::string fileName;
+    std::string dbName = "COUNTERS_DB";
+    std::string filter;
+
+    while (true)
+    {
+        int optionIndex = 0;
+
+        int c = getopt_long(argc, argv, "f:d:F:h", longOptions, &optionIndex);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'f':
+                fileName = optarg;
+                break;
+
+            case 'd':
+                dbName = optarg;
+                break;
+
+            case 'F':
+                filter = optarg;
+                break;
+
+            case 'h':
+                print_usage();
+                exit(EXIT_SUCCESS);
+
+            default:
+                print_usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    std::map<std::string, std::vector<swss::FieldValueTuple>> histograms;
+
+    if (fileName.size())
+    {
+        if (!LatencyHistogramExporter::readFile(fileName, histograms))
+        {
+            std::cerr << "failed to read " << fileName << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    else
+    {
+        swss::DBConnector db(dbName, 0);
+
+        swss::Table table(&db, LatencyHistogramExporter::TABLE_NAME);
+
+        std::vector<std::string> keys;
+
+        table.getKeys(keys);
+
+        for (auto& key: keys)
+        {
+            table.get(key, histograms[key]);
+        }
+    }
+
+    // all values are exported in nanoseconds, print in microseconds
+
+    std::cout << std::left << std::setw(80) << "KEY"
+        << std::right
+        << std::setw(12) << "COUNT"
+        << std::setw(12) << "AVG(us)"
+        << std::setw(12) << "P50(us)"
+        << std::setw(12) << "P99(us)"
+        << std::setw(12) << "P999(us)"
+        << std::setw(12) << "MAX(us)" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (auto& kvp: histograms)
+    {
+        if (kvp.first.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        LatencyHistogram::Snapshot s;
+
+        if (!LatencyHistogramExporter::deserialize(kvp.second, s) || s.count == 0)
+        {
+            continue;
+        }
+
+        std::cout << std::left << std::setw(80) << kvp.first
+            << std::right
+            << std::setw(12) << s.count
+            << std::setw(12) << (double)s.sum / (double)s.count / 1000.0
+            << std::setw(12) << (double)s.percentile(0.5) / 1000.0
+            << std::setw(12) << (double)s.percentile(0.99) / 1000.0
+            << std::setw(12) << (double)s.percentile(0.999) / 1000.0
+            << std::setw(12) << (double)s.max / 1000.0 << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+#include "BulkCoalescer.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <cstdlib>
+
+using namespace saiplayer;
+
+BulkCoalescer::BulkCoalescer(
+        _In_ size_t maxBulkSize):
+    m_maxBulkSize(maxBulkSize ? maxBulkSize : 1),
+    m_count(0),
+    m_op(0),
+    m_objectType(SAI_OBJECT_TYPE_NULL),
+    m_switchId(SAI_NULL_OBJECT_ID)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool BulkCoalescer::isSupported(
+        _In_ char op,
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (op != 'c' && op != 'r' && op != 's')
+    {
+        return false;
+    }
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == nullptr)
+    {
+        return false;
+    }
+
+    if (info->isobjectid)
+    {
+        // switch create must be executed alone, since it's creating context
+
+        return objectType != SAI_OBJECT_TYPE_SWITCH;
+    }
+
+    // same entries as bulk entry handling in player
+
+    switch ((int)objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY:
+        case SAI_OBJECT_TYPE_VIP_ENTRY:
+        case SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY:
+        case SAI_OBJECT_TYPE_GLOBAL_TRUSTED_VNI_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_TRUSTED_VNI_ENTRY:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool BulkCoalescer::referencesCreated(
+        _In_ const std::string& str) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_createdIds.empty())
+    {
+        return false;
+    }
+
+    static const std::string prefix = "oid:0x";
+
+    for (size_t pos = str.find(prefix); pos != std::string::npos; pos = str.find(prefix, pos + prefix.size()))
+    {
+        sai_object_id_t oid = strtoull(str.c_str() + pos + prefix.size(), nullptr, 16);
+
+        if (m_createdIds.find(oid) != m_createdIds.end())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BulkCoalescer::canAppend(
+        _In_ char op,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t switchId,
+        _In_ const std::string& objectId,
+        _In_ const std::string& attributes) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == 0)
+    {
+        return true;
+    }
+
+    if (op != m_op || objectType != m_objectType || switchId != m_switchId)
+    {
+        return false;
+    }
+
+    if (m_objectIds.find(objectId) != m_objectIds.end())
+    {
+        // operations on the same object must be executed in order
+
+        return false;
+    }
+
+    // VID created by pending bulk is not translated until bulk is executed
+
+    return !referencesCreated(objectId) && !referencesCreated(attributes);
+}
+
+void BulkCoalescer::append(
+        _In_ const std::string& timestamp,
+        _In_ char op,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t switchId,
+        _In_ const std::string& objectId,
+        _In_ const std::string& attributes)
+{
+    SWSS_LOG_ENTER();
+
+    if (!canAppend(op, objectType, switchId, objectId, attributes))
+    {
+        SWSS_LOG_THROW("can't append %s to pending bulk", objectId.c_str());
+    }
+
+    if (m_count == 0)
+    {
+        m_op = op;
+        m_objectType = objectType;
+        m_switchId = switchId;
+
+        m_line = timestamp;
+        m_line += '|';
+        m_line += getBulkOp();
+        m_line += '|';
+        m_line += sai_serialize_object_type(objectType);
+    }
+
+    m_line += "||";
+    m_line += objectId;
+
+    if (attributes.size())
+    {
+        m_line += '|';
+        m_line += attributes;
+    }
+
+    m_objectIds.insert(objectId);
+
+    if (op == 'c' && sai_metadata_get_object_type_info(objectType)->isobjectid)
+    {
+        sai_object_id_t oid;
+
+        sai_deserialize_object_id(objectId, oid);
+
+        m_createdIds.insert(oid);
+    }
+
+    m_count++;
+}
+
+bool BulkCoalescer::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count == 0;
+}
+
+bool BulkCoalescer::full() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count >= m_maxBulkSize;
+}
+
+char BulkCoalescer::getBulkOp() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_op)
+    {
+        case 'c': return 'C';
+        case 'r': return 'R';
+        case 's': return 'S';
+
+        default:
+            SWSS_LOG_THROW("unexpected op %c in pending bulk", m_op);
+    }
+}
+
+sai_common_api_t BulkCoalescer::getBulkApi() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_op)
+    {
+        case 'c': return SAI_COMMON_API_BULK_CREATE;
+        case 'r': return SAI_COMMON_API_BULK_REMOVE;
+        case 's': return SAI_COMMON_API_BULK_SET;
+
+        default:
+            SWSS_LOG_THROW("unexpected op %c in pending bulk", m_op);
+    }
+}
+
+const std::string& BulkCoalescer::getBulkLine() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_line;
+}
+
+void BulkCoalescer::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 0;
+    m_op = 0;
+    m_objectType = SAI_OBJECT_TYPE_NULL;
+    m_switchId = SAI_NULL_OBJECT_ID;
+
+    m_line.clear();
+    m_objectIds.clear();
+    m_createdIds.clear();
+}
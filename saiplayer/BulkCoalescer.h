@@ -0,0 +1,113 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <string>
+#include <unordered_set>
+
+namespace saiplayer
+{
+    /**
+     * @brief Bulk coalescer.
+     *
+     * Joins consecutive create, remove and set recording lines of the same
+     * object type into single bulk recording line, which is then executed
+     * as recorded bulk operation.
+     *
+     * Object ids are tracked, and line which references object created by
+     * pending bulk, or which refers to object already present in pending
+     * bulk, can't be appended and pending bulk must be executed first.
+     */
+    class BulkCoalescer
+    {
+        private:
+
+            BulkCoalescer(const BulkCoalescer&) = delete;
+            BulkCoalescer& operator=(const BulkCoalescer&) = delete;
+
+        public:
+
+            BulkCoalescer(
+                    _In_ size_t maxBulkSize);
+
+            virtual ~BulkCoalescer() = default;
+
+        public:
+
+            /**
+             * @brief Check if operation on given object type can be executed in bulk.
+             */
+            static bool isSupported(
+                    _In_ char op,
+                    _In_ sai_object_type_t objectType);
+
+            /**
+             * @brief Check if line can be appended to pending bulk.
+             *
+             * Object id is string object id or entry from recording line,
+             * and attributes are recorded attributes joined by '|'.
+             */
+            bool canAppend(
+                    _In_ char op,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t switchId,
+                    _In_ const std::string& objectId,
+                    _In_ const std::string& attributes) const;
+
+            void append(
+                    _In_ const std::string& timestamp,
+                    _In_ char op,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t switchId,
+                    _In_ const std::string& objectId,
+                    _In_ const std::string& attributes);
+
+            bool empty() const;
+
+            bool full() const;
+
+            /**
+             * @brief Get bulk operation (C, R or S) of pending bulk.
+             */
+            char getBulkOp() const;
+
+            sai_common_api_t getBulkApi() const;
+
+            /**
+             * @brief Get pending bulk in recording bulk line format.
+             *
+             * timestamp|op|objecttype||objectid|attrid=value|...||objectid|...
+             */
+            const std::string& getBulkLine() const;
+
+            void clear();
+
+        private:
+
+            /**
+             * @brief Check if string contains object id created by pending bulk.
+             */
+            bool referencesCreated(
+                    _In_ const std::string& str) const;
+
+        private:
+
+            size_t m_maxBulkSize;
+
+            size_t m_count;
+
+            char m_op;
+
+            sai_object_type_t m_objectType;
+
+            sai_object_id_t m_switchId;
+
+            std::string m_line;
+
+            std::unordered_set<std::string> m_objectIds;
+
+            std::unordered_set<sai_object_id_t> m_createdIds;
+    };
+}
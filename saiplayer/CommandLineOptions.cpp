@@ -21,11 +21,18 @@ CommandLineOptions::CommandLineOptions()
     m_sleep = false;
     m_syncMode = false;
     m_enableRecording = false;
+    m_fastReplay = false;
+    m_skipGetResponse = false;
+
+    m_maxBulkSize = 1000;
 
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 
     m_profileMapFile = "";
     m_contextConfig = "";
+    m_benchmarkFile = "";
+    m_startTime = "";
+    m_objectHistory = "";
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -44,6 +51,12 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " EnableRecording=" << (m_enableRecording ? "YES" : "NO");
     ss << " ProfileMapFile=" << m_profileMapFile;
     ss << " ContextConfig=" << m_contextConfig;
+    ss << " BenchmarkFile=" << m_benchmarkFile;
+    ss << " FastReplay=" << (m_fastReplay ? "YES" : "NO");
+    ss << " MaxBulkSize=" << m_maxBulkSize;
+    ss << " SkipGetResponse=" << (m_skipGetResponse ? "YES" : "NO");
+    ss << " StartTime=" << m_startTime;
+    ss << " ObjectHistory=" << m_objectHistory;
 
     return ss.str();
 }
@@ -43,6 +43,52 @@ namespace saiplayer
 
             std::string m_contextConfig;
 
+            /**
+             * @brief Benchmark results file.
+             *
+             * If not empty, replay is measured and ops/sec, per api latency
+             * percentiles and syncd CPU/RSS are written as JSON to this file.
+             */
+            std::string m_benchmarkFile;
+
+            /**
+             * @brief Fast replay.
+             *
+             * Recording is read by separate parser thread and consecutive
+             * create, remove and set operations of the same object type are
+             * executed as bulk operations.
+             */
+            bool m_fastReplay;
+
+            /**
+             * @brief Maximum number of objects in bulk created by fast replay.
+             */
+            uint32_t m_maxBulkSize;
+
+            /**
+             * @brief Skip GET response matching.
+             *
+             * GET operations which recorded response contains no object ids
+             * are not executed, since they are not needed to match VIDs.
+             */
+            bool m_skipGetResponse;
+
+            /**
+             * @brief Start replay time.
+             *
+             * If not empty, replay starts from last INIT_VIEW recorded
+             * before given timestamp, found using recording index.
+             */
+            std::string m_startTime;
+
+            /**
+             * @brief Object VID which history should be printed.
+             *
+             * If not empty, all recording lines referencing given object are
+             * printed using recording index and nothing is replayed.
+             */
+            std::string m_objectHistory;
+
             std::vector<std::string> m_files;
     };
 }
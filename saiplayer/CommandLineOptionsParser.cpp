@@ -18,7 +18,7 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
 
     auto options = std::make_shared<CommandLineOptions>();
 
-    const char* const optstring = "uiCdsmz:rp:x:h";
+    const char* const optstring = "uiCdsmz:rp:x:b:FB:Gt:o:h";
 
     while (true)
     {
@@ -34,6 +34,12 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "enableRecording",        no_argument,       0, 'r' },
             { "profile",                required_argument, 0, 'p' },
             { "contextContig",          required_argument, 0, 'x' },
+            { "benchmark",              required_argument, 0, 'b' },
+            { "fastReplay",             no_argument,       0, 'F' },
+            { "maxBulkSize",            required_argument, 0, 'B' },
+            { "skipGetResponse",        no_argument,       0, 'G' },
+            { "startTime",              required_argument, 0, 't' },
+            { "objectHistory",          required_argument, 0, 'o' },
             { "help",                   no_argument,       0, 'h' },
         };
 
@@ -85,6 +91,30 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_contextConfig = std::string(optarg);
                 break;
 
+            case 'b':
+                options->m_benchmarkFile = std::string(optarg);
+                break;
+
+            case 'F':
+                options->m_fastReplay = true;
+                break;
+
+            case 'B':
+                options->m_maxBulkSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'G':
+                options->m_skipGetResponse = true;
+                break;
+
+            case 't':
+                options->m_startTime = std::string(optarg);
+                break;
+
+            case 'o':
+                options->m_objectHistory = std::string(optarg);
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -123,7 +153,7 @@ void CommandLineOptionsParser::printUsage()
 {
     SWSS_LOG_ENTER();
 
-    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-h] recordfile" << std::endl << std::endl;
+    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-b benchmarkFile] [-F] [-B maxBulkSize] [-G] [-t startTime] [-o objectId] [-h] recordfile" << std::endl << std::endl;
 
     std::cout << "    -u --useTempView:" << std::endl;
     std::cout << "        Enable temporary view between init and apply" << std::endl << std::endl;
@@ -145,6 +175,18 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Provide profile map file" << std::endl << std::endl;
     std::cout << "    -x --contextConfig" << std::endl;
     std::cout << "        Context configuration file" << std::endl << std::endl;
+    std::cout << "    -b --benchmark benchmarkFile" << std::endl;
+    std::cout << "        Measure replay and write ops/sec, per api latency and syncd CPU/RSS as JSON to file" << std::endl << std::endl;
+    std::cout << "    -F --fastReplay:" << std::endl;
+    std::cout << "        Read recording in parser thread and join consecutive create/remove/set into bulk" << std::endl << std::endl;
+    std::cout << "    -B --maxBulkSize maxBulkSize" << std::endl;
+    std::cout << "        Maximum number of objects in bulk joined by fast replay, default: 1000" << std::endl << std::endl;
+    std::cout << "    -G --skipGetResponse:" << std::endl;
+    std::cout << "        Skip GET operations which recorded response contains no object ids" << std::endl << std::endl;
+    std::cout << "    -t --startTime startTime" << std::endl;
+    std::cout << "        Start replay from last INIT_VIEW before YYYY-MM-DD.hh:mm:ss[.uuuuuu] using recording index" << std::endl << std::endl;
+    std::cout << "    -o --objectHistory objectId" << std::endl;
+    std::cout << "        Print recording lines referencing given object (oid:0x...) using recording index and exit" << std::endl << std::endl;
     std::cout << "    -h --help:" << std::endl;
     std::cout << "        Print out this message" << std::endl << std::endl;
 }
@@ -0,0 +1,152 @@
+#include "RecordingReader.h"
+
+#include "swss/logger.h"
+
+using namespace saiplayer;
+
+#define READ_BUFFER_SIZE (1 << 20)
+
+constexpr size_t RecordingReader::CHUNK_LINES;
+constexpr size_t RecordingReader::MAX_CHUNKS;
+
+RecordingReader::RecordingReader(
+        _In_ const std::string& fileName,
+        _In_ bool threaded,
+        _In_ uint64_t offset):
+    m_buffer(READ_BUFFER_SIZE),
+    m_threaded(threaded),
+    m_currentIndex(0),
+    m_eof(false),
+    m_stop(false)
+{
+    SWSS_LOG_ENTER();
+
+    // buffer must be set before file is opened to take effect
+
+    m_file.rdbuf()->pubsetbuf(m_buffer.data(), (std::streamsize)m_buffer.size());
+
+    m_file.open(fileName);
+
+    if (m_file.is_open() && offset)
+    {
+        m_file.seekg((std::streamoff)offset);
+    }
+
+    if (!m_file.is_open())
+    {
+        // nothing to read, also in threaded mode no line is returned
+
+        m_eof = true;
+    }
+    else if (m_threaded)
+    {
+        m_thread = std::thread(&RecordingReader::parserThread, this);
+    }
+}
+
+RecordingReader::~RecordingReader()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_stop = true;
+        }
+
+        m_cvWrite.notify_all();
+
+        m_thread.join();
+    }
+}
+
+bool RecordingReader::isOpen() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_file.is_open();
+}
+
+bool RecordingReader::getline(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_threaded)
+    {
+        return (bool)std::getline(m_file, line);
+    }
+
+    if (m_currentIndex >= m_current.size())
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cvRead.wait(lock, [&]{ return m_chunks.size() || m_eof; });
+
+        if (m_chunks.empty())
+        {
+            return false;
+        }
+
+        m_current = std::move(m_chunks.front());
+
+        m_chunks.pop_front();
+
+        m_currentIndex = 0;
+
+        lock.unlock();
+
+        m_cvWrite.notify_one();
+    }
+
+    line = std::move(m_current[m_currentIndex++]);
+
+    return true;
+}
+
+void RecordingReader::parserThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("recording parser thread started");
+
+    bool more = true;
+
+    while (more)
+    {
+        std::vector<std::string> chunk;
+
+        chunk.reserve(CHUNK_LINES);
+
+        std::string line;
+
+        while (chunk.size() < CHUNK_LINES && (more = (bool)std::getline(m_file, line)))
+        {
+            chunk.push_back(std::move(line));
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cvWrite.wait(lock, [&]{ return m_chunks.size() < MAX_CHUNKS || m_stop; });
+
+        if (m_stop)
+        {
+            break;
+        }
+
+        if (chunk.size())
+        {
+            m_chunks.push_back(std::move(chunk));
+        }
+
+        m_eof = !more;
+
+        lock.unlock();
+
+        m_cvRead.notify_one();
+    }
+
+    SWSS_LOG_NOTICE("recording parser thread ended");
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace saiplayer
+{
+    /**
+     * @brief Recording reader.
+     *
+     * Reads recording file line by line. In threaded mode file is read and
+     * split into lines by separate parser thread, which hands over lines in
+     * chunks, so reading overlaps with executing replayed operations.
+     */
+    class RecordingReader
+    {
+        private:
+
+            RecordingReader(const RecordingReader&) = delete;
+            RecordingReader& operator=(const RecordingReader&) = delete;
+
+        public:
+
+            /**
+             * @brief Open recording.
+             *
+             * Reading starts at given offset, which must point to beginning
+             * of line, see sairedis::RecordingIndex.
+             */
+            RecordingReader(
+                    _In_ const std::string& fileName,
+                    _In_ bool threaded,
+                    _In_ uint64_t offset = 0);
+
+            virtual ~RecordingReader();
+
+        public:
+
+            bool isOpen() const;
+
+            /**
+             * @brief Get next line.
+             *
+             * Returns false when end of file was reached.
+             */
+            bool getline(
+                    _Out_ std::string& line);
+
+        private:
+
+            void parserThread();
+
+        private:
+
+            /**
+             * @brief Number of lines handed over to replay at once.
+             */
+            static constexpr size_t CHUNK_LINES = 1024;
+
+            /**
+             * @brief Maximum number of chunks read ahead by parser thread.
+             */
+            static constexpr size_t MAX_CHUNKS = 64;
+
+            std::vector<char> m_buffer;
+
+            std::ifstream m_file;
+
+            bool m_threaded;
+
+            std::thread m_thread;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cvRead;
+
+            std::condition_variable m_cvWrite;
+
+            std::deque<std::vector<std::string>> m_chunks;
+
+            std::vector<std::string> m_current;
+
+            size_t m_currentIndex;
+
+            bool m_eof;
+
+            bool m_stop;
+    };
+}
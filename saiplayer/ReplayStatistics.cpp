@@ -0,0 +1,342 @@
+#include "ReplayStatistics.h"
+
+#include "swss/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include <dirent.h>
+
+using namespace saiplayer;
+
+using json = nlohmann::json;
+
+ReplayStatistics::Measure::Measure(
+        _In_ std::shared_ptr<ReplayStatistics> statistics,
+        _In_ char op,
+        _In_ const std::string& line):
+    m_statistics(statistics),
+    m_api(nullptr),
+    m_objectCount(1)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_statistics == nullptr)
+    {
+        return;
+    }
+
+    m_api = getApiName(op);
+
+    if (op == 'C' || op == 'R' || op == 'S' || op == 'B')
+    {
+        // timestamp|op|objecttype||objectid|attrid=value||objectid|...
+
+        m_objectCount = 0;
+
+        for (size_t pos = line.find("||"); pos != std::string::npos; pos = line.find("||", pos + 2))
+        {
+            m_objectCount++;
+        }
+    }
+
+    m_start = std::chrono::steady_clock::now();
+}
+
+ReplayStatistics::Measure::~Measure()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_statistics == nullptr || m_api == nullptr)
+    {
+        return;
+    }
+
+    auto duration = std::chrono::steady_clock::now() - m_start;
+
+    m_statistics->record(
+            m_api,
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+            m_objectCount);
+}
+
+ReplayStatistics::ReplayStatistics(
+        _In_ const std::string& recordingFile):
+    m_recordingFile(recordingFile),
+    m_syncdFound(false)
+{
+    SWSS_LOG_ENTER();
+
+    m_syncdStart = {};
+    m_syncdStop = {};
+}
+
+const char* ReplayStatistics::getApiName(
+        _In_ char op)
+{
+    SWSS_LOG_ENTER();
+
+    switch (op)
+    {
+        case 'c': return "create";
+        case 'r': return "remove";
+        case 's': return "set";
+        case 'g': return "get";
+        case 'C': return "bulkCreate";
+        case 'R': return "bulkRemove";
+        case 'S': return "bulkSet";
+        case 'B': return "bulkGet";
+        case 'a': return "notifySyncd";
+        case 'f': return "flushFdbEntries";
+        case 'p': return "counterPolling";
+        case 'P': return "bulkCounterPolling";
+
+        default:
+            return nullptr;
+    }
+}
+
+void ReplayStatistics::start()
+{
+    SWSS_LOG_ENTER();
+
+    m_latencies.clear();
+    m_objectCounts.clear();
+
+    m_syncdFound = getSyncdUsage(m_syncdStart);
+
+    if (!m_syncdFound)
+    {
+        SWSS_LOG_WARN("syncd process not found, syncd usage will not be reported");
+    }
+
+    m_start = std::chrono::steady_clock::now();
+}
+
+void ReplayStatistics::stop()
+{
+    SWSS_LOG_ENTER();
+
+    m_stop = std::chrono::steady_clock::now();
+
+    if (m_syncdFound)
+    {
+        m_syncdFound = getSyncdUsage(m_syncdStop) && m_syncdStop.pid == m_syncdStart.pid;
+    }
+}
+
+void ReplayStatistics::record(
+        _In_ const std::string& api,
+        _In_ uint64_t durationNs,
+        _In_ size_t objectCount)
+{
+    SWSS_LOG_ENTER();
+
+    m_latencies[api].push_back(durationNs);
+
+    m_objectCounts[api] += objectCount;
+}
+
+double ReplayStatistics::percentile(
+        _In_ const std::vector<uint64_t>& sorted,
+        _In_ double pct)
+{
+    SWSS_LOG_ENTER();
+
+    if (sorted.empty())
+    {
+        return 0;
+    }
+
+    // nearest rank
+
+    size_t rank = (size_t)std::ceil(pct / 100.0 * (double)sorted.size());
+
+    rank = std::max<size_t>(rank, 1);
+
+    return (double)sorted[std::min(rank, sorted.size()) - 1] / 1000.0;
+}
+
+std::string ReplayStatistics::toJson() const
+{
+    SWSS_LOG_ENTER();
+
+    double durationMs = (double)std::chrono::duration_cast<std::chrono::microseconds>(m_stop - m_start).count() / 1000.0;
+
+    size_t totalOperations = 0;
+    size_t totalObjects = 0;
+
+    json apis = json::object();
+
+    for (auto& kvp: m_latencies)
+    {
+        auto sorted = kvp.second;
+
+        std::sort(sorted.begin(), sorted.end());
+
+        uint64_t sum = 0;
+
+        for (auto l: sorted)
+        {
+            sum += l;
+        }
+
+        size_t objects = m_objectCounts.at(kvp.first);
+
+        totalOperations += sorted.size();
+        totalObjects += objects;
+
+        apis[kvp.first] = {
+            { "count", sorted.size() },
+            { "objects", objects },
+            { "latency_us", {
+                { "min", (double)sorted.front() / 1000.0 },
+                { "avg", (double)sum / (double)sorted.size() / 1000.0 },
+                { "p50", percentile(sorted, 50) },
+                { "p90", percentile(sorted, 90) },
+                { "p99", percentile(sorted, 99) },
+                { "max", (double)sorted.back() / 1000.0 } } }
+        };
+    }
+
+    json j = {
+        { "file", m_recordingFile },
+        { "duration_ms", durationMs },
+        { "operations", totalOperations },
+        { "objects", totalObjects },
+        { "ops_per_sec", durationMs > 0 ? (double)totalObjects * 1000.0 / durationMs : 0 },
+        { "apis", apis }
+    };
+
+    if (m_syncdFound)
+    {
+        double ticksPerSec = (double)sysconf(_SC_CLK_TCK);
+
+        double cpuMs = (double)(m_syncdStop.cpuTicks - m_syncdStart.cpuTicks) * 1000.0 / ticksPerSec;
+
+        j["syncd"] = {
+            { "pid", m_syncdStop.pid },
+            { "cpu_ms", cpuMs },
+            { "cpu_percent", durationMs > 0 ? cpuMs * 100.0 / durationMs : 0 },
+            { "rss_kb", m_syncdStop.rssKb },
+            { "peak_rss_kb", m_syncdStop.peakRssKb }
+        };
+    }
+    else
+    {
+        j["syncd"] = nullptr;
+    }
+
+    return j.dump(4);
+}
+
+bool ReplayStatistics::writeJson(
+        _In_ const std::string& fileName) const
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream ofs(fileName);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", fileName.c_str());
+        return false;
+    }
+
+    ofs << toJson() << std::endl;
+
+    SWSS_LOG_NOTICE("benchmark results written to %s", fileName.c_str());
+
+    return true;
+}
+
+bool ReplayStatistics::getSyncdUsage(
+        _Out_ ProcessUsage& usage)
+{
+    SWSS_LOG_ENTER();
+
+    usage = {};
+
+    DIR* dir = opendir("/proc");
+
+    if (dir == nullptr)
+    {
+        return false;
+    }
+
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        std::string name = entry->d_name;
+
+        if (name.find_first_not_of("0123456789") != std::string::npos)
+        {
+            continue;
+        }
+
+        std::string comm;
+
+        std::ifstream(std::string("/proc/") + name + "/comm") >> comm;
+
+        if (comm != "syncd" && comm != "vssyncd" && comm != "lt-vssyncd")
+        {
+            continue;
+        }
+
+        usage.pid = (pid_t)std::stoi(name);
+
+        // comm in stat can contain spaces, fields are counted after ')'
+
+        std::ifstream statFile(std::string("/proc/") + name + "/stat");
+
+        std::string stat((std::istreambuf_iterator<char>(statFile)), std::istreambuf_iterator<char>());
+
+        std::istringstream iss(stat.substr(stat.find_last_of(')') + 2));
+
+        std::string field;
+
+        uint64_t utime = 0;
+        uint64_t stime = 0;
+
+        // utime and stime are fields 14 and 15, state is field 3
+
+        for (int idx = 3; idx <= 15 && (iss >> field); idx++)
+        {
+            if (idx == 14)
+                utime = std::stoull(field);
+            else if (idx == 15)
+                stime = std::stoull(field);
+        }
+
+        usage.cpuTicks = utime + stime;
+
+        std::ifstream status(std::string("/proc/") + name + "/status");
+
+        std::string line;
+
+        while (std::getline(status, line))
+        {
+            if (line.rfind("VmRSS:", 0) == 0)
+            {
+                usage.rssKb = std::stoull(line.substr(6));
+            }
+            else if (line.rfind("VmHWM:", 0) == 0)
+            {
+                usage.peakRssKb = std::stoull(line.substr(6));
+            }
+        }
+
+        closedir(dir);
+
+        return true;
+    }
+
+    closedir(dir);
+
+    return false;
+}
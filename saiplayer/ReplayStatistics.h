@@ -0,0 +1,140 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace saiplayer
+{
+    /**
+     * @brief Replay statistics.
+     *
+     * Collects per api latency of replayed recording lines together with
+     * syncd process CPU and memory usage, and produces machine readable
+     * JSON report, used by benchmark mode of saiplayer.
+     */
+    class ReplayStatistics
+    {
+        private:
+
+            ReplayStatistics(const ReplayStatistics&) = delete;
+            ReplayStatistics& operator=(const ReplayStatistics&) = delete;
+
+        public:
+
+            ReplayStatistics(
+                    _In_ const std::string& recordingFile);
+
+            virtual ~ReplayStatistics() = default;
+
+        public:
+
+            /**
+             * @brief Measures single recording line.
+             *
+             * Latency is recorded when object goes out of scope, so it
+             * also covers replay branches which end with continue.
+             */
+            class Measure
+            {
+                private:
+
+                    Measure(const Measure&) = delete;
+                    Measure& operator=(const Measure&) = delete;
+
+                public:
+
+                    Measure(
+                            _In_ std::shared_ptr<ReplayStatistics> statistics,
+                            _In_ char op,
+                            _In_ const std::string& line);
+
+                    ~Measure();
+
+                private:
+
+                    std::shared_ptr<ReplayStatistics> m_statistics;
+
+                    const char* m_api;
+
+                    size_t m_objectCount;
+
+                    std::chrono::steady_clock::time_point m_start;
+            };
+
+        public:
+
+            void start();
+
+            void stop();
+
+            void record(
+                    _In_ const std::string& api,
+                    _In_ uint64_t durationNs,
+                    _In_ size_t objectCount);
+
+            std::string toJson() const;
+
+            bool writeJson(
+                    _In_ const std::string& fileName) const;
+
+            /**
+             * @brief Get api name of recording operation.
+             *
+             * Returns nullptr if operation is not measured (comments,
+             * responses, notifications).
+             */
+            static const char* getApiName(
+                    _In_ char op);
+
+        private:
+
+            typedef struct _ProcessUsage
+            {
+                pid_t pid;
+
+                uint64_t cpuTicks;
+
+                uint64_t rssKb;
+
+                uint64_t peakRssKb;
+
+            } ProcessUsage;
+
+            /**
+             * @brief Get usage of running syncd process.
+             *
+             * Process is found by name (syncd, vssyncd).
+             */
+            static bool getSyncdUsage(
+                    _Out_ ProcessUsage& usage);
+
+            static double percentile(
+                    _In_ const std::vector<uint64_t>& sorted,
+                    _In_ double pct);
+
+        private:
+
+            std::string m_recordingFile;
+
+            std::map<std::string, std::vector<uint64_t>> m_latencies;
+
+            std::map<std::string, size_t> m_objectCounts;
+
+            std::chrono::steady_clock::time_point m_start;
+
+            std::chrono::steady_clock::time_point m_stop;
+
+            bool m_syncdFound;
+
+            ProcessUsage m_syncdStart;
+
+            ProcessUsage m_syncdStop;
+    };
+}
@@ -10,6 +10,7 @@
 
 #include "swss/logger.h"
 #include "swss/tokenize.h"
+#include "swss/schema.h"
 
 #include <inttypes.h>
 #include <getopt.h>
@@ -1402,6 +1403,229 @@ void SaiPlayer::performFdbFlush(
     // fdb flush OK
 }
 
+std::string SaiPlayer::translateCounterKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    // group:oid,oid,...
+
+    auto delimiter = key.find_first_of(":");
+
+    if (delimiter == std::string::npos)
+    {
+        SWSS_LOG_THROW("invalid counter key %s", key.c_str());
+    }
+
+    std::string translated = key.substr(0, delimiter + 1);
+
+    for (auto& strVid: swss::tokenize(key.substr(delimiter + 1), ','))
+    {
+        sai_object_id_t vid;
+
+        sai_deserialize_object_id(strVid, vid);
+
+        if (translated.back() != ':')
+        {
+            translated += ",";
+        }
+
+        translated += sai_serialize_object_id(translate_local_to_redis(vid));
+    }
+
+    return translated;
+}
+
+std::vector<swss::FieldValueTuple> SaiPlayer::getCounterPollingValues(
+        _In_ const std::vector<std::string>& tokens,
+        _In_ size_t first)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (size_t idx = first; idx < tokens.size(); idx++)
+    {
+        auto pos = tokens[idx].find_first_of("=");
+
+        if (pos != std::string::npos)
+        {
+            values.emplace_back(tokens[idx].substr(0, pos), tokens[idx].substr(pos + 1));
+        }
+    }
+
+    return values;
+}
+
+static sai_s8_list_t toS8List(
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    sai_s8_list_t list;
+
+    list.count = (uint32_t)str.size();
+    list.list = (int8_t*)const_cast<char*>(str.c_str());
+
+    return list;
+}
+
+static void fillCounterParameter(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _Out_ sai_redis_flex_counter_parameter_t& param)
+{
+    SWSS_LOG_ENTER();
+
+    // strings are referenced, key and values must outlive parameter
+
+    memset(&param, 0, sizeof(param));
+
+    param.counter_key = toS8List(key);
+
+    for (auto& fv: values)
+    {
+        if (fvField(fv) == STATS_MODE_FIELD)
+        {
+            param.stats_mode = toS8List(fvValue(fv));
+        }
+        else
+        {
+            param.counter_field_name = toS8List(fvField(fv));
+            param.counter_ids = toS8List(fvValue(fv));
+        }
+    }
+}
+
+void SaiPlayer::performCounterPolling(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|p|key|field=value|...
+    auto tokens = swss::tokenize(line, '|');
+
+    if (tokens.size() < 3)
+    {
+        SWSS_LOG_THROW("invalid counter polling line %s", line.c_str());
+    }
+
+    auto& key = tokens[2];
+
+    auto values = getCounterPollingValues(tokens, 3);
+
+    sai_attribute_t attr;
+
+    sai_redis_flex_counter_group_parameter_t groupParam;
+    sai_redis_flex_counter_parameter_t counterParam;
+
+    std::string translatedKey;
+
+    if (key.find_first_of(":") == std::string::npos)
+    {
+        // counter group operation, empty values remove group
+
+        memset(&groupParam, 0, sizeof(groupParam));
+
+        groupParam.counter_group_name = toS8List(key);
+
+        for (auto& fv: values)
+        {
+            auto& field = fvField(fv);
+
+            if (field == POLL_INTERVAL_FIELD)
+                groupParam.poll_interval = toS8List(fvValue(fv));
+            else if (field == BULK_CHUNK_SIZE_FIELD)
+                groupParam.bulk_chunk_size = toS8List(fvValue(fv));
+            else if (field == BULK_CHUNK_SIZE_PER_PREFIX_FIELD)
+                groupParam.bulk_chunk_size_per_prefix = toS8List(fvValue(fv));
+            else if (field == STATS_MODE_FIELD)
+                groupParam.stats_mode = toS8List(fvValue(fv));
+            else if (field == FLEX_COUNTER_STATUS_FIELD)
+                groupParam.operation = toS8List(fvValue(fv));
+            else
+            {
+                groupParam.plugin_name = toS8List(field);
+                groupParam.plugins = toS8List(fvValue(fv));
+            }
+        }
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP;
+        attr.value.ptr = &groupParam;
+    }
+    else
+    {
+        translatedKey = translateCounterKey(key);
+
+        fillCounterParameter(translatedKey, values, counterParam);
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER;
+        attr.value.ptr = &counterParam;
+    }
+
+    /*
+     * NOTE: We don't need actual switch to set those attributes.
+     */
+
+    sai_status_t status = m_sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to execute counter polling %s: %s", key.c_str(), sai_serialize_status(status).c_str());
+    }
+}
+
+void SaiPlayer::performBulkCounterPolling(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|P|count||key|field=value|...||key|...
+    auto fields = tokenize(line, "||");
+
+    std::vector<std::string> keys;
+    std::vector<std::vector<swss::FieldValueTuple>> values;
+
+    for (size_t idx = 1; idx < fields.size(); idx++)
+    {
+        auto tokens = swss::tokenize(fields[idx], '|');
+
+        keys.push_back(translateCounterKey(tokens.at(0)));
+        values.push_back(getCounterPollingValues(tokens, 1));
+    }
+
+    if (keys.empty())
+    {
+        SWSS_LOG_THROW("invalid bulk counter polling line %s", line.c_str());
+    }
+
+    std::vector<sai_redis_flex_counter_parameter_t> params(keys.size());
+    std::vector<sai_status_t> statuses(keys.size());
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        fillCounterParameter(keys[idx], values[idx], params[idx]);
+    }
+
+    sai_redis_flex_counter_bulk_parameter_t bulkParam;
+
+    bulkParam.count = (uint32_t)params.size();
+    bulkParam.params = params.data();
+    bulkParam.statuses = statuses.data();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_BULK;
+    attr.value.ptr = &bulkParam;
+
+    sai_status_t status = m_sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to execute bulk counter polling: %s", sai_serialize_status(status).c_str());
+    }
+}
+
 std::vector<std::string> SaiPlayer::tokenize(
         _In_ std::string input,
         _In_ const std::string &delim)
@@ -2803,7 +3027,7 @@ void SaiPlayer::processBulk(
         do
         {
             // this line may be notification, we need to skip
-            std::getline(m_infile, response);
+            m_reader->getline(response);
         }
         while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -2892,6 +3116,222 @@ void SaiPlayer::processBulk(
     }
 }
 
+std::string SaiPlayer::readResponse(
+        _In_ const std::string &line)
+{
+    SWSS_LOG_ENTER();
+
+    std::string response;
+
+    do
+    {
+        // this line may be notification, we need to skip
+        if (!m_reader->getline(response))
+        {
+            SWSS_LOG_THROW("failed to read response from file, previous: %s", line.c_str());
+        }
+    }
+    while (response[response.find_first_of("|") + 1] == 'n');
+
+    return response;
+}
+
+std::shared_ptr<sairedis::RecordingIndex> SaiPlayer::openIndex(
+        _In_ const std::string& filename)
+{
+    SWSS_LOG_ENTER();
+
+    auto indexFile = sairedis::RecordingIndex::getIndexFileName(filename);
+
+    auto index = std::make_shared<sairedis::RecordingIndex>();
+
+    if (index->open(filename, indexFile))
+    {
+        return index;
+    }
+
+    SWSS_LOG_NOTICE("building recording index %s", indexFile.c_str());
+
+    if (!sairedis::RecordingIndex::build(filename, indexFile) || !index->open(filename, indexFile))
+    {
+        SWSS_LOG_ERROR("failed to create recording index %s", indexFile.c_str());
+
+        return nullptr;
+    }
+
+    return index;
+}
+
+bool SaiPlayer::findStartOffset(
+        _In_ const std::string& filename,
+        _Out_ uint64_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    offset = 0;
+
+    auto& startTime = m_commandLineOptions->m_startTime;
+
+    uint64_t timestamp;
+
+    if (!sairedis::RecordingIndex::parseTimestamp(startTime.c_str(), startTime.size(), timestamp))
+    {
+        SWSS_LOG_ERROR("invalid start time %s, expected YYYY-MM-DD.hh:mm:ss[.uuuuuu]", startTime.c_str());
+        return false;
+    }
+
+    auto index = openIndex(filename);
+
+    if (!index)
+    {
+        return false;
+    }
+
+    auto line = index->findTimestamp(timestamp);
+
+    if (line == sairedis::RecordingIndex::INVALID_LINE)
+    {
+        SWSS_LOG_ERROR("no lines recorded at or after %s in %s", startTime.c_str(), filename.c_str());
+        return false;
+    }
+
+    // replay from given line would use objects created before it, so it
+    // must start from INIT_VIEW which is followed by whole switch state
+
+    auto checkpoint = index->findCheckpoint(line);
+
+    if (checkpoint == sairedis::RecordingIndex::INVALID_LINE)
+    {
+        SWSS_LOG_WARN("no INIT_VIEW before %s, replaying from start", startTime.c_str());
+        return true;
+    }
+
+    offset = index->getOffset(checkpoint);
+
+    SWSS_LOG_NOTICE("starting replay from line %" PRIu64 ": %s", checkpoint + 1, index->getLine(checkpoint).c_str());
+
+    return true;
+}
+
+int SaiPlayer::printObjectHistory(
+        _In_ const std::string& filename)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t vid;
+
+    sai_deserialize_object_id(m_commandLineOptions->m_objectHistory, vid);
+
+    auto index = openIndex(filename);
+
+    if (!index)
+    {
+        return -1;
+    }
+
+    for (auto line: index->getObjectHistory(vid))
+    {
+        std::cout << index->getLine(line) << std::endl;
+    }
+
+    return 0;
+}
+
+void SaiPlayer::flushBulk()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bulkCoalescer == nullptr || m_bulkCoalescer->empty())
+    {
+        return;
+    }
+
+    const std::string& line = m_bulkCoalescer->getBulkLine();
+
+    SWSS_LOG_DEBUG("executing joined bulk: %s", line.c_str());
+
+    {
+        ReplayStatistics::Measure measure(m_replayStatistics, m_bulkCoalescer->getBulkOp(), line);
+
+        processBulk(m_bulkCoalescer->getBulkApi(), line);
+    }
+
+    m_bulkCoalescer->clear();
+}
+
+bool SaiPlayer::coalesceBulk(
+        _In_ char op,
+        _In_ const std::string &line)
+{
+    SWSS_LOG_ENTER();
+
+    if (op == '#' || op == 'n')
+    {
+        return false; // comment and notification don't break pending bulk
+    }
+
+    if (op != 'c' && op != 'r' && op != 's')
+    {
+        flushBulk();
+        return false;
+    }
+
+    // timestamp|action|objecttype:objectid|attrid=value|...
+
+    auto p = line.find_first_of("|");
+
+    auto start = p + 3;
+
+    // object id may contain ':' but object type don't
+
+    auto colon = line.find_first_of(":", start);
+
+    if (colon == std::string::npos)
+    {
+        flushBulk();
+        return false;
+    }
+
+    sai_object_type_t objectType = deserialize_object_type(line.substr(start, colon - start));
+
+    if (!BulkCoalescer::isSupported(op, objectType))
+    {
+        flushBulk();
+        return false;
+    }
+
+    auto attrs = line.find_first_of("|", colon);
+
+    std::string objectId = line.substr(colon + 1, attrs == std::string::npos ? std::string::npos : attrs - colon - 1);
+
+    std::string attributes = attrs == std::string::npos ? "" : line.substr(attrs + 1);
+
+    sai_object_id_t switchId = SAI_NULL_OBJECT_ID;
+
+    if (op == 'c' && sai_metadata_get_object_type_info(objectType)->isobjectid)
+    {
+        sai_object_id_t localId;
+
+        sai_deserialize_object_id(objectId, localId);
+
+        switchId = m_sai->switchIdQuery(localId);
+    }
+
+    if (!m_bulkCoalescer->canAppend(op, objectType, switchId, objectId, attributes))
+    {
+        flushBulk();
+    }
+
+    m_bulkCoalescer->append(line.substr(0, p), op, objectType, switchId, objectId, attributes);
+
+    if (m_bulkCoalescer->full())
+    {
+        flushBulk();
+    }
+
+    return true;
+}
+
 int SaiPlayer::replay()
 {
     //swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
@@ -2909,17 +3349,38 @@ int SaiPlayer::replay()
 
     SWSS_LOG_NOTICE("using file: %s", filename.c_str());
 
-    m_infile = std::ifstream{filename};
+    uint64_t offset = 0;
+
+    if (m_commandLineOptions->m_startTime.size() && !findStartOffset(filename, offset))
+    {
+        return -1;
+    }
+
+    m_reader = std::make_shared<RecordingReader>(filename, m_commandLineOptions->m_fastReplay, offset);
 
-    if (!m_infile.is_open())
+    if (!m_reader->isOpen())
     {
         SWSS_LOG_ERROR("failed to open file %s", filename.c_str());
         return -1;
     }
 
+    if (m_commandLineOptions->m_fastReplay)
+    {
+        SWSS_LOG_NOTICE("fast replay enabled, max bulk size %u", m_commandLineOptions->m_maxBulkSize);
+
+        m_bulkCoalescer = std::make_shared<BulkCoalescer>(m_commandLineOptions->m_maxBulkSize);
+    }
+
+    if (m_commandLineOptions->m_benchmarkFile.size())
+    {
+        m_replayStatistics = std::make_shared<ReplayStatistics>(filename);
+
+        m_replayStatistics->start();
+    }
+
     std::string line;
 
-    while (std::getline(m_infile, line))
+    while (m_reader->getline(line))
     {
         // std::cout << "processing " << line << std::endl;
 
@@ -2929,6 +3390,27 @@ int SaiPlayer::replay()
 
         char op = line[p+1];
 
+        if (m_bulkCoalescer && coalesceBulk(op, line))
+        {
+            continue; // will be executed with pending bulk
+        }
+
+        std::string getResponse; // read ahead when get response matching is skipped
+
+        if (op == 'g' && m_commandLineOptions->m_skipGetResponse)
+        {
+            getResponse = readResponse(line);
+
+            if (getResponse.find("oid:0x") == std::string::npos)
+            {
+                SWSS_LOG_INFO("skipping get without object ids: %s", line.c_str());
+                continue;
+            }
+        }
+
+        // measures this line until end of iteration, no-op if benchmark is disabled
+        ReplayStatistics::Measure measure(m_replayStatistics, op, line);
+
         switch (op)
         {
             case 'a':
@@ -2938,7 +3420,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!m_reader->getline(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -2956,7 +3438,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!m_reader->getline(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -2998,7 +3480,10 @@ int SaiPlayer::replay()
                 // TODO: implement SAI player support for query commands
                 continue;
             case 'p':
-                // TODO: implement SAI player support for counter polling commands
+                performCounterPolling(line);
+                continue;
+            case 'P':
+                performBulkCounterPolling(line);
                 continue;
             case 'Q':
                 continue; // skip over query responses
@@ -3124,14 +3609,17 @@ int SaiPlayer::replay()
 
         if (api == SAI_COMMON_API_GET)
         {
-            std::string response;
+            std::string response = getResponse;
 
-            do
+            if (response.empty())
             {
-                // this line may be notification, we need to skip
-                std::getline(m_infile, response);
+                do
+                {
+                    // this line may be notification, we need to skip
+                    m_reader->getline(response);
+                }
+                while (response[response.find_first_of("|") + 1] == 'n');
             }
-            while (response[response.find_first_of("|") + 1] == 'n');
 
             try
             {
@@ -3174,10 +3662,26 @@ int SaiPlayer::replay()
         }
     }
 
-    m_infile.close();
+    flushBulk();
+
+    m_bulkCoalescer = nullptr;
+
+    m_reader = nullptr;
 
     SWSS_LOG_NOTICE("finished replaying %s with SUCCESS", filename.c_str());
 
+    if (m_replayStatistics)
+    {
+        m_replayStatistics->stop();
+
+        if (!m_replayStatistics->writeJson(m_commandLineOptions->m_benchmarkFile))
+        {
+            return -1;
+        }
+
+        m_replayStatistics = nullptr;
+    }
+
     if (m_commandLineOptions->m_sleep)
     {
         fprintf(stderr, "Reply SUCCESS, sleeping, watching for notifications\n");
@@ -3259,6 +3763,13 @@ int SaiPlayer::run()
         swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
     }
 
+    if (m_commandLineOptions->m_objectHistory.size() && m_commandLineOptions->m_files.size())
+    {
+        // only recording is inspected, nothing is replayed
+
+        return printObjectHistory(m_commandLineOptions->m_files.at(0));
+    }
+
     m_test_services = m_smt.getServiceMethodTable();
 
     EXIT_ON_ERROR(m_sai->apiInitialize(0, &m_test_services));
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "BulkCoalescer.h"
 #include "CommandLineOptions.h"
+#include "RecordingReader.h"
+#include "ReplayStatistics.h"
+
+#include "RecordingIndex.h"
 
 #include "meta/SaiInterface.h"
 #include "meta/SaiAttributeList.h"
@@ -40,6 +45,38 @@ namespace saiplayer
                     _In_ sai_common_api_t api,
                     _In_ const std::string &line);
 
+            /**
+             * @brief Append line to pending bulk in fast replay mode.
+             *
+             * Returns true if line was appended, otherwise pending bulk is
+             * executed (unless line is comment or notification) and line
+             * must be processed as usual.
+             */
+            bool coalesceBulk(
+                    _In_ char op,
+                    _In_ const std::string &line);
+
+            void flushBulk();
+
+            std::string readResponse(
+                    _In_ const std::string &line);
+
+            /**
+             * @brief Open recording index, build it if it's missing or stale.
+             */
+            std::shared_ptr<sairedis::RecordingIndex> openIndex(
+                    _In_ const std::string& filename);
+
+            /**
+             * @brief Find offset of replay start for start time option.
+             */
+            bool findStartOffset(
+                    _In_ const std::string& filename,
+                    _Out_ uint64_t& offset);
+
+            int printObjectHistory(
+                    _In_ const std::string& filename);
+
             sai_status_t handle_bulk_route(
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
@@ -82,6 +119,19 @@ namespace saiplayer
             void performSleep(
                     _In_ const std::string& line);
 
+            void performCounterPolling(
+                    _In_ const std::string& line);
+
+            void performBulkCounterPolling(
+                    _In_ const std::string& line);
+
+            std::string translateCounterKey(
+                    _In_ const std::string& key);
+
+            std::vector<swss::FieldValueTuple> getCounterPollingValues(
+                    _In_ const std::vector<std::string>& tokens,
+                    _In_ size_t first);
+
             void handle_get_response(
                     _In_ sai_object_type_t object_type,
                     _In_ uint32_t get_attr_count,
@@ -290,7 +340,12 @@ namespace saiplayer
 
             std::shared_ptr<CommandLineOptions> m_commandLineOptions;
 
-            std::ifstream m_infile;
+            std::shared_ptr<RecordingReader> m_reader;
+
+            /**
+             * @brief Pending bulk, created only in fast replay mode.
+             */
+            std::shared_ptr<BulkCoalescer> m_bulkCoalescer;
 
             std::map<sai_object_id_t,sai_object_id_t> m_local_to_redis;
             std::map<sai_object_id_t,sai_object_id_t> m_redis_to_local;
@@ -306,5 +361,10 @@ namespace saiplayer
             std::map<std::string, std::string> m_profileMap;
 
             std::map<std::string, std::string>::iterator m_profileIter;
+
+            /**
+             * @brief Replay statistics, created only in benchmark mode.
+             */
+            std::shared_ptr<ReplayStatistics> m_replayStatistics;
     };
 }
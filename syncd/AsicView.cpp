@@ -56,116 +56,137 @@ void AsicView::fromDump(
      * here right away but we would need VIDs as well.
      */
 
-    int switchesCount = 0;
-
     for (const auto &key: dump)
     {
-        auto start = key.first.find_first_of(":");
+        insertObject(key.first, key.second);
+    }
 
-        if (start == std::string::npos)
-        {
-            SWSS_LOG_THROW("failed to find colon in %s", key.first.c_str());
-        }
+    checkSwitchCount();
+}
 
-        std::shared_ptr<SaiObj> o = std::make_shared<SaiObj>();
+void AsicView::insertObject(
+        _In_ const std::string& key,
+        _In_ const swss::TableMap& map)
+{
+    SWSS_LOG_ENTER();
 
-        // TODO we could use sai deserialize object meta key
+    auto start = key.find_first_of(":");
 
-        o->m_str_object_type  = key.first.substr(0, start);
-        o->m_str_object_id    = key.first.substr(start + 1);
+    if (start == std::string::npos)
+    {
+        SWSS_LOG_THROW("failed to find colon in %s", key.c_str());
+    }
 
-        sai_deserialize_object_type(o->m_str_object_type, o->m_meta_key.objecttype);
+    std::shared_ptr<SaiObj> o = std::make_shared<SaiObj>();
 
-        o->m_info = sai_metadata_get_object_type_info(o->m_meta_key.objecttype);
+    // TODO we could use sai deserialize object meta key
 
-        /*
-         * Since neighbor/route/fdb structs objects contains OIDs, we
-         * need to increase vid reference. With new metadata for SAI
-         * 1.0 this can be done in generic way for all non object ids.
-         */
+    o->m_str_object_type  = key.substr(0, start);
+    o->m_str_object_id    = key.substr(start + 1);
 
-        switch (o->m_meta_key.objecttype)
-        {
-            case SAI_OBJECT_TYPE_FDB_ENTRY:
-                sai_deserialize_fdb_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.fdb_entry);
-                m_soFdbs[o->m_str_object_id] = o;
-                break;
+    if (m_soAll.find(o->m_str_object_id) != m_soAll.end())
+    {
+        // streaming loader can see same key twice
 
-            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-                sai_deserialize_neighbor_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.neighbor_entry);
-                m_soNeighbors[o->m_str_object_id] = o;
+        SWSS_LOG_WARN("object %s already exists in view, skipping", key.c_str());
+        return;
+    }
 
-                m_neighborsByIp[sai_serialize_ip_address(o->m_meta_key.objectkey.key.neighbor_entry.ip_address)].push_back(o->m_str_object_id);
+    sai_deserialize_object_type(o->m_str_object_type, o->m_meta_key.objecttype);
 
-                break;
+    o->m_info = sai_metadata_get_object_type_info(o->m_meta_key.objecttype);
 
-            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-                sai_deserialize_route_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.route_entry);
-                m_soRoutes[o->m_str_object_id] = o;
+    /*
+     * Since neighbor/route/fdb structs objects contains OIDs, we
+     * need to increase vid reference. With new metadata for SAI
+     * 1.0 this can be done in generic way for all non object ids.
+     */
 
-                m_routesByPrefix[sai_serialize_ip_prefix(o->m_meta_key.objectkey.key.route_entry.destination)].push_back(o->m_str_object_id);
+    switch (o->m_meta_key.objecttype)
+    {
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+            sai_deserialize_fdb_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.fdb_entry);
+            m_soFdbs[o->m_str_object_id] = o;
+            break;
 
-                break;
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            sai_deserialize_neighbor_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.neighbor_entry);
+            m_soNeighbors[o->m_str_object_id] = o;
 
-            case SAI_OBJECT_TYPE_NAT_ENTRY:
-                sai_deserialize_nat_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.nat_entry);
-                m_soNatEntries[o->m_str_object_id] = o;
-                break;
+            m_neighborsByIp[sai_serialize_ip_address(o->m_meta_key.objectkey.key.neighbor_entry.ip_address)].push_back(o->m_str_object_id);
 
-            case SAI_OBJECT_TYPE_INSEG_ENTRY:
-                sai_deserialize_inseg_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.inseg_entry);
-                m_soInsegs[o->m_str_object_id] = o;
-                break;
+            break;
 
-            default:
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+            sai_deserialize_route_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.route_entry);
+            m_soRoutes[o->m_str_object_id] = o;
 
-                if (o->m_info->isnonobjectid)
-                {
-                    SWSS_LOG_THROW("object %s is non object id, not handled, FIXME", key.first.c_str());
-                }
+            m_routesByPrefix[sai_serialize_ip_prefix(o->m_meta_key.objectkey.key.route_entry.destination)].push_back(o->m_str_object_id);
 
-                sai_deserialize_object_id(o->m_str_object_id, o->m_meta_key.objectkey.key.object_id);
+            break;
 
-                m_soOids[o->m_str_object_id] = o;
-                m_oOids[o->m_meta_key.objectkey.key.object_id] = o;
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+            sai_deserialize_nat_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.nat_entry);
+            m_soNatEntries[o->m_str_object_id] = o;
+            break;
 
-                if (o->m_meta_key.objecttype == SAI_OBJECT_TYPE_SWITCH)
-                {
-                    switchesCount++;
-                }
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+            sai_deserialize_inseg_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.inseg_entry);
+            m_soInsegs[o->m_str_object_id] = o;
+            break;
 
-                break;
-        }
+        default:
 
-        m_soAll[o->m_str_object_id] = o;
-        m_sotAll[o->m_meta_key.objecttype][o->m_str_object_id] = o;
+            if (o->m_info->isnonobjectid)
+            {
+                SWSS_LOG_THROW("object %s is non object id, not handled, FIXME", key.c_str());
+            }
 
-        if (o->m_info->isnonobjectid)
-        {
-            updateNonObjectIdVidReferenceCountByValue(o, 1);
-        }
-        else
-        {
-            /*
-             * Here is only object VID declaration, since we don't
-             * know what objects were processed previously but on
-             * some of previous object attributes this VID could be
-             * used, so value can be already greater than zero, but
-             * here we need to just mark that vid exists in
-             * vidReference.
-             */
+            sai_deserialize_object_id(o->m_str_object_id, o->m_meta_key.objectkey.key.object_id);
 
-            m_vidReference[o->m_meta_key.objectkey.key.object_id] += 0;
-        }
+            m_soOids[o->m_str_object_id] = o;
+            m_oOids[o->m_meta_key.objectkey.key.object_id] = o;
 
-        populateAttributes(o, key.second);
+            break;
     }
 
+    m_soAll[o->m_str_object_id] = o;
+    m_sotAll[o->m_meta_key.objecttype][o->m_str_object_id] = o;
+
+    if (o->m_info->isnonobjectid)
+    {
+        updateNonObjectIdVidReferenceCountByValue(o, 1);
+    }
+    else
+    {
+        /*
+         * Here is only object VID declaration, since we don't
+         * know what objects were processed previously but on
+         * some of previous object attributes this VID could be
+         * used, so value can be already greater than zero, but
+         * here we need to just mark that vid exists in
+         * vidReference.
+         */
+
+        m_vidReference[o->m_meta_key.objectkey.key.object_id] += 0;
+    }
+
+    populateAttributes(o, map);
+}
+
+void AsicView::checkSwitchCount() const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_sotAll.find(SAI_OBJECT_TYPE_SWITCH);
+
+    size_t switchesCount = (it == m_sotAll.end()) ? 0 : it->second.size();
+
     if (switchesCount != 1)
     {
         // NOTE: In our solution multiple switches are not supported in single AsicView
 
-        SWSS_LOG_THROW("only one switch is expected in ASIC view, got: %d switches", switchesCount);
+        SWSS_LOG_THROW("only one switch is expected in ASIC view, got: %zu switches", switchesCount);
     }
 }
 
@@ -620,7 +641,7 @@ void AsicView::asicSetAttribute(
             attr->getSaiAttr(),
             false);
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->m_str_object_type.str() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "set", entry);
 
@@ -751,7 +772,7 @@ void AsicView::asicCreateObject(
         entry.push_back(null);
     }
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->m_str_object_type.str() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "create", entry);
 
@@ -878,7 +899,7 @@ void AsicView::asicRemoveObject(
 
     std::vector<swss::FieldValueTuple> entry;
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->m_str_object_type.str() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "remove", entry);
 
@@ -54,6 +54,26 @@ namespace syncd
             void fromDump(
                     _In_ const swss::TableDump &dump);
 
+            /**
+             * @brief Insert single object into ASIC view.
+             *
+             * Used to build view incrementally from streamed objects,
+             * object which already exists is skipped.
+             *
+             * @param[in] key Object key, object type and object id
+             * @param[in] map Object attributes
+             */
+            void insertObject(
+                    _In_ const std::string& key,
+                    _In_ const swss::TableMap& map);
+
+            /**
+             * @brief Check if view contains exactly one switch.
+             *
+             * Throws if switch count is different.
+             */
+            void checkSwitchCount() const;
+
             void checkObjectsStatus() const;
 
             sai_object_id_t getSwitchVid() const;
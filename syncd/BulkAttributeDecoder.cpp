@@ -0,0 +1,184 @@
+#include "BulkAttributeDecoder.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <future>
+
+using namespace syncd;
+using namespace saimeta;
+
+constexpr size_t BulkAttributeDecoder::PARALLEL_MIN_OBJECTS;
+
+BulkAttributeDecoder::Arena::Arena(
+        _In_ size_t count):
+    m_storage(count),
+    m_lists(count, nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+BulkAttributeDecoder::Arena::~Arena()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto list: m_lists)
+    {
+        if (list)
+        {
+            list->~SaiAttributeList();
+        }
+    }
+}
+
+SaiAttributeList* BulkAttributeDecoder::Arena::emplace(
+        _In_ size_t index,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    // list is marked constructed only after constructor succeeded
+
+    m_lists.at(index) = new (&m_storage.at(index)) SaiAttributeList(objectType, values, false);
+
+    return m_lists[index];
+}
+
+SaiAttributeList* BulkAttributeDecoder::Arena::get(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_lists.at(index);
+}
+
+void BulkAttributeDecoder::splitAttributes(
+        _In_ const std::string& joined,
+        _Out_ std::vector<swss::FieldValueTuple>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    entries.clear();
+
+    size_t pos = 0;
+    size_t size = joined.size();
+
+    while (pos < size)
+    {
+        size_t end = joined.find('|', pos);
+
+        if (end == std::string::npos)
+        {
+            end = size;
+        }
+
+        size_t eq = joined.find('=', pos);
+
+        if (eq < end)
+        {
+            entries.emplace_back(
+                    std::string(joined, pos, eq - pos),
+                    std::string(joined, eq + 1, end - eq - 1));
+        }
+        else
+        {
+            // same as previous substr behavior, item without value
+
+            entries.emplace_back(
+                    std::string(joined, pos, end - pos),
+                    std::string(joined, pos, end - pos));
+        }
+
+        pos = end + 1;
+    }
+}
+
+void BulkAttributeDecoder::decodeRange(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ size_t begin,
+        _In_ size_t end,
+        _Inout_ Arena& arena,
+        _Inout_ std::vector<std::string>& objectIds,
+        _Inout_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        objectIds[idx] = fvField(values[idx]);
+
+        splitAttributes(fvValue(values[idx]), strAttributes[idx]);
+
+        arena.emplace(idx, objectType, strAttributes[idx]);
+    }
+}
+
+void BulkAttributeDecoder::decode(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ uint32_t threads,
+        _Out_ std::vector<std::string>& objectIds,
+        _Out_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = values.size();
+
+    objectIds.clear();
+    objectIds.resize(count);
+
+    strAttributes.clear();
+    strAttributes.resize(count);
+
+    attributes.clear();
+    attributes.reserve(count);
+
+    auto arena = std::make_shared<Arena>(count);
+
+    size_t workers = std::min<size_t>(threads ? threads : 1, count / PARALLEL_MIN_OBJECTS);
+
+    if (workers <= 1)
+    {
+        decodeRange(objectType, values, 0, count, *arena, objectIds, strAttributes);
+    }
+    else
+    {
+        // each worker fills disjoint range of already allocated vectors
+
+        size_t chunk = (count + workers - 1) / workers;
+
+        std::vector<std::future<void>> futures;
+
+        for (size_t begin = 0; begin < count; begin += chunk)
+        {
+            size_t end = std::min(count, begin + chunk);
+
+            futures.push_back(std::async(std::launch::async,
+                        &BulkAttributeDecoder::decodeRange,
+                        objectType,
+                        std::cref(values),
+                        begin,
+                        end,
+                        std::ref(*arena),
+                        std::ref(objectIds),
+                        std::ref(strAttributes)));
+        }
+
+        for (auto& future: futures)
+        {
+            future.get(); // rethrows deserialize exception
+        }
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        // lists share arena ownership, no allocation per object
+
+        attributes.emplace_back(arena, arena->get(idx));
+    }
+}
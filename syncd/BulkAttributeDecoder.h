@@ -0,0 +1,111 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/SaiAttributeList.h"
+
+#include "swss/table.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Bulk attribute decoder.
+     *
+     * Decodes bulk quad event payload (field = object id, value =
+     * attrid=value|attrid=value|...) into object ids, string attributes
+     * and attribute lists.
+     *
+     * Payload is split in place by offsets without intermediate token
+     * copies, and all attribute lists of bulk are placed in single arena
+     * which is released when last attribute list is released.
+     *
+     * Large bulks can be deserialized on multiple threads.
+     */
+    class BulkAttributeDecoder
+    {
+        private:
+
+            BulkAttributeDecoder() = delete;
+            ~BulkAttributeDecoder() = delete;
+
+        public:
+
+            /**
+             * @brief Minimum number of objects decoded by single thread.
+             */
+            static constexpr size_t PARALLEL_MIN_OBJECTS = 4096;
+
+        public:
+
+            static void decode(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ uint32_t threads,
+                    _Out_ std::vector<std::string>& objectIds,
+                    _Out_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+                    _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
+
+            /**
+             * @brief Split attrid=value|attrid=value|... into entries.
+             *
+             * Splitting follows swss::tokenize, empty input gives no
+             * entries and trailing delimiter is ignored.
+             */
+            static void splitAttributes(
+                    _In_ const std::string& joined,
+                    _Out_ std::vector<swss::FieldValueTuple>& entries);
+
+        private:
+
+            class Arena
+            {
+                private:
+
+                    Arena(const Arena&) = delete;
+                    Arena& operator=(const Arena&) = delete;
+
+                public:
+
+                    Arena(
+                            _In_ size_t count);
+
+                    ~Arena();
+
+                public:
+
+                    saimeta::SaiAttributeList* emplace(
+                            _In_ size_t index,
+                            _In_ sai_object_type_t objectType,
+                            _In_ const std::vector<swss::FieldValueTuple>& values);
+
+                    saimeta::SaiAttributeList* get(
+                            _In_ size_t index) const;
+
+                private:
+
+                    typedef std::aligned_storage<
+                        sizeof(saimeta::SaiAttributeList),
+                        alignof(saimeta::SaiAttributeList)>::type Storage;
+
+                    std::vector<Storage> m_storage;
+
+                    std::vector<saimeta::SaiAttributeList*> m_lists;
+            };
+
+            static void decodeRange(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ size_t begin,
+                    _In_ size_t end,
+                    _Inout_ Arena& arena,
+                    _Inout_ std::vector<std::string>& objectIds,
+                    _Inout_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
+    };
+}
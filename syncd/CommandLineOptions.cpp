@@ -47,6 +47,12 @@ CommandLineOptions::CommandLineOptions()
     m_supportingBulkCounterGroups = "";
 
     m_enableAttrVersionCheck = false;
+
+    m_latencyHistogramInterval = 0;
+
+    m_statsCapabilityCacheFile = "";
+
+    m_bulkDecodeThreads = 1;
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -71,6 +77,9 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " WatchdogWarnTimeSpan=" << m_watchdogWarnTimeSpan;
     ss << " SupportingBulkCounters=" << m_supportingBulkCounterGroups;
     ss << " EnableAttrVersionCheck=" << (m_enableAttrVersionCheck ? "YES" : "NO");
+    ss << " LatencyHistogramInterval=" << m_latencyHistogramInterval;
+    ss << " StatsCapabilityCacheFile=" << m_statsCapabilityCacheFile;
+    ss << " BulkDecodeThreads=" << m_bulkDecodeThreads;
 
 #ifdef SAITHRIFT
 
@@ -101,5 +101,23 @@ namespace syncd
             std::string m_supportingBulkCounterGroups;
 
             bool m_enableAttrVersionCheck;
+
+            /**
+             * Interval in seconds of latency histogram export to COUNTERS_DB,
+             * 0 disables export.
+             */
+            uint32_t m_latencyHistogramInterval;
+
+            /**
+             * File persisting stats capability probing results across
+             * restarts, empty disables cache.
+             */
+            std::string m_statsCapabilityCacheFile;
+
+            /**
+             * Number of threads used to deserialize attributes of large
+             * bulk requests, 1 decodes on processing thread.
+             */
+            uint32_t m_bulkDecodeThreads;
     };
 }
@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lL:c:D:rm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lL:c:D:h";
 #endif // SAITHRIFT
 
     while (true)
@@ -44,6 +44,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "watchdogWarnTimeSpan",    optional_argument, 0, 'w' },
             { "supportingBulkCounters",  required_argument, 0, 'B' },
             { "enableAttrVersionCheck",  no_argument,       0, 'a' },
+            { "latencyHistogramInterval", required_argument, 0, 'L' },
+            { "statsCapabilityCache",    required_argument, 0, 'c' },
+            { "bulkDecodeThreads",       required_argument, 0, 'D' },
 #ifdef SAITHRIFT
             { "rpcserver",               no_argument,       0, 'r' },
             { "portmap",                 required_argument, 0, 'm' },
@@ -143,6 +146,18 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableAttrVersionCheck = true;
                 break;
 
+            case 'L':
+                options->m_latencyHistogramInterval = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'c':
+                options->m_statsCapabilityCacheFile = std::string(optarg);
+                break;
+
+            case 'D':
+                options->m_bulkDecodeThreads = (uint32_t)std::stoul(optarg);
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -166,9 +181,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-c cacheFile] [-D threads] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-c cacheFile] [-D threads] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -203,6 +218,12 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Counter groups those support bulk polling" << std::endl;
     std::cout << "    -a --enableAttrVersionCheck" << std::endl;
     std::cout << "        Enable attribute SAI version check when performing SAI discovery" << std::endl;
+    std::cout << "    -L --latencyHistogramInterval interval" << std::endl;
+    std::cout << "        Export SAI API latency histograms to COUNTERS_DB every interval seconds, default: 0 (disabled)" << std::endl;
+    std::cout << "    -c --statsCapabilityCache cacheFile" << std::endl;
+    std::cout << "        Persist stats capability probing results in cacheFile to speed up counter registration" << std::endl;
+    std::cout << "    -D --bulkDecodeThreads threads" << std::endl;
+    std::cout << "        Number of threads deserializing attributes of large bulk requests, default: 1" << std::endl;
 
 #ifdef SAITHRIFT
 
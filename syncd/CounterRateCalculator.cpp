@@ -0,0 +1,221 @@
+#include "CounterRateCalculator.h"
+
+#include "swss/logger.h"
+#include "swss/schema.h"
+
+#include <cstdio>
+
+using namespace syncd;
+
+#define INIT_DONE_FIELD "INIT_DONE"
+
+CounterRateCalculator::CounterRateCalculator(
+        _In_ const std::string& name,
+        _In_ const std::vector<Rate>& rates):
+    m_name(name),
+    m_rates(rates),
+    m_hasAlpha(false),
+    m_alpha(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& rate: m_rates)
+    {
+        std::vector<size_t> indexes;
+
+        for (auto& counter: rate.m_counters)
+        {
+            size_t idx = 0;
+
+            while (idx < m_counters.size() && m_counters[idx] != counter)
+            {
+                idx++;
+            }
+
+            if (idx == m_counters.size())
+            {
+                m_counters.push_back(counter);
+            }
+
+            indexes.push_back(idx);
+        }
+
+        m_rateCounters.push_back(indexes);
+    }
+}
+
+std::string CounterRateCalculator::formatNumber(
+        _In_ double value)
+{
+    SWSS_LOG_ENTER();
+
+    // Lua 5.1 LUAI_NUMFFORMAT
+
+    char buffer[32];
+
+    snprintf(buffer, sizeof(buffer), "%.14g", value);
+
+    return buffer;
+}
+
+void CounterRateCalculator::setAlpha(
+        _In_ double alpha)
+{
+    SWSS_LOG_ENTER();
+
+    m_alpha = alpha;
+    m_hasAlpha = true;
+}
+
+void CounterRateCalculator::refreshConfig(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    auto alpha = db.hget(std::string(RATES_TABLE) + ":" + m_name, m_name + "_ALPHA");
+
+    if (alpha == nullptr)
+    {
+        SWSS_LOG_DEBUG("%s alpha is not defined", m_name.c_str());
+        return;
+    }
+
+    try
+    {
+        setAlpha(std::stod(*alpha));
+    }
+    catch (const std::exception&)
+    {
+        SWSS_LOG_ERROR("invalid %s alpha: %s", m_name.c_str(), alpha->c_str());
+    }
+}
+
+void CounterRateCalculator::update(
+        _In_ const std::string& vid,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ std::chrono::steady_clock::time_point now)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_hasAlpha)
+    {
+        return;
+    }
+
+    std::vector<uint64_t> current(m_counters.size());
+    std::vector<bool> found(m_counters.size(), false);
+
+    for (auto& fv: values)
+    {
+        for (size_t idx = 0; idx < m_counters.size(); idx++)
+        {
+            if (!found[idx] && fvField(fv) == m_counters[idx])
+            {
+                current[idx] = std::stoull(fvValue(fv));
+                found[idx] = true;
+                break;
+            }
+        }
+    }
+
+    for (size_t idx = 0; idx < m_counters.size(); idx++)
+    {
+        if (!found[idx])
+        {
+            SWSS_LOG_DEBUG("%s %s missing counter %s", m_name.c_str(), vid.c_str(), m_counters[idx].c_str());
+            return;
+        }
+    }
+
+    std::vector<swss::FieldValueTuple> rates;
+
+    auto it = m_objects.find(vid);
+
+    if (it == m_objects.end())
+    {
+        auto& state = m_objects[vid];
+
+        state.m_initState = InitState::COUNTERS_LAST;
+        state.m_rates.resize(m_rates.size());
+
+        m_pending.emplace_back(vid + ":" + m_name,
+                std::vector<swss::FieldValueTuple>{{INIT_DONE_FIELD, "COUNTERS_LAST"}});
+
+        it = m_objects.find(vid);
+    }
+    else
+    {
+        auto& state = it->second;
+
+        auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.m_time).count();
+
+        if (delta <= 0)
+        {
+            return;
+        }
+
+        for (size_t idx = 0; idx < m_rates.size(); idx++)
+        {
+            double diff = 0;
+
+            for (auto counter: m_rateCounters[idx])
+            {
+                diff += (double)current[counter] - (double)state.m_last[counter];
+            }
+
+            double rate = diff / (double)delta * 1000;
+
+            if (state.m_initState == InitState::DONE)
+            {
+                rate = m_alpha * rate + (1.0 - m_alpha) * state.m_rates[idx];
+            }
+
+            state.m_rates[idx] = rate;
+
+            rates.emplace_back(m_rates[idx].m_name, formatNumber(rate));
+        }
+
+        if (state.m_initState != InitState::DONE)
+        {
+            // first rates are stored unsmoothed
+
+            state.m_initState = InitState::DONE;
+
+            m_pending.emplace_back(vid + ":" + m_name,
+                    std::vector<swss::FieldValueTuple>{{INIT_DONE_FIELD, "DONE"}});
+        }
+    }
+
+    auto& state = it->second;
+
+    state.m_last = current;
+    state.m_time = now;
+
+    for (size_t idx = 0; idx < m_counters.size(); idx++)
+    {
+        rates.emplace_back(m_counters[idx] + "_last", std::to_string(current[idx]));
+    }
+
+    m_pending.emplace_back(vid, std::move(rates));
+}
+
+void CounterRateCalculator::flush(
+        _In_ swss::Table& ratesTable)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& kv: m_pending)
+    {
+        ratesTable.set(kv.first, kv.second, "");
+    }
+
+    m_pending.clear();
+}
+
+void CounterRateCalculator::remove(
+        _In_ const std::string& vid)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects.erase(vid);
+}
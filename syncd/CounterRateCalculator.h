@@ -0,0 +1,128 @@
+#pragma once
+
+#include "swss/sal.h"
+#include "swss/table.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Counter rate calculator.
+     *
+     * Native replacement of rates Lua plugins (port_rates.lua,
+     * rif_rates.lua). Rates are computed from counter values just
+     * collected and smoothed with EWMA, output is written to RATES table
+     * using same keys and fields as Lua plugins:
+     *
+     * RATES:<vid>            - rates and <counter>_last values
+     * RATES:<vid>:<name>     - INIT_DONE state
+     * RATES:<name>           - <name>_ALPHA configuration
+     */
+    class CounterRateCalculator
+    {
+        public:
+
+            /**
+             * @brief Rate of sum of counters, per second.
+             */
+            struct Rate
+            {
+                std::string m_name;
+
+                std::vector<std::string> m_counters;
+            };
+
+        public:
+
+            CounterRateCalculator(
+                    _In_ const std::string& name,
+                    _In_ const std::vector<Rate>& rates);
+
+            virtual ~CounterRateCalculator() = default;
+
+        public:
+
+            /**
+             * @brief Update rates of object from collected counter values.
+             *
+             * Objects missing any of rate counters are skipped. Nothing is
+             * computed until alpha is configured, same as Lua plugins.
+             */
+            void update(
+                    _In_ const std::string& vid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ std::chrono::steady_clock::time_point now);
+
+            /**
+             * @brief Write pending rates to RATES table.
+             */
+            void flush(
+                    _In_ swss::Table& ratesTable);
+
+            void remove(
+                    _In_ const std::string& vid);
+
+            /**
+             * @brief Read alpha from RATES:<name> in counters database.
+             */
+            void refreshConfig(
+                    _In_ swss::DBConnector& db);
+
+            void setAlpha(
+                    _In_ double alpha);
+
+            /**
+             * @brief Format number same way as Lua number converted to string.
+             */
+            static std::string formatNumber(
+                    _In_ double value);
+
+        private:
+
+            enum class InitState
+            {
+                COUNTERS_LAST,
+
+                DONE,
+            };
+
+            struct ObjectState
+            {
+                InitState m_initState;
+
+                std::vector<uint64_t> m_last;
+
+                std::vector<double> m_rates;
+
+                std::chrono::steady_clock::time_point m_time;
+            };
+
+        private:
+
+            std::string m_name;
+
+            std::vector<Rate> m_rates;
+
+            /**
+             * @brief Distinct counters used by rates.
+             */
+            std::vector<std::string> m_counters;
+
+            /**
+             * @brief Index into m_counters for each counter of each rate.
+             */
+            std::vector<std::vector<size_t>> m_rateCounters;
+
+            bool m_hasAlpha;
+
+            double m_alpha;
+
+            std::map<std::string, ObjectState> m_objects;
+
+            std::vector<std::pair<std::string, std::vector<swss::FieldValueTuple>>> m_pending;
+    };
+}
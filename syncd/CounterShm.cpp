@@ -0,0 +1,75 @@
+#include "CounterShm.h"
+
+#include "swss/logger.h"
+
+#include <cctype>
+
+using namespace syncd;
+
+constexpr uint32_t CounterShm::MAGIC;
+constexpr uint32_t CounterShm::VERSION;
+constexpr size_t CounterShm::NAME_SIZE;
+constexpr uint64_t CounterShm::INVALID_VALUE;
+constexpr const char* CounterShm::DEFAULT_DIRECTORY;
+
+std::string CounterShm::getFileName(
+        _In_ const std::string& group,
+        _In_ const std::string& directory)
+{
+    SWSS_LOG_ENTER();
+
+    std::string name = group;
+
+    for (auto& c: name)
+    {
+        if (!isalnum((unsigned char)c) && c != '-' && c != '_')
+        {
+            c = '_';
+        }
+    }
+
+    return directory + "/sonic_counters_" + name;
+}
+
+void CounterShm::initHeader(
+        _Inout_ CounterShmHeader& header,
+        _In_ uint32_t objectCount,
+        _In_ uint32_t counterCount)
+{
+    SWSS_LOG_ENTER();
+
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.sequence = 0;
+    header.stale = 0;
+    header.objectCount = objectCount;
+    header.counterCount = counterCount;
+    header.reserved = 0;
+    header.timestamp = 0;
+    header.objectsOffset = sizeof(CounterShmHeader);
+    header.namesOffset = header.objectsOffset + sizeof(uint64_t) * objectCount;
+    header.valuesOffset = header.namesOffset + NAME_SIZE * counterCount;
+    header.size = header.valuesOffset + sizeof(uint64_t) * objectCount * counterCount;
+}
+
+void* CounterShm::getAddress(
+        _In_ const void* base,
+        _In_ uint64_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    return (void*)((uintptr_t)base + offset);
+}
+
+uint64_t CounterShm::getSize(
+        _In_ uint32_t objectCount,
+        _In_ uint32_t counterCount)
+{
+    SWSS_LOG_ENTER();
+
+    CounterShmHeader header;
+
+    initHeader(header, objectCount, counterCount);
+
+    return header.size;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Shared memory counter snapshot header.
+     *
+     * File layout:
+     *
+     *   CounterShmHeader
+     *   uint64_t objectIds[objectCount]                  - rows
+     *   char names[counterCount][NAME_SIZE]              - columns
+     *   uint64_t values[counterCount][objectCount]       - column major
+     *
+     * Layout is immutable for given file, when objects or counters change
+     * writer creates new file, renames it over old one and marks old one
+     * as stale, so readers know to reopen it.
+     *
+     * Values are protected by seqlock, sequence is odd while writer is
+     * updating values.
+     */
+    struct CounterShmHeader
+    {
+        uint32_t magic;
+
+        uint32_t version;
+
+        std::atomic<uint64_t> sequence;
+
+        std::atomic<uint32_t> stale;
+
+        uint32_t objectCount;
+
+        uint32_t counterCount;
+
+        uint32_t reserved;
+
+        /**
+         * @brief Time of last update in nanoseconds since epoch.
+         */
+        std::atomic<uint64_t> timestamp;
+
+        uint64_t objectsOffset;
+
+        uint64_t namesOffset;
+
+        uint64_t valuesOffset;
+
+        uint64_t size;
+    };
+
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64 bit atomics must be lock free to be shared between processes");
+
+    class CounterShm
+    {
+        private:
+
+            CounterShm() = delete;
+
+        public:
+
+            static constexpr uint32_t MAGIC = 0x43534852; // "CSHR"
+
+            static constexpr uint32_t VERSION = 1;
+
+            static constexpr size_t NAME_SIZE = 64;
+
+            /**
+             * @brief Value of counter not collected for object.
+             */
+            static constexpr uint64_t INVALID_VALUE = UINT64_MAX;
+
+            static constexpr const char* DEFAULT_DIRECTORY = "/dev/shm";
+
+        public:
+
+            /**
+             * @brief Get snapshot file name of flex counter group.
+             */
+            static std::string getFileName(
+                    _In_ const std::string& group,
+                    _In_ const std::string& directory = DEFAULT_DIRECTORY);
+
+            /**
+             * @brief Get file size for given number of objects and counters.
+             */
+            static uint64_t getSize(
+                    _In_ uint32_t objectCount,
+                    _In_ uint32_t counterCount);
+
+            /**
+             * @brief Fill header offsets for given number of objects and counters.
+             */
+            static void initHeader(
+                    _Inout_ CounterShmHeader& header,
+                    _In_ uint32_t objectCount,
+                    _In_ uint32_t counterCount);
+
+            /**
+             * @brief Get address of section at given offset from file start.
+             */
+            static void* getAddress(
+                    _In_ const void* base,
+                    _In_ uint64_t offset);
+    };
+}
@@ -0,0 +1,229 @@
+#include "CounterShmReader.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+
+using namespace syncd;
+
+constexpr int CounterShmReader::DEFAULT_MAX_RETRIES;
+
+CounterShmReader::CounterShmReader(
+        _In_ const std::string& fileName):
+    m_fileName(fileName),
+    m_header(nullptr),
+    m_size(0),
+    m_timestamp(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+CounterShmReader::~CounterShmReader()
+{
+    SWSS_LOG_ENTER();
+
+    close();
+}
+
+bool CounterShmReader::open()
+{
+    SWSS_LOG_ENTER();
+
+    int fd = ::open(m_fileName.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(CounterShmHeader))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    uint64_t size = (uint64_t)st.st_size;
+
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    ::close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("failed to mmap %s: %s", m_fileName.c_str(), strerror(errno));
+        return false;
+    }
+
+    auto header = (const CounterShmHeader*)addr;
+
+    CounterShmHeader expected;
+
+    CounterShm::initHeader(expected, header->objectCount, header->counterCount);
+
+    if (header->magic != CounterShm::MAGIC ||
+            header->version != CounterShm::VERSION ||
+            header->size != expected.size ||
+            header->valuesOffset != expected.valuesOffset ||
+            size < header->size)
+    {
+        SWSS_LOG_ERROR("file %s is not valid counter snapshot", m_fileName.c_str());
+
+        munmap(addr, size);
+        return false;
+    }
+
+    m_header = header;
+    m_size = size;
+
+    // layout is immutable for given file, so it can be cached
+
+    auto objectIds = (const uint64_t*)CounterShm::getAddress(addr, header->objectsOffset);
+    auto names = (const char*)CounterShm::getAddress(addr, header->namesOffset);
+
+    m_objectIds.assign(objectIds, objectIds + header->objectCount);
+
+    m_counterNames.clear();
+    m_values.clear();
+    m_rows.clear();
+    m_columns.clear();
+
+    for (uint32_t row = 0; row < header->objectCount; row++)
+    {
+        m_rows[m_objectIds[row]] = row;
+    }
+
+    for (uint32_t column = 0; column < header->counterCount; column++)
+    {
+        auto name = names + (size_t)column * CounterShm::NAME_SIZE;
+
+        m_counterNames.emplace_back(name, strnlen(name, CounterShm::NAME_SIZE));
+
+        m_columns[m_counterNames.back()] = column;
+    }
+
+    return true;
+}
+
+void CounterShmReader::close()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_header)
+    {
+        munmap(const_cast<CounterShmHeader*>(m_header), m_size);
+
+        m_header = nullptr;
+        m_size = 0;
+    }
+}
+
+bool CounterShmReader::read(
+        _In_ int maxRetries)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_header && m_header->stale.load(std::memory_order_acquire))
+    {
+        // writer published new layout
+
+        close();
+    }
+
+    if (m_header == nullptr && !open())
+    {
+        return false;
+    }
+
+    size_t count = (size_t)m_header->objectCount * m_header->counterCount;
+
+    auto values = (const uint64_t*)CounterShm::getAddress(m_header, m_header->valuesOffset);
+
+    std::vector<uint64_t> snapshot(count);
+
+    for (int retry = 0; retry < maxRetries; retry++)
+    {
+        uint64_t seq1 = m_header->sequence.load(std::memory_order_acquire);
+
+        if (seq1 & 1)
+        {
+            continue;
+        }
+
+        memcpy(snapshot.data(), values, count * sizeof(uint64_t));
+
+        uint64_t timestamp = m_header->timestamp.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        uint64_t seq2 = m_header->sequence.load(std::memory_order_relaxed);
+
+        if (seq1 == seq2)
+        {
+            m_values.swap(snapshot);
+            m_timestamp = timestamp;
+
+            return true;
+        }
+    }
+
+    SWSS_LOG_WARN("failed to read consistent snapshot from %s after %d retries", m_fileName.c_str(), maxRetries);
+
+    return false;
+}
+
+const std::vector<uint64_t>& CounterShmReader::getObjectIds() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectIds;
+}
+
+const std::vector<std::string>& CounterShmReader::getCounterNames() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_counterNames;
+}
+
+bool CounterShmReader::getValue(
+        _In_ uint64_t objectId,
+        _In_ const std::string& counterName,
+        _Out_ uint64_t& value) const
+{
+    SWSS_LOG_ENTER();
+
+    auto row = m_rows.find(objectId);
+    auto column = m_columns.find(counterName);
+
+    if (row == m_rows.end() || column == m_columns.end())
+    {
+        return false;
+    }
+
+    size_t index = (size_t)column->second * m_objectIds.size() + row->second;
+
+    if (index >= m_values.size())
+    {
+        return false;
+    }
+
+    value = m_values[index];
+
+    return value != CounterShm::INVALID_VALUE;
+}
+
+uint64_t CounterShmReader::getTimestamp() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_timestamp;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CounterShm.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Shared memory counter snapshot reader.
+     *
+     * Maps snapshot file published by CounterShmWriter read only and
+     * copies consistent view of counter values without accessing redis.
+     * When writer publishes new layout, file is reopened on next read.
+     */
+    class CounterShmReader
+    {
+        private:
+
+            CounterShmReader(const CounterShmReader&) = delete;
+            CounterShmReader& operator=(const CounterShmReader&) = delete;
+
+        public:
+
+            static constexpr int DEFAULT_MAX_RETRIES = 100;
+
+        public:
+
+            CounterShmReader(
+                    _In_ const std::string& fileName);
+
+            virtual ~CounterShmReader();
+
+        public:
+
+            /**
+             * @brief Read consistent snapshot of all values.
+             *
+             * @return True if snapshot was read, false if file is not
+             * available or writer was updating values on all retries.
+             */
+            bool read(
+                    _In_ int maxRetries = DEFAULT_MAX_RETRIES);
+
+            /**
+             * @brief Objects of last read snapshot.
+             */
+            const std::vector<uint64_t>& getObjectIds() const;
+
+            /**
+             * @brief Counter names of last read snapshot.
+             */
+            const std::vector<std::string>& getCounterNames() const;
+
+            /**
+             * @brief Get value from last read snapshot.
+             *
+             * @return True if object collected given counter in last poll.
+             */
+            bool getValue(
+                    _In_ uint64_t objectId,
+                    _In_ const std::string& counterName,
+                    _Out_ uint64_t& value) const;
+
+            /**
+             * @brief Time of last read snapshot in nanoseconds since epoch.
+             */
+            uint64_t getTimestamp() const;
+
+        private:
+
+            bool open();
+
+            void close();
+
+        private:
+
+            std::string m_fileName;
+
+            const CounterShmHeader* m_header;
+
+            uint64_t m_size;
+
+            std::vector<uint64_t> m_objectIds;
+
+            std::vector<std::string> m_counterNames;
+
+            std::map<uint64_t, uint32_t> m_rows;
+
+            std::map<std::string, uint32_t> m_columns;
+
+            std::vector<uint64_t> m_values;
+
+            uint64_t m_timestamp;
+    };
+}
@@ -0,0 +1,364 @@
+#include "CounterShmWriter.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+using namespace syncd;
+
+CounterShmWriter::CounterShmWriter(
+        _In_ const std::string& fileName):
+    m_fileName(fileName),
+    m_layoutChanged(true),
+    m_header(nullptr),
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+CounterShmWriter::~CounterShmWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_header)
+    {
+        unmap(true);
+
+        unlink(m_fileName.c_str());
+    }
+}
+
+const std::string& CounterShmWriter::getFileName() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_fileName;
+}
+
+void CounterShmWriter::begin()
+{
+    SWSS_LOG_ENTER();
+
+    m_pending.clear();
+
+    m_seen.assign(m_rows.size(), false);
+
+    // layout differs from published one if previous rebuild failed
+
+    m_layoutChanged = (m_header == nullptr) ||
+        (m_header->objectCount != m_rows.size()) ||
+        (m_header->counterCount != m_columns.size());
+}
+
+void CounterShmWriter::update(
+        _In_ sai_object_id_t vid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t row;
+
+    auto it = m_rows.find(vid);
+
+    if (it == m_rows.end())
+    {
+        row = (uint32_t)m_rows.size();
+
+        m_rows[vid] = row;
+        m_seen.push_back(true);
+
+        m_layoutChanged = true;
+    }
+    else
+    {
+        row = it->second;
+
+        m_seen[row] = true;
+    }
+
+    for (auto& fv: values)
+    {
+        auto& name = fvField(fv);
+
+        uint32_t column;
+
+        auto c = m_columns.find(name);
+
+        if (c == m_columns.end())
+        {
+            if (name.size() >= CounterShm::NAME_SIZE)
+            {
+                SWSS_LOG_WARN("counter name %s too long, not exported", name.c_str());
+                continue;
+            }
+
+            column = (uint32_t)m_columns.size();
+
+            m_columns[name] = column;
+
+            m_layoutChanged = true;
+        }
+        else
+        {
+            column = c->second;
+        }
+
+        m_pending.emplace_back(row, column, strtoull(fvValue(fv).c_str(), nullptr, 10));
+    }
+}
+
+void CounterShmWriter::keep(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_rows.find(vid);
+
+    if (it != m_rows.end())
+    {
+        m_seen[it->second] = true;
+    }
+}
+
+void CounterShmWriter::commit()
+{
+    SWSS_LOG_ENTER();
+
+    if (std::find(m_seen.begin(), m_seen.end(), false) != m_seen.end())
+    {
+        // some objects were removed
+
+        m_layoutChanged = true;
+    }
+
+    if (m_layoutChanged)
+    {
+        rebuild();
+    }
+    else
+    {
+        writeValues();
+    }
+
+    m_pending.clear();
+}
+
+void CounterShmWriter::writeValues()
+{
+    SWSS_LOG_ENTER();
+
+    auto values = (uint64_t*)CounterShm::getAddress(m_header, m_header->valuesOffset);
+
+    uint32_t objectCount = m_header->objectCount;
+
+    uint64_t seq = m_header->sequence.load(std::memory_order_relaxed);
+
+    m_header->sequence.store(seq + 1, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (auto& p: m_pending)
+    {
+        values[(size_t)std::get<1>(p) * objectCount + std::get<0>(p)] = std::get<2>(p);
+    }
+
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+
+    m_header->timestamp.store((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(), std::memory_order_relaxed);
+
+    m_header->sequence.store(seq + 2, std::memory_order_release);
+}
+
+void CounterShmWriter::rebuild()
+{
+    SWSS_LOG_ENTER();
+
+    // keep only objects and counters collected or kept in current poll
+
+    std::vector<bool> usedColumns(m_columns.size(), false);
+    std::vector<bool> updatedRows(m_rows.size(), false);
+
+    for (auto& p: m_pending)
+    {
+        updatedRows[std::get<0>(p)] = true;
+        usedColumns[std::get<1>(p)] = true;
+    }
+
+    // previous values of kept objects, indexes not changed since last publish
+
+    std::vector<std::tuple<uint32_t, uint32_t, uint64_t>> keptValues;
+
+    if (m_header)
+    {
+        auto published = (const uint64_t*)CounterShm::getAddress(m_header, m_header->valuesOffset);
+
+        uint32_t publishedObjects = m_header->objectCount;
+        uint32_t publishedCounters = m_header->counterCount;
+
+        for (uint32_t row = 0; row < publishedObjects && row < m_seen.size(); row++)
+        {
+            if (!m_seen[row] || updatedRows[row])
+            {
+                continue;
+            }
+
+            for (uint32_t column = 0; column < publishedCounters; column++)
+            {
+                uint64_t value = published[(size_t)column * publishedObjects + row];
+
+                if (value != CounterShm::INVALID_VALUE)
+                {
+                    keptValues.emplace_back(row, column, value);
+
+                    usedColumns[column] = true;
+                }
+            }
+        }
+    }
+
+    std::map<sai_object_id_t, uint32_t> rows;
+    std::map<std::string, uint32_t> columns;
+
+    std::vector<uint32_t> rowMap(m_rows.size());
+    std::vector<uint32_t> columnMap(m_columns.size());
+
+    for (auto& kv: m_rows)
+    {
+        if (m_seen[kv.second])
+        {
+            rowMap[kv.second] = (uint32_t)rows.size();
+            rows[kv.first] = rowMap[kv.second];
+        }
+    }
+
+    for (auto& kv: m_columns)
+    {
+        if (usedColumns[kv.second])
+        {
+            columnMap[kv.second] = (uint32_t)columns.size();
+            columns[kv.first] = columnMap[kv.second];
+        }
+    }
+
+    uint32_t objectCount = (uint32_t)rows.size();
+    uint32_t counterCount = (uint32_t)columns.size();
+
+    uint64_t size = CounterShm::getSize(objectCount, counterCount);
+
+    std::string tmp = m_fileName + ".tmp";
+
+    int fd = open(tmp.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open %s: %s", tmp.c_str(), strerror(errno));
+        return;
+    }
+
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        SWSS_LOG_ERROR("failed to resize %s: %s", tmp.c_str(), strerror(errno));
+
+        close(fd);
+        unlink(tmp.c_str());
+        return;
+    }
+
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("failed to mmap %s: %s", tmp.c_str(), strerror(errno));
+
+        unlink(tmp.c_str());
+        return;
+    }
+
+    auto header = new (addr) CounterShmHeader();
+
+    CounterShm::initHeader(*header, objectCount, counterCount);
+
+    auto objectIds = (uint64_t*)CounterShm::getAddress(addr, header->objectsOffset);
+    auto names = (char*)CounterShm::getAddress(addr, header->namesOffset);
+    auto values = (uint64_t*)CounterShm::getAddress(addr, header->valuesOffset);
+
+    for (auto& kv: rows)
+    {
+        objectIds[kv.second] = kv.first;
+    }
+
+    for (auto& kv: columns)
+    {
+        strncpy(names + (size_t)kv.second * CounterShm::NAME_SIZE, kv.first.c_str(), CounterShm::NAME_SIZE - 1);
+    }
+
+    std::fill(values, values + (size_t)objectCount * counterCount, CounterShm::INVALID_VALUE);
+
+    for (auto& p: keptValues)
+    {
+        values[(size_t)columnMap[std::get<1>(p)] * objectCount + rowMap[std::get<0>(p)]] = std::get<2>(p);
+    }
+
+    for (auto& p: m_pending)
+    {
+        values[(size_t)columnMap[std::get<1>(p)] * objectCount + rowMap[std::get<0>(p)]] = std::get<2>(p);
+    }
+
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+
+    header->timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    header->sequence = 2;
+
+    if (rename(tmp.c_str(), m_fileName.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s: %s", tmp.c_str(), m_fileName.c_str(), strerror(errno));
+
+        munmap(addr, size);
+        unlink(tmp.c_str());
+        return;
+    }
+
+    unmap(true);
+
+    m_header = header;
+    m_size = size;
+
+    m_rows = rows;
+    m_columns = columns;
+
+    SWSS_LOG_INFO("published %s: %u objects, %u counters", m_fileName.c_str(), objectCount, counterCount);
+}
+
+void CounterShmWriter::unmap(
+        _In_ bool markStale)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_header == nullptr)
+    {
+        return;
+    }
+
+    if (markStale)
+    {
+        m_header->stale.store(1, std::memory_order_release);
+    }
+
+    munmap(m_header, m_size);
+
+    m_header = nullptr;
+    m_size = 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "CounterShm.h"
+
+#include "swss/table.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Shared memory counter snapshot writer.
+     *
+     * Collects counters of single flex counter group during poll and
+     * publishes them to memory mapped file on commit. Rows are objects
+     * and columns are counters seen in last poll.
+     */
+    class CounterShmWriter
+    {
+        private:
+
+            CounterShmWriter(const CounterShmWriter&) = delete;
+            CounterShmWriter& operator=(const CounterShmWriter&) = delete;
+
+        public:
+
+            CounterShmWriter(
+                    _In_ const std::string& fileName);
+
+            virtual ~CounterShmWriter();
+
+        public:
+
+            /**
+             * @brief Start new poll.
+             */
+            void begin();
+
+            /**
+             * @brief Add counters of object collected in current poll.
+             */
+            void update(
+                    _In_ sai_object_id_t vid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Keep previously published counters of object which
+             * failed to collect in current poll.
+             *
+             * Object is not treated as removed, so transient failure does
+             * not create new file.
+             */
+            void keep(
+                    _In_ sai_object_id_t vid);
+
+            /**
+             * @brief Publish counters collected since begin.
+             *
+             * If objects or counters changed since last commit, new file is
+             * created, otherwise values are updated in place under seqlock.
+             */
+            void commit();
+
+            const std::string& getFileName() const;
+
+        private:
+
+            void rebuild();
+
+            void writeValues();
+
+            void unmap(
+                    _In_ bool markStale);
+
+        private:
+
+            std::string m_fileName;
+
+            std::map<sai_object_id_t, uint32_t> m_rows;
+
+            std::map<std::string, uint32_t> m_columns;
+
+            /**
+             * @brief Rows updated or kept in current poll.
+             */
+            std::vector<bool> m_seen;
+
+            bool m_layoutChanged;
+
+            /**
+             * @brief Row, column and value collected in current poll.
+             */
+            std::vector<std::tuple<uint32_t, uint32_t, uint64_t>> m_pending;
+
+            CounterShmHeader* m_header;
+
+            uint64_t m_size;
+    };
+}
@@ -7,13 +7,13 @@
 #include "swss/tokenize.h"
 
 #include <inttypes.h>
+#include <cstring>
 #include <vector>
 
 using namespace syncd;
 using namespace std;
 
 #define MUTEX std::unique_lock<std::mutex> _lock(m_mtx);
-#define MUTEX_UNLOCK _lock.unlock();
 
 static const std::string COUNTER_TYPE_PORT = "Port Counter";
 static const std::string COUNTER_TYPE_PORT_DEBUG = "Port Debug Counter";
@@ -37,6 +37,9 @@ static const std::string ATTR_TYPE_ACL_COUNTER = "ACL Counter Attribute";
 static const std::string COUNTER_TYPE_WRED_ECN_QUEUE = "WRED Queue Counter";
 static const std::string COUNTER_TYPE_WRED_ECN_PORT = "WRED Port Counter";
 
+static const std::string NATIVE_RATES_FIELD = "NATIVE_RATES";
+static const std::string SHM_EXPORT_FIELD = "SHM_EXPORT";
+
 const std::map<std::string, std::string> FlexCounter::m_plugIn2CounterType = {
     {QUEUE_PLUGIN_FIELD, COUNTER_TYPE_QUEUE},
     {PG_PLUGIN_FIELD, COUNTER_TYPE_PG},
@@ -71,7 +74,8 @@ const std::map<std::tuple<sai_object_type_t, std::string>, std::string> FlexCoun
 
 BaseCounterContext::BaseCounterContext(const std::string &name, const std::string &instance):
 m_name(name),
-m_instanceId(instance)
+m_instanceId(instance),
+m_saiTime(std::chrono::steady_clock::duration::zero())
 {
     SWSS_LOG_ENTER();
 }
@@ -95,6 +99,38 @@ void BaseCounterContext::addPlugins(
     }
 }
 
+void BaseCounterContext::setRateCalculator(
+    _In_ std::shared_ptr<CounterRateCalculator> rateCalculator)
+{
+    SWSS_LOG_ENTER();
+    m_rateCalculator = rateCalculator;
+}
+
+void BaseCounterContext::flushRates(
+    _In_ swss::Table &ratesTable)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_rateCalculator)
+    {
+        m_rateCalculator->flush(ratesTable);
+    }
+}
+
+void BaseCounterContext::setStatsCapabilityCache(
+    _In_ std::shared_ptr<StatsCapabilityCache> statsCapabilityCache)
+{
+    SWSS_LOG_ENTER();
+    m_statsCapabilityCache = statsCapabilityCache;
+}
+
+void BaseCounterContext::setCounterShmWriter(
+    _In_ std::shared_ptr<CounterShmWriter> counterShmWriter)
+{
+    SWSS_LOG_ENTER();
+    m_counterShmWriter = counterShmWriter;
+}
+
 void BaseCounterContext::setNoDoubleCheckBulkCapability(
     _In_ bool noDoubleCheckBulkCapability)
 {
@@ -176,6 +212,50 @@ struct HasStatsMode
     enum { value = std::is_void<decltype(check<T>(0))>::value };
 };
 
+#define MAX_HARDWARE_INFO_LENGTH 0x1000
+
+/*
+ * Platform identification, stats capability cache is valid only on same
+ * platform. Empty string is returned if platform can't be identified, then
+ * cache is not used and capabilities are probed on SAI.
+ */
+static std::string getStatsCapabilityPlatform(
+        _In_ sairedis::SaiInterface *vendorSai,
+        _In_ sai_object_id_t switchRid)
+{
+    SWSS_LOG_ENTER();
+
+    sai_api_version_t apiVersion = SAI_VERSION(0,0,0);
+
+    if (vendorSai->queryApiVersion(&apiVersion) != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_WARN("failed to obtain libsai api version, stats capability cache not used");
+
+        return "";
+    }
+
+    char info[MAX_HARDWARE_INFO_LENGTH];
+
+    memset(info, 0, MAX_HARDWARE_INFO_LENGTH);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_SWITCH_HARDWARE_INFO;
+    attr.value.s8list.count = MAX_HARDWARE_INFO_LENGTH - 1;
+    attr.value.s8list.list = (int8_t*)info;
+
+    if (vendorSai->get(SAI_OBJECT_TYPE_SWITCH, switchRid, 1, &attr) != SAI_STATUS_SUCCESS || info[0] == 0)
+    {
+        // api version alone doesn't identify vendor SAI build
+
+        SWSS_LOG_WARN("failed to get switch hardware info, stats capability cache not used");
+
+        return "";
+    }
+
+    return "sai_api_version=" + std::to_string(apiVersion) + " hardware_info=" + std::string(info);
+}
+
 // BulkStatsContext is used to store bulk counter related
 // data and avoid construct them each time calling SAI bulk API
 template <typename StatType>
@@ -484,6 +564,8 @@ class CounterContext : public BaseCounterContext
 protected:
     sai_object_id_t m_switchId = SAI_NULL_OBJECT_ID;
 
+    bool m_statsCapabilityPlatformUnknown = false;
+
 public:
     typedef CounterIds<StatType> CounterIdsType;
     typedef BulkStatsContext<StatType> BulkContextType;
@@ -1069,6 +1151,11 @@ public:
     {
         SWSS_LOG_ENTER();
 
+        if (m_rateCalculator)
+        {
+            m_rateCalculator->remove(sai_serialize_object_id(vid));
+        }
+
         auto iter = m_objectIdsMap.find(vid);
         if (iter != m_objectIdsMap.end())
         {
@@ -1104,8 +1191,15 @@ public:
             }
 
             std::vector<uint64_t> stats(statIds.size());
-            if (!collectData(rid, statIds, effective_stats_mode, true, stats))
+            auto saiStart = std::chrono::steady_clock::now();
+            bool collected = collectData(rid, statIds, effective_stats_mode, true, stats);
+            m_saiTime += std::chrono::steady_clock::now() - saiStart;
+            if (!collected)
             {
+                if (m_counterShmWriter)
+                {
+                    m_counterShmWriter->keep(vid);
+                }
                 continue;
             }
 
@@ -1114,7 +1208,19 @@ public:
             {
                 values.emplace_back(serializeStat(statIds[i]), std::to_string(stats[i]));
             }
-            countersTable.set(sai_serialize_object_id(vid), values, "");
+
+            auto vidStr = sai_serialize_object_id(vid);
+            countersTable.set(vidStr, values, "");
+
+            if (m_rateCalculator)
+            {
+                m_rateCalculator->update(vidStr, values, std::chrono::steady_clock::now());
+            }
+
+            if (m_counterShmWriter)
+            {
+                m_counterShmWriter->update(vid, values);
+            }
         }
 
         for (const auto &kv : m_bulkContexts)
@@ -1134,6 +1240,13 @@ public:
             return;
         }
 
+        if (m_rateCalculator)
+        {
+            // rates were computed while collecting, only pick up alpha changes
+            m_rateCalculator->refreshConfig(counters_db);
+            return;
+        }
+
         SWSS_LOG_DEBUG("Before running plugin %s %s", m_instanceId.c_str(), m_name.c_str());
 
         std::vector<std::string> idStrings;
@@ -1164,6 +1277,17 @@ public:
         return !m_objectIdsMap.empty() || !m_bulkContexts.empty();
     }
 
+    size_t getObjectCount() const override
+    {
+        SWSS_LOG_ENTER();
+        size_t count = m_objectIdsMap.size();
+        for (const auto &kv : m_bulkContexts)
+        {
+            count += kv.second->object_vids.size();
+        }
+        return count;
+    }
+
 private:
     bool isCounterSupported(
             _In_ StatType counter) const
@@ -1270,6 +1394,7 @@ private:
 
         while (current < size)
         {
+            auto saiStart = std::chrono::steady_clock::now();
             sai_status_t status = m_vendorSai->bulkGetStats(
                 SAI_NULL_OBJECT_ID,
                 m_objectType,
@@ -1280,6 +1405,7 @@ private:
                 statsMode,
                 ctx.object_statuses.data() + current,
                 ctx.counters.data() + current * ctx.counter_ids.size());
+            m_saiTime += std::chrono::steady_clock::now() - saiStart;
             if (SAI_STATUS_SUCCESS != status)
             {
                 SWSS_LOG_WARN("Failed to bulk get stats for %s %s %s %s starting object %u bulk chunk size %u: %d",
@@ -1297,7 +1423,8 @@ private:
 
         SWSS_LOG_INFO("After getting bulk %s %s %s total %u objects", m_instanceId.c_str(), m_name.c_str(), ctx.name.c_str(), size);
 
-        auto time_stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto now = std::chrono::steady_clock::now();
+        auto time_stamp = now.time_since_epoch().count();
 
         std::vector<swss::FieldValueTuple> values;
         for (size_t i = 0; i < ctx.object_keys.size(); i++)
@@ -1305,6 +1432,10 @@ private:
             if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
             {
                 SWSS_LOG_ERROR("Failed to get stats of %s 0x%" PRIx64 " 0x%" PRIx64 ": %d", m_name.c_str(), ctx.object_vids[i], ctx.object_keys[i].key.object_id, ctx.object_statuses[i]);
+                if (m_counterShmWriter)
+                {
+                    m_counterShmWriter->keep(ctx.object_vids[i]);
+                }
                 continue;
             }
             const auto &vid = ctx.object_vids[i];
@@ -1314,7 +1445,19 @@ private:
                 values.emplace_back(serializeStat(ctx.counter_ids[j]), std::to_string(ctx.counters[i * ctx.counter_ids.size() + j]));
             }
 
-            countersTable.set(sai_serialize_object_id(vid), values, "");
+            auto vidStr = sai_serialize_object_id(vid);
+            countersTable.set(vidStr, values, "");
+
+            if (m_rateCalculator)
+            {
+                m_rateCalculator->update(vidStr, values, now);
+            }
+
+            if (m_counterShmWriter)
+            {
+                m_counterShmWriter->update(vid, values);
+            }
+
             values.clear();
         }
 
@@ -1445,10 +1588,17 @@ private:
             _In_ const std::vector<StatType>& counter_ids)
     {
         SWSS_LOG_ENTER();
+        auto statsMode = m_groupStatsMode == SAI_STATS_MODE_READ ? SAI_STATS_MODE_BULK_READ : SAI_STATS_MODE_BULK_READ_AND_CLEAR;
+        std::vector<uint32_t> cacheCounterIds(counter_ids.begin(), counter_ids.end());
+        bool supported;
+        if (hasStatsCapabilityCache(rid) &&
+            m_statsCapabilityCache->getBulkSupport(m_objectType, statsMode, cacheCounterIds, supported))
+        {
+            return supported;
+        }
         BulkContextType ctx;
         ctx.counter_ids = counter_ids;
         addBulkStatsContext(vid, rid, counter_ids, ctx);
-        auto statsMode = m_groupStatsMode == SAI_STATS_MODE_READ ? SAI_STATS_MODE_BULK_READ : SAI_STATS_MODE_BULK_READ_AND_CLEAR;
         sai_status_t status = m_vendorSai->bulkGetStats(
                             SAI_NULL_OBJECT_ID,
                             m_objectType,
@@ -1459,9 +1609,49 @@ private:
                             statsMode,
                             ctx.object_statuses.data(),
                             ctx.counters.data());
+        // other failures can be transient, so bulk support is probed again next time
+        if (m_statsCapabilityCache &&
+            (status == SAI_STATUS_SUCCESS || status == SAI_STATUS_NOT_SUPPORTED || status == SAI_STATUS_NOT_IMPLEMENTED))
+        {
+            m_statsCapabilityCache->setBulkSupport(m_objectType, statsMode, cacheCounterIds, status == SAI_STATUS_SUCCESS);
+        }
         return status == SAI_STATUS_SUCCESS;
     }
 
+    bool hasStatsCapabilityCache(
+            _In_ sai_object_id_t rid)
+    {
+        SWSS_LOG_ENTER();
+
+        if (!m_statsCapabilityCache || m_statsCapabilityPlatformUnknown)
+        {
+            return false;
+        }
+
+        if (!m_statsCapabilityCache->hasPlatform())
+        {
+            if (m_switchId == SAI_NULL_OBJECT_ID)
+            {
+                m_switchId = m_vendorSai->switchIdQuery(rid);
+            }
+
+            auto platform = getStatsCapabilityPlatform(m_vendorSai, m_switchId);
+
+            if (platform.empty())
+            {
+                // don't drop cache loaded from file, platform may be known after restart
+
+                m_statsCapabilityPlatformUnknown = true;
+
+                return false;
+            }
+
+            m_statsCapabilityCache->setPlatform(platform);
+        }
+
+        return true;
+    }
+
     void updateSupportedCounters(
             _In_ sai_object_id_t rid,
             _In_ const std::vector<StatType>& counter_ids,
@@ -1492,6 +1682,17 @@ private:
             _Out_ std::set<StatType> &supportedCounters)
     {
         SWSS_LOG_ENTER();
+        std::set<uint32_t> cachedCounters;
+        if (hasStatsCapabilityCache(rid) &&
+            m_statsCapabilityCache->getCapability(m_objectType, stats_mode, cachedCounters))
+        {
+            for (auto counter : cachedCounters)
+            {
+                supportedCounters.insert(static_cast<StatType>(counter));
+            }
+            return SAI_STATUS_SUCCESS;
+        }
+
         sai_stat_capability_list_t stats_capability;
         stats_capability.count = 0;
         stats_capability.list = nullptr;
@@ -1535,6 +1736,12 @@ private:
 
                     StatType counter = static_cast<StatType>(statCapability.stat_enum);
                     supportedCounters.insert(counter);
+                    cachedCounters.insert(statCapability.stat_enum);
+                }
+
+                if (m_statsCapabilityCache)
+                {
+                    m_statsCapabilityCache->setCapability(m_objectType, stats_mode, cachedCounters);
                 }
             }
         }
@@ -1549,6 +1756,9 @@ private:
         SWSS_LOG_ENTER();
         std::vector<uint64_t> values(1);
 
+        // probe results may differ per object when always checking supported counters
+        bool useCache = !always_check_supported_counters && hasStatsCapabilityCache(rid);
+
         for (const auto &counter : counter_ids)
         {
             if (isCounterSupported(counter))
@@ -1556,13 +1766,22 @@ private:
                 continue;
             }
 
-            std::vector<StatType> tmp_counter_ids {counter};
-            if (!collectData(rid, tmp_counter_ids, stats_mode, false, values))
+            bool supported;
+            if (!useCache || !m_statsCapabilityCache->getCounterSupport(m_objectType, stats_mode, counter, supported))
             {
-                continue;
+                std::vector<StatType> tmp_counter_ids {counter};
+                supported = collectData(rid, tmp_counter_ids, stats_mode, false, values);
+
+                if (useCache)
+                {
+                    m_statsCapabilityCache->setCounterSupport(m_objectType, stats_mode, counter, supported);
+                }
             }
 
-            m_supportedCounters.insert(counter);
+            if (supported)
+            {
+                m_supportedCounters.insert(counter);
+            }
         }
     }
 
@@ -1653,11 +1872,13 @@ public:
             }
 
             // Get attr
+            auto saiStart = std::chrono::steady_clock::now();
             sai_status_t status = Base::m_vendorSai->get(
                     Base::m_objectType,
                     rid,
                     static_cast<uint32_t>(attrIds.size()),
                     attrs.data());
+            Base::m_saiTime += std::chrono::steady_clock::now() - saiStart;
 
             if (status != SAI_STATUS_SUCCESS)
             {
@@ -1827,6 +2048,12 @@ public:
         return !m_bulkMeterContexts.empty();
     }
 
+    size_t getObjectCount() const override
+    {
+        SWSS_LOG_ENTER();
+        return m_bulkMeterContexts.size();
+    }
+
 private:
     struct BulkMeterStatsContext
     {
@@ -1849,6 +2076,7 @@ private:
 
         auto statsMode = m_groupStatsMode == SAI_STATS_MODE_READ ? SAI_STATS_MODE_BULK_READ : SAI_STATS_MODE_BULK_READ_AND_CLEAR;
 
+        auto saiStart = std::chrono::steady_clock::now();
         sai_status_t status = m_vendorSai->bulkGetStats(
             SAI_NULL_OBJECT_ID,
             m_objectType,
@@ -1859,6 +2087,7 @@ private:
             statsMode,
             ctx.object_statuses.data(),
             ctx.counters.data());
+        m_saiTime += std::chrono::steady_clock::now() - saiStart;
 
         if (SAI_STATUS_SUCCESS != status)
         {
@@ -2048,27 +2277,52 @@ FlexCounter::FlexCounter(
         _In_ const std::string& instanceId,
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ const std::string& dbCounters,
-        _In_ const bool noDoubleCheckBulkCapability):
-    m_readyToPoll(false),
+        _In_ const bool noDoubleCheckBulkCapability,
+        _In_ std::shared_ptr<FlexCounterScheduler> scheduler):
+    m_scheduler(scheduler),
     m_pollInterval(0),
     m_instanceId(instanceId),
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters),
-    m_noDoubleCheckBulkCapability(noDoubleCheckBulkCapability)
+    m_noDoubleCheckBulkCapability(noDoubleCheckBulkCapability),
+    m_pollStats(instanceId)
 {
     SWSS_LOG_ENTER();
 
     m_enable = false;
+    m_nativeRates = false;
     m_isDiscarded = false;
 
-    startFlexCounterThread();
+    if (m_scheduler == nullptr)
+    {
+        m_scheduler = std::make_shared<FlexCounterScheduler>(dbCounters, 1);
+    }
+
+    m_scheduler->addClient(this);
 }
 
 FlexCounter::~FlexCounter(void)
 {
     SWSS_LOG_ENTER();
 
-    endFlexCounterThread();
+    // waits for poll in progress to finish
+
+    m_scheduler->removeClient(this);
+
+    // group will not be polled again, don't leave its poll stats behind
+
+    try
+    {
+        swss::DBConnector db(m_dbCounters, 0);
+        swss::RedisPipeline pipeline(&db);
+        swss::Table pollStatsTable(&pipeline, FlexCounterPollStats::POLL_STATS_TABLE, false);
+
+        m_pollStats.remove(pollStatsTable);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("FC %s failed to remove poll stats: %s", m_instanceId.c_str(), e.what());
+    }
 }
 
 void FlexCounter::setPollInterval(
@@ -2098,6 +2352,102 @@ void FlexCounter::setStatus(
     }
 }
 
+static std::shared_ptr<CounterRateCalculator> createRateCalculator(
+        _In_ const std::string& contextName)
+{
+    SWSS_LOG_ENTER();
+
+    // same rates as port_rates.lua and rif_rates.lua
+
+    if (contextName == COUNTER_TYPE_PORT)
+    {
+        return std::make_shared<CounterRateCalculator>("PORT", std::vector<CounterRateCalculator::Rate>{
+                {"RX_BPS", {"SAI_PORT_STAT_IF_IN_OCTETS"}},
+                {"RX_PPS", {"SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS"}},
+                {"TX_BPS", {"SAI_PORT_STAT_IF_OUT_OCTETS"}},
+                {"TX_PPS", {"SAI_PORT_STAT_IF_OUT_UCAST_PKTS", "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS"}}});
+    }
+
+    if (contextName == COUNTER_TYPE_RIF)
+    {
+        return std::make_shared<CounterRateCalculator>("RIF", std::vector<CounterRateCalculator::Rate>{
+                {"RX_BPS", {"SAI_ROUTER_INTERFACE_STAT_IN_OCTETS"}},
+                {"RX_PPS", {"SAI_ROUTER_INTERFACE_STAT_IN_PACKETS"}},
+                {"TX_BPS", {"SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS"}},
+                {"TX_PPS", {"SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS"}}});
+    }
+
+    return nullptr;
+}
+
+void FlexCounter::setNativeRates(
+        _In_ const std::string& status)
+{
+    SWSS_LOG_ENTER();
+
+    bool nativeRates;
+
+    if (status == "enable")
+    {
+        nativeRates = true;
+    }
+    else if (status == "disable")
+    {
+        nativeRates = false;
+    }
+    else
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter native rates, enter enable or disable", status.c_str());
+        return;
+    }
+
+    if (nativeRates == m_nativeRates)
+    {
+        return;
+    }
+
+    m_nativeRates = nativeRates;
+
+    SWSS_LOG_NOTICE("Native rates %s for FC %s", status.c_str(), m_instanceId.c_str());
+
+    for (auto &kv : m_counterContext)
+    {
+        kv.second->setRateCalculator(m_nativeRates ? createRateCalculator(kv.first) : nullptr);
+    }
+}
+
+void FlexCounter::setShmExport(
+        _In_ const std::string& status)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<CounterShmWriter> counterShmWriter;
+
+    if (status == "enable")
+    {
+        if (m_counterShmWriter)
+        {
+            return;
+        }
+
+        counterShmWriter = std::make_shared<CounterShmWriter>(CounterShm::getFileName(m_instanceId));
+    }
+    else if (status != "disable")
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter shared memory export, enter enable or disable", status.c_str());
+        return;
+    }
+
+    m_counterShmWriter = counterShmWriter;
+
+    SWSS_LOG_NOTICE("Shared memory export %s for FC %s", status.c_str(), m_instanceId.c_str());
+
+    for (auto &kv : m_counterContext)
+    {
+        kv.second->setCounterShmWriter(m_counterShmWriter);
+    }
+}
+
 void FlexCounter::setStatsMode(
         _In_ const std::string& mode)
 {
@@ -2212,6 +2562,14 @@ void FlexCounter::addCounterPlugin(
         {
             setStatsMode(value);
         }
+        else if (field == NATIVE_RATES_FIELD)
+        {
+            setNativeRates(value);
+        }
+        else if (field == SHM_EXPORT_FIELD)
+        {
+            setShmExport(value);
+        }
         else
         {
             auto counterTypeRef = m_plugIn2CounterType.find(field);
@@ -2259,6 +2617,21 @@ bool FlexCounter::isEmpty()
     return allIdsEmpty() && allPluginsEmpty();
 }
 
+void FlexCounter::setStatsCapabilityCache(
+        _In_ std::shared_ptr<StatsCapabilityCache> statsCapabilityCache)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_statsCapabilityCache = statsCapabilityCache;
+
+    for (auto &kv : m_counterContext)
+    {
+        kv.second->setStatsCapabilityCache(statsCapabilityCache);
+    }
+}
+
 bool FlexCounter::isDiscarded()
 {
     SWSS_LOG_ENTER();
@@ -2449,6 +2822,21 @@ std::shared_ptr<BaseCounterContext> FlexCounter::getCounterContext(
         SWSS_LOG_NOTICE("Do not double check bulk capability counter context %s %s", m_instanceId.c_str(), name.c_str());
     }
 
+    if (m_nativeRates)
+    {
+        counterContext->setRateCalculator(createRateCalculator(name));
+    }
+
+    if (m_statsCapabilityCache)
+    {
+        counterContext->setStatsCapabilityCache(m_statsCapabilityCache);
+    }
+
+    if (m_counterShmWriter)
+    {
+        counterContext->setCounterShmWriter(m_counterShmWriter);
+    }
+
     auto ret = m_counterContext.emplace(name, counterContext);
     return ret.first->second;
 }
@@ -2462,6 +2850,7 @@ void FlexCounter::removeCounterContext(
     if (iter != m_counterContext.end())
     {
         m_counterContext.erase(iter);
+        m_pollStats.removeContext(name);
     }
     else
     {
@@ -2477,16 +2866,35 @@ bool FlexCounter::hasCounterContext(
 }
 
 void FlexCounter::collectCounters(
-        _In_ swss::Table &countersTable)
+        _In_ swss::Table &countersTable,
+        _In_ swss::Table &ratesTable)
 {
     SWSS_LOG_ENTER();
 
+    if (m_counterShmWriter)
+    {
+        m_counterShmWriter->begin();
+    }
+
     for (const auto &it : m_counterContext)
     {
+        auto start = std::chrono::steady_clock::now();
+
+        it.second->resetSaiTime();
         it.second->collectData(countersTable);
+        it.second->flushRates(ratesTable);
+
+        m_pollStats.recordContext(
+                it.first,
+                it.second->getObjectCount(),
+                std::chrono::steady_clock::now() - start,
+                it.second->getSaiTime());
     }
 
-    countersTable.flush();
+    if (m_counterShmWriter)
+    {
+        m_counterShmWriter->commit();
+    }
 }
 
 void FlexCounter::runPlugins(
@@ -2507,91 +2915,46 @@ void FlexCounter::runPlugins(
     }
 }
 
-void FlexCounter::flexCounterThreadRunFunction()
+uint32_t FlexCounter::pollCounters(
+        _In_ swss::Table& countersTable,
+        _In_ swss::Table& ratesTable,
+        _In_ swss::Table& pollStatsTable)
 {
-    SWSS_LOG_ENTER();
+    MUTEX;
 
-    swss::DBConnector db(m_dbCounters, 0);
-    swss::RedisPipeline pipeline(&db);
-    swss::Table countersTable(&pipeline, COUNTERS_TABLE, true);
+    SWSS_LOG_ENTER();
 
-    while (m_runFlexCounterThread)
+    if (!m_enable || allIdsEmpty() || (m_pollInterval == 0))
     {
-        MUTEX;
-
-        if (m_enable && !allIdsEmpty() && (m_pollInterval > 0))
-        {
-            auto start = std::chrono::steady_clock::now();
-
-            collectCounters(countersTable);
-
-            runPlugins(db);
-
-            auto finish = std::chrono::steady_clock::now();
-
-            uint32_t delay = static_cast<uint32_t>(
-                    std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
-
-            uint32_t correction = delay % m_pollInterval;
-            correction = m_pollInterval - correction;
-            MUTEX_UNLOCK; // explicit unlock
-
-            SWSS_LOG_DEBUG("End of flex counter thread FC %s, took %d ms", m_instanceId.c_str(), delay);
-
-            std::unique_lock<std::mutex> lk(m_mtxSleep);
-
-            m_cvSleep.wait_for(lk, std::chrono::milliseconds(correction));
-
-            continue;
-        }
-
-        MUTEX_UNLOCK; // explicit unlock
-
         // nothing to collect, wait until notified
-        waitPoll();
+        m_pollStats.reset();
+        return 0;
     }
-}
 
-void FlexCounter::startFlexCounterThread()
-{
-    SWSS_LOG_ENTER();
+    auto start = std::chrono::steady_clock::now();
+
+    collectCounters(countersTable, ratesTable);
+
+    auto finish = std::chrono::steady_clock::now();
 
-    m_runFlexCounterThread = true;
+    SWSS_LOG_DEBUG("Collected counters FC %s, took %d ms",
+            m_instanceId.c_str(),
+            (int)std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
 
-    m_flexCounterThread = std::make_shared<std::thread>(&FlexCounter::flexCounterThreadRunFunction, this);
+    m_pollStats.recordPoll(start, finish - start, m_pollInterval);
+    m_pollStats.publish(pollStatsTable);
 
-    SWSS_LOG_INFO("Flex Counter thread started");
+    return m_pollInterval;
 }
 
-void FlexCounter::endFlexCounterThread(void)
+void FlexCounter::runPollPlugins(
+        _In_ swss::DBConnector& db)
 {
-    SWSS_LOG_ENTER();
-
     MUTEX;
 
-    if (!m_runFlexCounterThread)
-    {
-        return;
-    }
-
-    m_runFlexCounterThread = false;
-
-    notifyPoll();
-
-    m_cvSleep.notify_all();
-
-    if (m_flexCounterThread != nullptr)
-    {
-        auto fcThread = std::move(m_flexCounterThread);
-
-        MUTEX_UNLOCK; // NOTE: explicit unlock before join to not cause deadlock
-
-        SWSS_LOG_INFO("Wait for Flex Counter thread to end");
-
-        fcThread->join();
-    }
+    SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("Flex Counter thread ended");
+    runPlugins(db);
 }
 
 void FlexCounter::removeCounter(
@@ -2860,18 +3223,9 @@ void FlexCounter::bulkAddCounter(
     notifyPoll();
 }
 
-void FlexCounter::waitPoll()
-{
-    SWSS_LOG_ENTER();
-    std::unique_lock<std::mutex> lk(m_mtxSleep);
-    m_pollCond.wait(lk, [&](){return m_readyToPoll;});
-    m_readyToPoll = false;
-}
-
 void FlexCounter::notifyPoll()
 {
     SWSS_LOG_ENTER();
-    std::unique_lock<std::mutex> lk(m_mtxSleep);
-    m_readyToPoll = true;
-    m_pollCond.notify_all();
+
+    m_scheduler->notify(this);
 }
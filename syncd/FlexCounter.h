@@ -6,11 +6,18 @@ extern "C" {
 
 #include "meta/SaiInterface.h"
 
+#include "FlexCounterScheduler.h"
+#include "CounterRateCalculator.h"
+#include "StatsCapabilityCache.h"
+#include "CounterShmWriter.h"
+#include "FlexCounterPollStats.h"
+
 #include "swss/table.h"
 
+#include <chrono>
 #include <vector>
 #include <set>
-#include <condition_variable>
+#include <mutex>
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
@@ -35,6 +42,24 @@ namespace syncd
 
         bool hasPlugin() const {return !m_plugins.empty();}
 
+        /**
+         * @brief Compute rates natively instead of running Lua plugins.
+         */
+        void setRateCalculator(
+            _In_ std::shared_ptr<CounterRateCalculator> rateCalculator);
+
+        void flushRates(
+            _In_ swss::Table &ratesTable);
+
+        void setStatsCapabilityCache(
+            _In_ std::shared_ptr<StatsCapabilityCache> statsCapabilityCache);
+
+        /**
+         * @brief Export collected counters to shared memory snapshot.
+         */
+        void setCounterShmWriter(
+            _In_ std::shared_ptr<CounterShmWriter> counterShmWriter);
+
         void removePlugins() {m_plugins.clear();}
 
         virtual void addObject(
@@ -61,11 +86,24 @@ namespace syncd
 
         virtual bool hasObject() const = 0;
 
+        virtual size_t getObjectCount() const = 0;
+
+        /**
+         * @brief Time spent in vendor SAI since last reset.
+         */
+        std::chrono::steady_clock::duration getSaiTime() const {return m_saiTime;}
+
+        void resetSaiTime() {m_saiTime = std::chrono::steady_clock::duration::zero();}
+
     protected:
         std::string m_name;
         std::string m_instanceId;
         std::set<std::string> m_plugins;
         std::string m_bulkChunkSizePerPrefix;
+        std::shared_ptr<CounterRateCalculator> m_rateCalculator;
+        std::shared_ptr<StatsCapabilityCache> m_statsCapabilityCache;
+        std::shared_ptr<CounterShmWriter> m_counterShmWriter;
+        std::chrono::steady_clock::duration m_saiTime;
 
     public:
         bool always_check_supported_counters = false;
@@ -76,17 +114,25 @@ namespace syncd
         bool dont_clear_support_counter  = false;
         uint32_t default_bulk_chunk_size;
     };
-    class FlexCounter
+    class FlexCounter:
+        public FlexCounterScheduler::Client
     {
         private:
             FlexCounter(const FlexCounter&) = delete;
 
         public:
+            /**
+             * @brief Create flex counter group.
+             *
+             * When scheduler is not provided, group is polled by its own
+             * single worker scheduler.
+             */
             FlexCounter(
                     _In_ const std::string& instanceId,
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
                     _In_ const std::string& dbCounters,
-                    _In_ const bool noDoubleCheckBulkCapability=false);
+                    _In_ const bool noDoubleCheckBulkCapability=false,
+                    _In_ std::shared_ptr<FlexCounterScheduler> scheduler=nullptr);
 
             virtual ~FlexCounter();
 
@@ -114,6 +160,22 @@ namespace syncd
 
             bool isDiscarded();
 
+            /**
+             * @brief Use cache to skip stats capability probing.
+             */
+            void setStatsCapabilityCache(
+                    _In_ std::shared_ptr<StatsCapabilityCache> statsCapabilityCache);
+
+        public: // FlexCounterScheduler::Client
+
+            virtual uint32_t pollCounters(
+                    _In_ swss::Table& countersTable,
+                    _In_ swss::Table& ratesTable,
+                    _In_ swss::Table& pollStatsTable) override;
+
+            virtual void runPollPlugins(
+                    _In_ swss::DBConnector& db) override;
+
         private:
 
             void setPollInterval(
@@ -125,6 +187,12 @@ namespace syncd
             void setStatsMode(
                     _In_ const std::string& mode);
 
+            void setNativeRates(
+                    _In_ const std::string& status);
+
+            void setShmExport(
+                    _In_ const std::string& status);
+
         private:
             bool allIdsEmpty() const;
 
@@ -150,37 +218,20 @@ namespace syncd
                     _In_ const std::string &name) const;
 
             void collectCounters(
-                    _In_ swss::Table &countersTable);
+                    _In_ swss::Table &countersTable,
+                    _In_ swss::Table &ratesTable);
 
             void runPlugins(
                     _In_ swss::DBConnector& db);
 
-            void startFlexCounterThread();
-
-            void endFlexCounterThread();
-
-            void flexCounterThreadRunFunction();
-
         private:
-            void waitPoll();
-
             void notifyPoll();
 
         private:
-            bool m_runFlexCounterThread;
-
-            std::shared_ptr<std::thread> m_flexCounterThread;
-
-            std::mutex m_mtxSleep;
-
-            std::condition_variable m_cvSleep;
+            std::shared_ptr<FlexCounterScheduler> m_scheduler;
 
             std::mutex m_mtx;
 
-            std::condition_variable m_pollCond;
-
-            bool m_readyToPoll;
-
             uint32_t m_pollInterval;
 
             std::string m_instanceId;
@@ -189,6 +240,8 @@ namespace syncd
 
             bool m_enable;
 
+            bool m_nativeRates;
+
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
 
             std::string m_dbCounters;
@@ -199,6 +252,12 @@ namespace syncd
 
             bool m_noDoubleCheckBulkCapability;
 
+            std::shared_ptr<StatsCapabilityCache> m_statsCapabilityCache;
+
+            std::shared_ptr<CounterShmWriter> m_counterShmWriter;
+
+            FlexCounterPollStats m_pollStats;
+
             static const std::map<std::string, std::string> m_plugIn2CounterType;
 
             static const std::map<std::tuple<sai_object_type_t, std::string>, std::string> m_objectTypeField2CounterType;
@@ -10,14 +10,20 @@ using namespace syncd;
 FlexCounterManager::FlexCounterManager(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ const std::string& dbCounters,
-        _In_ const std::string& supportingBulkInstances):
+        _In_ const std::string& supportingBulkInstances,
+        _In_ const std::string& statsCapabilityCacheFile):
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters),
     m_supportingBulkGroups(supportingBulkInstances)
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    m_scheduler = std::make_shared<FlexCounterScheduler>(dbCounters);
+
+    if (!statsCapabilityCacheFile.empty())
+    {
+        m_statsCapabilityCache = std::make_shared<StatsCapabilityCache>(statsCapabilityCacheFile);
+    }
 }
 
 std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
@@ -30,7 +36,12 @@ std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
     if (m_flexCounters.count(instanceId) == 0)
     {
         bool supportingBulk = (m_supportingBulkGroups.find(instanceId) != std::string::npos);
-        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters, supportingBulk);
+        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters, supportingBulk, m_scheduler);
+
+        if (m_statsCapabilityCache)
+        {
+            counter->setStatsCapabilityCache(m_statsCapabilityCache);
+        }
 
         m_flexCounters[instanceId] = counter;
     }
@@ -95,6 +106,11 @@ void FlexCounterManager::addCounter(
 
     fc->addCounter(vid, rid, values);
 
+    if (m_statsCapabilityCache)
+    {
+        m_statsCapabilityCache->save();
+    }
+
     if (fc->isDiscarded())
     {
         removeInstance(instanceId);
@@ -115,6 +131,11 @@ void FlexCounterManager::bulkAddCounter(
 
     fc->bulkAddCounter(objectType, vids, rids, values);
 
+    if (m_statsCapabilityCache)
+    {
+        m_statsCapabilityCache->save();
+    }
+
     if (fc->isDiscarded())
     {
         removeInstance(instanceId);
@@ -11,7 +11,8 @@ namespace syncd
             FlexCounterManager(
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
                     _In_ const std::string& dbCounters,
-                    _In_ const std::string& supportingBulkInstances);
+                    _In_ const std::string& supportingBulkInstances,
+                    _In_ const std::string& statsCapabilityCacheFile = "");
 
             virtual ~FlexCounterManager() = default;
 
@@ -59,6 +60,16 @@ namespace syncd
                 std::string m_dbCounters;
 
                 std::string m_supportingBulkGroups;
+
+                /**
+                 * @brief Scheduler shared by all flex counter groups.
+                 */
+                std::shared_ptr<FlexCounterScheduler> m_scheduler;
+
+                /**
+                 * @brief Persistent stats capability cache, null if disabled.
+                 */
+                std::shared_ptr<StatsCapabilityCache> m_statsCapabilityCache;
     };
 }
 
@@ -0,0 +1,215 @@
+#include "FlexCounterPollStats.h"
+
+#include "meta/LatencyHistogramExporter.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+constexpr const char* FlexCounterPollStats::POLL_STATS_TABLE;
+
+void FlexCounterPollStats::Timing::record(
+        _In_ std::chrono::steady_clock::duration duration)
+{
+    SWSS_LOG_ENTER();
+
+    m_last = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    m_sum += m_last;
+    m_max = std::max(m_max, m_last);
+    m_count++;
+}
+
+uint64_t FlexCounterPollStats::Timing::average() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count ? m_sum / m_count : 0;
+}
+
+FlexCounterPollStats::FlexCounterPollStats(
+        _In_ const std::string& group):
+    m_group(group),
+    m_pollCount(0),
+    m_missedDeadlines(0),
+    m_pollInterval(0),
+    m_lastSlot(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void FlexCounterPollStats::recordPoll(
+        _In_ std::chrono::steady_clock::time_point start,
+        _In_ std::chrono::steady_clock::duration collectTime,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    if (pollInterval == 0)
+    {
+        return;
+    }
+
+    m_pollCount++;
+
+    m_collectTime.record(collectTime);
+
+    m_histogram.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(collectTime).count());
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(start.time_since_epoch()).count();
+
+    uint64_t slot = (uint64_t)ms / pollInterval + 1;
+
+    if (m_lastSlot && pollInterval == m_pollInterval && slot > m_lastSlot + 1)
+    {
+        uint64_t missed = slot - m_lastSlot - 1;
+
+        m_missedDeadlines += missed;
+
+        SWSS_LOG_INFO("FC %s missed %" PRIu64 " poll deadlines, last collection took %" PRIu64 " us, poll interval %u ms",
+                m_group.c_str(),
+                missed,
+                m_collectTime.m_last,
+                pollInterval);
+    }
+
+    m_lastSlot = slot;
+    m_pollInterval = pollInterval;
+}
+
+void FlexCounterPollStats::recordContext(
+        _In_ const std::string& context,
+        _In_ size_t objectCount,
+        _In_ std::chrono::steady_clock::duration collectTime,
+        _In_ std::chrono::steady_clock::duration saiTime)
+{
+    SWSS_LOG_ENTER();
+
+    auto& stats = m_contexts[context];
+
+    stats.m_objectCount = objectCount;
+    stats.m_collectTime.record(collectTime);
+    stats.m_saiTime.record(saiTime);
+    stats.m_redisTime.record(collectTime > saiTime ? collectTime - saiTime : std::chrono::steady_clock::duration::zero());
+
+    m_removedContexts.erase(context);
+}
+
+void FlexCounterPollStats::removeContext(
+        _In_ const std::string& context)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_contexts.erase(context))
+    {
+        m_removedContexts.insert(context);
+    }
+}
+
+void FlexCounterPollStats::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_lastSlot = 0;
+}
+
+void FlexCounterPollStats::publish(
+        _In_ swss::Table& table)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("POLL_INTERVAL", std::to_string(m_pollInterval));
+    values.emplace_back("POLL_COUNT", std::to_string(m_pollCount));
+    values.emplace_back("MISSED_DEADLINES", std::to_string(m_missedDeadlines));
+    values.emplace_back("LAST_COLLECT_TIME_US", std::to_string(m_collectTime.m_last));
+    values.emplace_back("AVG_COLLECT_TIME_US", std::to_string(m_collectTime.average()));
+    values.emplace_back("MAX_COLLECT_TIME_US", std::to_string(m_collectTime.m_max));
+
+    table.set(m_group, values);
+
+    table.set(m_group + ":HISTOGRAM", sairediscommon::LatencyHistogramExporter::serialize(m_histogram.snapshot()));
+
+    for (auto& kv: m_contexts)
+    {
+        auto& stats = kv.second;
+
+        values.clear();
+
+        values.emplace_back("OBJECT_COUNT", std::to_string(stats.m_objectCount));
+        values.emplace_back("LAST_COLLECT_TIME_US", std::to_string(stats.m_collectTime.m_last));
+        values.emplace_back("AVG_COLLECT_TIME_US", std::to_string(stats.m_collectTime.average()));
+        values.emplace_back("MAX_COLLECT_TIME_US", std::to_string(stats.m_collectTime.m_max));
+        values.emplace_back("LAST_SAI_TIME_US", std::to_string(stats.m_saiTime.m_last));
+        values.emplace_back("AVG_SAI_TIME_US", std::to_string(stats.m_saiTime.average()));
+        values.emplace_back("LAST_REDIS_TIME_US", std::to_string(stats.m_redisTime.m_last));
+        values.emplace_back("AVG_REDIS_TIME_US", std::to_string(stats.m_redisTime.average()));
+
+        table.set(m_group + ":" + kv.first, values);
+    }
+
+    for (auto& context: m_removedContexts)
+    {
+        table.del(m_group + ":" + context);
+    }
+
+    m_removedContexts.clear();
+}
+
+void FlexCounterPollStats::remove(
+        _In_ swss::Table& table)
+{
+    SWSS_LOG_ENTER();
+
+    table.del(m_group);
+
+    table.del(m_group + ":HISTOGRAM");
+
+    for (auto& kv: m_contexts)
+    {
+        table.del(m_group + ":" + kv.first);
+    }
+
+    for (auto& context: m_removedContexts)
+    {
+        table.del(m_group + ":" + context);
+    }
+
+    m_contexts.clear();
+
+    m_removedContexts.clear();
+}
+
+uint64_t FlexCounterPollStats::getPollCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_pollCount;
+}
+
+uint64_t FlexCounterPollStats::getMissedDeadlines() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_missedDeadlines;
+}
+
+const FlexCounterPollStats::Timing& FlexCounterPollStats::getCollectTime() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_collectTime;
+}
+
+const std::map<std::string, FlexCounterPollStats::ContextStats>& FlexCounterPollStats::getContextStats() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_contexts;
+}
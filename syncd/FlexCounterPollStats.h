@@ -0,0 +1,150 @@
+#pragma once
+
+#include "meta/LatencyHistogram.h"
+
+#include "swss/sal.h"
+#include "swss/table.h"
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Flex counter group poll timing statistics.
+     *
+     * Tracks collection time of whole group and each counter context,
+     * time spent in vendor SAI, number of polled objects and number of
+     * poll deadlines missed because collection took longer than poll
+     * interval. Statistics are published to POLL_STATS_TABLE after each
+     * poll, group histogram uses LATENCY_HISTOGRAM format.
+     *
+     * Not thread safe, flex counter calls it under its own lock.
+     */
+    class FlexCounterPollStats
+    {
+        private:
+
+            FlexCounterPollStats(const FlexCounterPollStats&) = delete;
+            FlexCounterPollStats& operator=(const FlexCounterPollStats&) = delete;
+
+        public:
+
+            static constexpr const char* POLL_STATS_TABLE = "FLEX_COUNTER_POLL_STATS";
+
+            /**
+             * @brief Last, average and max time in microseconds.
+             */
+            struct Timing
+            {
+                uint64_t m_last = 0;
+
+                uint64_t m_sum = 0;
+
+                uint64_t m_max = 0;
+
+                uint64_t m_count = 0;
+
+                void record(
+                        _In_ std::chrono::steady_clock::duration duration);
+
+                uint64_t average() const;
+            };
+
+            struct ContextStats
+            {
+                size_t m_objectCount = 0;
+
+                Timing m_collectTime;
+
+                /**
+                 * @brief Time of vendor SAI calls.
+                 */
+                Timing m_saiTime;
+
+                /**
+                 * @brief Time of serializing and writing to redis pipeline.
+                 */
+                Timing m_redisTime;
+            };
+
+        public:
+
+            FlexCounterPollStats(
+                    _In_ const std::string& group);
+
+            virtual ~FlexCounterPollStats() = default;
+
+        public:
+
+            /**
+             * @brief Record poll of whole group.
+             *
+             * Deadlines are aligned to multiples of poll interval, each
+             * interval slot skipped since previous poll counts as missed.
+             */
+            void recordPoll(
+                    _In_ std::chrono::steady_clock::time_point start,
+                    _In_ std::chrono::steady_clock::duration collectTime,
+                    _In_ uint32_t pollInterval);
+
+            void recordContext(
+                    _In_ const std::string& context,
+                    _In_ size_t objectCount,
+                    _In_ std::chrono::steady_clock::duration collectTime,
+                    _In_ std::chrono::steady_clock::duration saiTime);
+
+            void removeContext(
+                    _In_ const std::string& context);
+
+            /**
+             * @brief Group was idle, next poll will not count missed deadlines.
+             */
+            void reset();
+
+            void publish(
+                    _In_ swss::Table& table);
+
+            /**
+             * @brief Remove all statistics of group from table, when group
+             * is torn down.
+             */
+            void remove(
+                    _In_ swss::Table& table);
+
+        public:
+
+            uint64_t getPollCount() const;
+
+            uint64_t getMissedDeadlines() const;
+
+            const Timing& getCollectTime() const;
+
+            const std::map<std::string, ContextStats>& getContextStats() const;
+
+        private:
+
+            std::string m_group;
+
+            uint64_t m_pollCount;
+
+            uint64_t m_missedDeadlines;
+
+            uint32_t m_pollInterval;
+
+            /**
+             * @brief Interval slot of last poll, zero if group was idle.
+             */
+            uint64_t m_lastSlot;
+
+            Timing m_collectTime;
+
+            sairediscommon::LatencyHistogram m_histogram;
+
+            std::map<std::string, ContextStats> m_contexts;
+
+            std::set<std::string> m_removedContexts;
+    };
+}
@@ -0,0 +1,308 @@
+#include "FlexCounterScheduler.h"
+#include "FlexCounterPollStats.h"
+
+#include "sairediscommon.h"
+
+#include "swss/logger.h"
+#include "swss/redispipeline.h"
+#include "swss/schema.h"
+
+#include <inttypes.h>
+
+using namespace syncd;
+
+constexpr size_t FlexCounterScheduler::DEFAULT_WORKER_COUNT;
+
+FlexCounterScheduler::FlexCounterScheduler(
+        _In_ const std::string& dbCounters,
+        _In_ size_t workerCount):
+    m_dbCounters(dbCounters),
+    m_run(true),
+    m_serial(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (workerCount == 0)
+    {
+        SWSS_LOG_THROW("worker count must be positive");
+    }
+
+    for (size_t idx = 0; idx < workerCount; idx++)
+    {
+        m_workers.push_back(std::make_shared<std::thread>(&FlexCounterScheduler::workerThreadFunction, this));
+    }
+
+    SWSS_LOG_NOTICE("flex counter scheduler started with %zu workers", workerCount);
+}
+
+FlexCounterScheduler::~FlexCounterScheduler()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_cv.notify_all();
+
+    for (auto& worker: m_workers)
+    {
+        worker->join();
+    }
+
+    SWSS_LOG_NOTICE("flex counter scheduler ended");
+}
+
+std::chrono::steady_clock::time_point FlexCounterScheduler::alignDeadline(
+        _In_ std::chrono::steady_clock::time_point now,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+
+    auto aligned = (ms / pollInterval + 1) * pollInterval;
+
+    return std::chrono::steady_clock::time_point(std::chrono::milliseconds(aligned));
+}
+
+std::chrono::steady_clock::time_point FlexCounterScheduler::nextDeadline(
+        _In_ std::chrono::steady_clock::time_point previous,
+        _In_ std::chrono::steady_clock::time_point now,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    auto interval = std::chrono::milliseconds(pollInterval);
+
+    if (now < previous)
+    {
+        return previous + interval;
+    }
+
+    auto missed = (now - previous) / interval;
+
+    return previous + interval * (missed + 1);
+}
+
+void FlexCounterScheduler::addClient(
+        _In_ Client* client)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_clients.find(client) != m_clients.end())
+    {
+        SWSS_LOG_THROW("client %p already added", client);
+    }
+
+    auto& state = m_clients[client];
+
+    state.m_serial = ++m_serial;
+    state.m_scheduled = false;
+    state.m_running = false;
+    state.m_notified = false;
+}
+
+void FlexCounterScheduler::removeClient(
+        _In_ Client* client)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // heap entry of removed client is skipped when it becomes due
+
+    m_cv.wait(lock, [&]
+            {
+                auto it = m_clients.find(client);
+
+                return it == m_clients.end() || !it->second.m_running;
+            });
+
+    m_clients.erase(client);
+}
+
+void FlexCounterScheduler::notify(
+        _In_ Client* client)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_clients.find(client);
+
+    if (it == m_clients.end())
+    {
+        SWSS_LOG_ERROR("client %p not found", client);
+        return;
+    }
+
+    auto& state = it->second;
+
+    if (state.m_running)
+    {
+        // state may have changed after poll started
+
+        state.m_notified = true;
+    }
+    else if (!state.m_scheduled)
+    {
+        schedule(client, state, std::chrono::steady_clock::now(), 0);
+    }
+}
+
+void FlexCounterScheduler::schedule(
+        _In_ Client* client,
+        _In_ ClientState& state,
+        _In_ std::chrono::steady_clock::time_point deadline,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    state.m_scheduled = true;
+
+    m_heap.push(Entry{deadline, pollInterval, state.m_serial, client});
+
+    m_cv.notify_all();
+}
+
+void FlexCounterScheduler::workerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db(m_dbCounters, 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, true);
+    swss::Table ratesTable(&pipeline, RATES_TABLE, true);
+    swss::Table pollStatsTable(&pipeline, FlexCounterPollStats::POLL_STATS_TABLE, true);
+
+    std::vector<Entry> batch;
+    std::vector<Entry> others;
+    std::vector<uint32_t> intervals;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_run)
+    {
+        if (m_heap.empty())
+        {
+            m_cv.wait(lock);
+            continue;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (m_heap.top().m_deadline > now)
+        {
+            m_cv.wait_until(lock, m_heap.top().m_deadline);
+            continue;
+        }
+
+        batch.clear();
+        others.clear();
+
+        while (!m_heap.empty() && m_heap.top().m_deadline <= now)
+        {
+            auto entry = m_heap.top();
+
+            m_heap.pop();
+
+            auto it = m_clients.find(entry.m_client);
+
+            if (it == m_clients.end() || it->second.m_serial != entry.m_serial)
+            {
+                continue; // client was removed
+            }
+
+            if (batch.size() && batch.front().m_pollInterval != entry.m_pollInterval)
+            {
+                // left for other workers
+
+                others.push_back(entry);
+                continue;
+            }
+
+            it->second.m_scheduled = false;
+            it->second.m_running = true;
+            it->second.m_notified = false;
+
+            batch.push_back(entry);
+        }
+
+        for (auto& entry: others)
+        {
+            m_heap.push(entry);
+        }
+
+        if (others.size())
+        {
+            m_cv.notify_all();
+        }
+
+        if (batch.empty())
+        {
+            continue;
+        }
+
+        lock.unlock();
+
+        intervals.assign(batch.size(), 0);
+
+        for (size_t idx = 0; idx < batch.size(); idx++)
+        {
+            intervals[idx] = batch[idx].m_client->pollCounters(countersTable, ratesTable, pollStatsTable);
+        }
+
+        // single pipeline flush for whole batch, plugins read counters from database
+
+        countersTable.flush();
+
+        for (size_t idx = 0; idx < batch.size(); idx++)
+        {
+            if (intervals[idx])
+            {
+                batch[idx].m_client->runPollPlugins(db);
+            }
+        }
+
+        auto finish = std::chrono::steady_clock::now();
+
+        SWSS_LOG_DEBUG("polled %zu flex counter groups, took %" PRId64 " ms",
+                batch.size(),
+                (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(finish - now).count());
+
+        lock.lock();
+
+        for (size_t idx = 0; idx < batch.size(); idx++)
+        {
+            auto& entry = batch[idx];
+
+            auto& state = m_clients.at(entry.m_client);
+
+            state.m_running = false;
+
+            if (intervals[idx] && intervals[idx] == entry.m_pollInterval)
+            {
+                schedule(entry.m_client, state, nextDeadline(entry.m_deadline, finish, intervals[idx]), intervals[idx]);
+            }
+            else if (intervals[idx])
+            {
+                // first poll or interval changed, move to grid of new interval
+
+                schedule(entry.m_client, state, alignDeadline(finish, intervals[idx]), intervals[idx]);
+            }
+            else if (state.m_notified)
+            {
+                schedule(entry.m_client, state, finish, 0);
+            }
+        }
+
+        // wake up clients waiting for removal
+
+        m_cv.notify_all();
+    }
+}
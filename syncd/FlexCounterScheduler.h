@@ -0,0 +1,181 @@
+#pragma once
+
+#include "swss/sal.h"
+#include "swss/table.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Flex counter scheduler.
+     *
+     * Single deadline heap shared by all flex counter groups, polls are
+     * executed on small pool of worker threads. Deadlines are aligned to
+     * multiples of poll interval, so groups with the same interval become
+     * due at the same time and are polled in single batch, which is written
+     * to COUNTERS_DB with single redis pipeline flush. Groups with different
+     * intervals are left to other workers, so slow group doesn't delay
+     * groups with shorter interval.
+     */
+    class FlexCounterScheduler
+    {
+        private:
+
+            FlexCounterScheduler(const FlexCounterScheduler&) = delete;
+            FlexCounterScheduler& operator=(const FlexCounterScheduler&) = delete;
+
+        public:
+
+            /**
+             * @brief Scheduled flex counter group.
+             */
+            class Client
+            {
+                public:
+
+                    virtual ~Client() = default;
+
+                public:
+
+                    /**
+                     * @brief Collect counters into counters and rates table
+                     * and publish poll statistics.
+                     *
+                     * All tables share pipeline which is flushed by
+                     * scheduler after whole batch was collected.
+                     *
+                     * @return Poll interval in milliseconds, or zero when
+                     * nothing was collected, client will not be polled again
+                     * until notified.
+                     */
+                    virtual uint32_t pollCounters(
+                            _In_ swss::Table& countersTable,
+                            _In_ swss::Table& ratesTable,
+                            _In_ swss::Table& pollStatsTable) = 0;
+
+                    /**
+                     * @brief Run plugins after counters were flushed.
+                     */
+                    virtual void runPollPlugins(
+                            _In_ swss::DBConnector& db) = 0;
+            };
+
+            static constexpr size_t DEFAULT_WORKER_COUNT = 2;
+
+        public:
+
+            FlexCounterScheduler(
+                    _In_ const std::string& dbCounters,
+                    _In_ size_t workerCount = DEFAULT_WORKER_COUNT);
+
+            virtual ~FlexCounterScheduler();
+
+        public:
+
+            void addClient(
+                    _In_ Client* client);
+
+            /**
+             * @brief Remove client, waits if client is being polled.
+             */
+            void removeClient(
+                    _In_ Client* client);
+
+            /**
+             * @brief Notify client state changed.
+             *
+             * Idle client is polled right away, client which is already
+             * scheduled keeps its deadline.
+             */
+            void notify(
+                    _In_ Client* client);
+
+            /**
+             * @brief Get next deadline aligned to multiple of poll interval.
+             */
+            static std::chrono::steady_clock::time_point alignDeadline(
+                    _In_ std::chrono::steady_clock::time_point now,
+                    _In_ uint32_t pollInterval);
+
+            /**
+             * @brief Get next deadline after previous one.
+             *
+             * Deadline stays on grid of previous deadline, so time spent in
+             * poll doesn't make it drift, deadlines missed by long poll are
+             * skipped.
+             */
+            static std::chrono::steady_clock::time_point nextDeadline(
+                    _In_ std::chrono::steady_clock::time_point previous,
+                    _In_ std::chrono::steady_clock::time_point now,
+                    _In_ uint32_t pollInterval);
+
+        private:
+
+            struct Entry
+            {
+                std::chrono::steady_clock::time_point m_deadline;
+
+                /**
+                 * @brief Poll interval deadline was computed for, zero when
+                 * client was notified.
+                 */
+                uint32_t m_pollInterval;
+
+                uint64_t m_serial;
+
+                Client* m_client;
+
+                bool operator>(
+                        _In_ const Entry& other) const
+                {
+                    return m_deadline > other.m_deadline;
+                }
+            };
+
+            struct ClientState
+            {
+                uint64_t m_serial;
+
+                bool m_scheduled;
+
+                bool m_running;
+
+                bool m_notified;
+            };
+
+            void schedule(
+                    _In_ Client* client,
+                    _In_ ClientState& state,
+                    _In_ std::chrono::steady_clock::time_point deadline,
+                    _In_ uint32_t pollInterval);
+
+            void workerThreadFunction();
+
+        private:
+
+            std::string m_dbCounters;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            bool m_run;
+
+            uint64_t m_serial;
+
+            std::map<Client*, ClientState> m_clients;
+
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_heap;
+
+            std::vector<std::shared_ptr<std::thread>> m_workers;
+    };
+}
@@ -0,0 +1,254 @@
+#include "OidTranslationTable.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+constexpr size_t OidTranslationTable::MIN_CAPACITY;
+constexpr size_t OidTranslationTable::LOOKUP_GROUP_SIZE;
+
+/*
+ * Fibonacci hashing, top bits of product depend on all bits of object id,
+ * both on object index in low bits and on object type and switch index in
+ * high bits.
+ */
+#define OID_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+
+OidTranslationTable::OidTranslationTable():
+    m_mask(0),
+    m_shift(0),
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    rehash(MIN_CAPACITY);
+}
+
+size_t OidTranslationTable::getHomeSlot(
+        _In_ sai_object_id_t key) const
+{
+    SWSS_LOG_ENTER();
+
+    return (size_t)((key * OID_HASH_MULTIPLIER) >> m_shift);
+}
+
+sai_object_id_t OidTranslationTable::lookup(
+        _In_ sai_object_id_t key) const
+{
+    SWSS_LOG_ENTER();
+
+    if (key == SAI_NULL_OBJECT_ID)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    for (size_t slot = getHomeSlot(key); ; slot = (slot + 1) & m_mask)
+    {
+        if (m_keys[slot] == key)
+        {
+            return m_values[slot];
+        }
+
+        if (m_keys[slot] == SAI_NULL_OBJECT_ID)
+        {
+            return SAI_NULL_OBJECT_ID;
+        }
+    }
+}
+
+size_t OidTranslationTable::lookup(
+        _In_ size_t count,
+        _In_ const sai_object_id_t* keys,
+        _Out_ sai_object_id_t* values) const
+{
+    SWSS_LOG_ENTER();
+
+    const sai_object_id_t* tableKeys = m_keys.data();
+    const sai_object_id_t* tableValues = m_values.data();
+
+    size_t slots[LOOKUP_GROUP_SIZE];
+
+    size_t missing = 0;
+
+    for (size_t base = 0; base < count; base += LOOKUP_GROUP_SIZE)
+    {
+        const size_t groupSize = std::min(LOOKUP_GROUP_SIZE, count - base);
+
+        for (size_t idx = 0; idx < groupSize; idx++)
+        {
+            slots[idx] = (size_t)((keys[base + idx] * OID_HASH_MULTIPLIER) >> m_shift);
+
+            __builtin_prefetch(tableKeys + slots[idx]);
+            __builtin_prefetch(tableValues + slots[idx]);
+        }
+
+        /*
+         * Value of empty slot is always null, so probe ends with null value
+         * on first empty slot, also for null key, which is never inserted.
+         */
+
+        for (size_t idx = 0; idx < groupSize; idx++)
+        {
+            const sai_object_id_t key = keys[base + idx];
+
+            size_t slot = slots[idx];
+
+            while (tableKeys[slot] != key && tableKeys[slot] != SAI_NULL_OBJECT_ID)
+            {
+                slot = (slot + 1) & m_mask;
+            }
+
+            values[base + idx] = tableValues[slot];
+
+            missing += (tableValues[slot] == SAI_NULL_OBJECT_ID);
+        }
+    }
+
+    return missing;
+}
+
+void OidTranslationTable::insert(
+        _In_ sai_object_id_t key,
+        _In_ sai_object_id_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (key == SAI_NULL_OBJECT_ID)
+    {
+        return;
+    }
+
+    // keep load factor at most 1/2, so probe sequences stay short
+
+    if ((m_size + 1) * 2 > m_keys.size())
+    {
+        rehash(m_keys.size() * 2);
+    }
+
+    size_t slot = getHomeSlot(key);
+
+    while (m_keys[slot] != key && m_keys[slot] != SAI_NULL_OBJECT_ID)
+    {
+        slot = (slot + 1) & m_mask;
+    }
+
+    if (m_keys[slot] == SAI_NULL_OBJECT_ID)
+    {
+        m_keys[slot] = key;
+
+        m_size++;
+    }
+
+    m_values[slot] = value;
+}
+
+bool OidTranslationTable::erase(
+        _In_ sai_object_id_t key)
+{
+    SWSS_LOG_ENTER();
+
+    if (key == SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    size_t hole = getHomeSlot(key);
+
+    while (m_keys[hole] != key)
+    {
+        if (m_keys[hole] == SAI_NULL_OBJECT_ID)
+        {
+            return false;
+        }
+
+        hole = (hole + 1) & m_mask;
+    }
+
+    /*
+     * Backward shift deletion, entries following erased one are moved back
+     * if hole is not before their home slot, so no tombstones are needed
+     * and probe sequences are not getting longer after many erases.
+     */
+
+    for (size_t slot = (hole + 1) & m_mask; m_keys[slot] != SAI_NULL_OBJECT_ID; slot = (slot + 1) & m_mask)
+    {
+        size_t home = getHomeSlot(m_keys[slot]);
+
+        if (((slot - home) & m_mask) >= ((slot - hole) & m_mask))
+        {
+            m_keys[hole] = m_keys[slot];
+            m_values[hole] = m_values[slot];
+
+            hole = slot;
+        }
+    }
+
+    m_keys[hole] = SAI_NULL_OBJECT_ID;
+    m_values[hole] = SAI_NULL_OBJECT_ID;
+
+    m_size--;
+
+    return true;
+}
+
+void OidTranslationTable::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_keys.clear();
+    m_values.clear();
+
+    m_size = 0;
+
+    rehash(MIN_CAPACITY);
+}
+
+size_t OidTranslationTable::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size;
+}
+
+void OidTranslationTable::rehash(
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> keys(capacity, SAI_NULL_OBJECT_ID);
+    std::vector<sai_object_id_t> values(capacity, SAI_NULL_OBJECT_ID);
+
+    keys.swap(m_keys);
+    values.swap(m_values);
+
+    m_mask = capacity - 1;
+
+    m_shift = 64;
+
+    while (capacity > 1)
+    {
+        m_shift--;
+
+        capacity >>= 1;
+    }
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        if (keys[idx] == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        size_t slot = getHomeSlot(keys[idx]);
+
+        while (m_keys[slot] != SAI_NULL_OBJECT_ID)
+        {
+            slot = (slot + 1) & m_mask;
+        }
+
+        m_keys[slot] = keys[idx];
+        m_values[slot] = values[idx];
+    }
+}
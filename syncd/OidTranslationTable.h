@@ -0,0 +1,103 @@
+#pragma once
+
+extern "C"{
+#include "saimetadata.h"
+}
+
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Flat RID/VID translation table.
+     *
+     * Open addressing hash table with linear probing, keys and values are
+     * kept in separate arrays, so single cache line holds 8 probed keys
+     * and no memory is allocated per entry. SAI_NULL_OBJECT_ID is used to
+     * mark empty slot, it is never stored as a key, since null object id
+     * always translates to null.
+     *
+     * Table is not thread safe, caller is responsible for locking.
+     */
+    class OidTranslationTable
+    {
+        public:
+
+            OidTranslationTable();
+
+            virtual ~OidTranslationTable() = default;
+
+        public:
+
+            /**
+             * @brief Get value for given key.
+             *
+             * @return Value or SAI_NULL_OBJECT_ID if key is not present.
+             */
+            sai_object_id_t lookup(
+                    _In_ sai_object_id_t key) const;
+
+            /**
+             * @brief Get values for array of keys.
+             *
+             * Keys are processed in groups, home slots of whole group are
+             * prefetched before probing, so memory latency of lookups in
+             * large table is overlapped. Keys not present in table get
+             * SAI_NULL_OBJECT_ID value.
+             *
+             * @return Number of keys not present in table.
+             */
+            size_t lookup(
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* keys,
+                    _Out_ sai_object_id_t* values) const;
+
+            /**
+             * @brief Insert or update value for given key.
+             *
+             * Null key is ignored.
+             */
+            void insert(
+                    _In_ sai_object_id_t key,
+                    _In_ sai_object_id_t value);
+
+            /**
+             * @brief Erase given key.
+             *
+             * @return True if key was present in table.
+             */
+            bool erase(
+                    _In_ sai_object_id_t key);
+
+            void clear();
+
+            size_t size() const;
+
+        private:
+
+            size_t getHomeSlot(
+                    _In_ sai_object_id_t key) const;
+
+            void rehash(
+                    _In_ size_t capacity);
+
+        private:
+
+            static constexpr size_t MIN_CAPACITY = 16;
+
+            /**
+             * @brief Number of keys looked up in single prefetch group.
+             */
+            static constexpr size_t LOOKUP_GROUP_SIZE = 16;
+
+            std::vector<sai_object_id_t> m_keys;
+
+            std::vector<sai_object_id_t> m_values;
+
+            size_t m_mask;
+
+            unsigned int m_shift;
+
+            size_t m_size;
+    };
+}
@@ -228,7 +228,7 @@ void RedisClient::setDummyAsicStateObject(
 
     std::string strKey = ASIC_STATE_TABLE + (":" + strObjectType + ":" + strVid);
 
-    m_dbAsic->hset(strKey, "NULL", "NULL");
+    writeAsicState({{ "HSET", strKey, "NULL", "NULL" }});
 }
 
 void RedisClient::setDummyAsicStateObjects(
@@ -237,7 +237,7 @@ void RedisClient::setDummyAsicStateObjects(
 {
     SWSS_LOG_ENTER();
 
-    swss::RedisPipeline pipe(m_dbAsic.get(), count);
+    std::vector<std::vector<std::string>> commands;
 
     for (size_t idx = 0; idx < count; idx++)
     {
@@ -249,12 +249,10 @@ void RedisClient::setDummyAsicStateObjects(
 
         std::string strKey = ASIC_STATE_TABLE + (":" + strObjectType + ":" + strVid);
 
-        swss::RedisCommand hset;
-        hset.format("HSET %s %s %s", strKey.c_str(), "NULL", "NULL");
-        pipe.push(hset, REDIS_REPLY_INTEGER);
+        commands.push_back({ "HSET", strKey, "NULL", "NULL" });
     }
 
-    pipe.flush();
+    writeAsicState(commands);
 }
 
 std::string RedisClient::getRedisColdVidsKey(
@@ -493,7 +491,7 @@ void RedisClient::removeAsicObject(
 
     SWSS_LOG_INFO("removing ASIC DB key: %s", key.c_str());
 
-    m_dbAsic->del(key);
+    writeAsicState({{ "DEL", key }});
 }
 
 void RedisClient::removeAsicObject(
@@ -503,7 +501,7 @@ void RedisClient::removeAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    writeAsicState({{ "DEL", key }});
 }
 
 void RedisClient::removeTempAsicObject(
@@ -521,15 +519,20 @@ void RedisClient::removeAsicObjects(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<std::string> prefixKeys;
+    if (keys.empty())
+    {
+        return;
+    }
+
+    std::vector<std::string> command = { "DEL" };
 
     // we need to rewrite keys to add table prefix
     for (const auto& key: keys)
     {
-         prefixKeys.push_back((ASIC_STATE_TABLE ":") + key);
+         command.push_back((ASIC_STATE_TABLE ":") + key);
     }
 
-    m_dbAsic->del(prefixKeys);
+    writeAsicState({ command });
 }
 
 void RedisClient::removeTempAsicObjects(
@@ -557,7 +560,7 @@ void RedisClient::setAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->hset(key, attr, value);
+    writeAsicState({{ "HSET", key, attr, value }});
 }
 
 void RedisClient::setTempAsicObject(
@@ -580,16 +583,7 @@ void RedisClient::createAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    if (attrs.size() == 0)
-    {
-        m_dbAsic->hset(key, "NULL", "NULL");
-        return;
-    }
-
-    for (const auto& e: attrs)
-    {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
-    }
+    writeAsicState({ makeHset(key, attrs) });
 }
 
 void RedisClient::createTempAsicObject(
@@ -617,20 +611,20 @@ void RedisClient::createAsicObjects(
 {
     SWSS_LOG_ENTER();
 
-    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
+    if (multiHash.empty())
+    {
+        return;
+    }
+
+    std::vector<std::vector<std::string>> commands;
 
     // we need to rewrite hash to add table prefix
     for (const auto& kvp: multiHash)
     {
-        hash[(ASIC_STATE_TABLE ":") + kvp.first] = kvp.second;
-
-        if (kvp.second.size() == 0)
-        {
-            hash[(ASIC_STATE_TABLE ":") + kvp.first].emplace_back(std::make_pair<std::string, std::string>("NULL", "NULL"));
-        }
+        commands.push_back(makeHset((ASIC_STATE_TABLE ":") + kvp.first, kvp.second));
     }
 
-    m_dbAsic->hmset(hash);
+    writeAsicState(commands);
 }
 
 void RedisClient::createTempAsicObjects(
@@ -804,17 +798,38 @@ void RedisClient::getVidsForRids(
 {
     SWSS_LOG_ENTER();
 
+    getObjectIds(RIDTOVID, count, rids, vids);
+}
+
+void RedisClient::getRidsForVids(
+        _In_ size_t count,
+        _In_ const sai_object_id_t* vids,
+        _Out_ sai_object_id_t* rids)
+{
+    SWSS_LOG_ENTER();
+
+    getObjectIds(VIDTORID, count, vids, rids);
+}
+
+void RedisClient::getObjectIds(
+        _In_ const std::string& hashName,
+        _In_ size_t count,
+        _In_ const sai_object_id_t* fields,
+        _Out_ sai_object_id_t* values)
+{
+    SWSS_LOG_ENTER();
+
     swss::RedisCommand hmget;
 
     std::vector<std::string> cmds;
     cmds.reserve(count + 2);
 
     cmds.push_back("HMGET");
-    cmds.push_back(RIDTOVID);
+    cmds.push_back(hashName);
 
     for (size_t idx = 0; idx < count; idx++)
     {
-        cmds.push_back(sai_serialize_object_id(rids[idx]));
+        cmds.push_back(sai_serialize_object_id(fields[idx]));
     }
 
     hmget.format(cmds);
@@ -839,11 +854,11 @@ void RedisClient::getVidsForRids(
 
         if (element->type == REDIS_REPLY_STRING)
         {
-            sai_deserialize_object_id(element->str, vids[idx]);
+            sai_deserialize_object_id(element->str, values[idx]);
         }
         else if (element->type == REDIS_REPLY_NIL)
         {
-            vids[idx] = SAI_NULL_OBJECT_ID;
+            values[idx] = SAI_NULL_OBJECT_ID;
         }
         else
         {
@@ -882,10 +897,21 @@ void RedisClient::removeAsicStateTable()
 
     const auto &asicStateKeys = m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 
+    std::vector<std::vector<std::string>> commands;
+
     for (const auto &key: asicStateKeys)
     {
-        m_dbAsic->del(key);
+        commands.push_back({ "DEL", key });
     }
+
+    writeAsicState(commands);
+}
+
+void RedisClient::incrementAsicStateGeneration() const
+{
+    SWSS_LOG_ENTER();
+
+    m_dbAsic->incr(REDIS_KEY_ASIC_STATE_GENERATION);
 }
 
 void RedisClient::removeTempAsicStateTable()
@@ -921,23 +947,18 @@ std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView(
 
     SWSS_LOG_TIMER("get asic view from %s", tableName.c_str());
 
-    swss::Table table(m_dbAsic.get(), tableName);
-
-    swss::TableDump dump;
-
-    table.dump(dump);
-
     std::map<sai_object_id_t, swss::TableDump> map;
 
-    for (auto& key: dump)
-    {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key.first, mk);
+    scanAsicView(tableName, [&](const std::string& key, const swss::TableMap& fields)
+            {
+                sai_object_meta_key_t mk;
+                sai_deserialize_object_meta_key(key, mk);
 
-        auto switchVID = VidManager::switchIdQuery(mk.objectkey.key.object_id);
+                auto switchVID = VidManager::switchIdQuery(mk.objectkey.key.object_id);
 
-        map[switchVID][key.first] = key.second;
-    }
+                map[switchVID][key] = fields;
+            },
+            DEFAULT_SCAN_PAGE_SIZE);
 
     SWSS_LOG_NOTICE("%s switch count: %zu:", tableName.c_str(), map.size());
 
@@ -951,6 +972,146 @@ std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView(
     return map;
 }
 
+size_t RedisClient::scanAsicView(
+        _In_ const AsicObjectCallback& callback,
+        _In_ size_t pageSize)
+{
+    SWSS_LOG_ENTER();
+
+    return scanAsicView(ASIC_STATE_TABLE, callback, pageSize);
+}
+
+size_t RedisClient::scanTempAsicView(
+        _In_ const AsicObjectCallback& callback,
+        _In_ size_t pageSize)
+{
+    SWSS_LOG_ENTER();
+
+    return scanAsicView(TEMP_PREFIX ASIC_STATE_TABLE, callback, pageSize);
+}
+
+size_t RedisClient::scanAsicView(
+        _In_ const std::string &tableName,
+        _In_ const AsicObjectCallback& callback,
+        _In_ size_t pageSize)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("scan asic view from %s", tableName.c_str());
+
+    const std::string prefix = tableName + ":";
+
+    const std::string pattern = prefix + "*";
+
+    auto ctx = m_dbAsic->getContext();
+
+    std::string cursor = "0";
+
+    size_t count = 0;
+
+    do
+    {
+        swss::RedisCommand scan;
+
+        scan.format("SCAN %s MATCH %s COUNT %zu", cursor.c_str(), pattern.c_str(), pageSize);
+
+        swss::RedisReply r(m_dbAsic.get(), scan, REDIS_REPLY_ARRAY);
+
+        auto reply = r.getContext();
+
+        if (reply->elements != 2 ||
+                reply->element[0]->type != REDIS_REPLY_STRING ||
+                reply->element[1]->type != REDIS_REPLY_ARRAY)
+        {
+            SWSS_LOG_THROW("unexpected SCAN reply on %s", tableName.c_str());
+        }
+
+        cursor = reply->element[0]->str;
+
+        auto keys = reply->element[1];
+
+        // pipeline HGETALL for all keys on page
+
+        for (size_t idx = 0; idx < keys->elements; idx++)
+        {
+            auto key = keys->element[idx];
+
+            if (redisAppendCommand(ctx, "HGETALL %b", key->str, key->len) != REDIS_OK)
+            {
+                SWSS_LOG_THROW("failed to append HGETALL %s", key->str);
+            }
+        }
+
+        // all replies must be read, even on error, to keep connection in sync
+
+        std::vector<swss::TableMap> maps(keys->elements);
+
+        std::vector<bool> exists(keys->elements, false);
+
+        bool success = true;
+
+        for (size_t idx = 0; idx < keys->elements; idx++)
+        {
+            redisReply* hgetall = nullptr;
+
+            if (redisGetReply(ctx, (void**)&hgetall) != REDIS_OK || hgetall == nullptr)
+            {
+                SWSS_LOG_THROW("failed to get HGETALL reply for %s", keys->element[idx]->str);
+            }
+
+            if (hgetall->type == REDIS_REPLY_ARRAY)
+            {
+                // key could be removed after SCAN, then reply is empty
+
+                exists[idx] = (hgetall->elements != 0);
+
+                for (size_t i = 0; i + 1 < hgetall->elements; i += 2)
+                {
+                    std::string field = hgetall->element[i]->str;
+
+                    if (field == "NULL")
+                    {
+                        continue;
+                    }
+
+                    maps[idx][field] = hgetall->element[i + 1]->str;
+                }
+            }
+            else
+            {
+                SWSS_LOG_ERROR("unexpected HGETALL reply type %d for %s", hgetall->type, keys->element[idx]->str);
+
+                success = false;
+            }
+
+            freeReplyObject(hgetall);
+        }
+
+        if (!success)
+        {
+            SWSS_LOG_THROW("failed to get objects from %s", tableName.c_str());
+        }
+
+        for (size_t idx = 0; idx < keys->elements; idx++)
+        {
+            std::string key = keys->element[idx]->str;
+
+            if (!exists[idx] || key.compare(0, prefix.size(), prefix) != 0)
+            {
+                continue;
+            }
+
+            callback(key.substr(prefix.size()), maps[idx]);
+
+            count++;
+        }
+    }
+    while (cursor != "0");
+
+    SWSS_LOG_NOTICE("%s objects count: %zu", tableName.c_str(), count);
+
+    return count;
+}
 
 void RedisClient::processFlushEvent(
         _In_ sai_object_id_t switchVid,
@@ -1004,17 +1165,96 @@ void RedisClient::processFlushEvent(
             SWSS_LOG_THROW("unknown fdb flush entry type: %d", type);
     }
 
+    std::vector<std::vector<std::string>> commands;
+
     for (int flush_static: vals)
     {
-        swss::RedisCommand command;
+        commands.push_back({ "EVALSHA", m_fdbFlushSha, "3", pattern, portStr, std::to_string(flush_static) });
+    }
+
+    writeAsicState(commands);
+}
+
+std::vector<std::string> RedisClient::makeHset(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> command = { "HSET", key };
+
+    if (attrs.size() == 0)
+    {
+        command.push_back("NULL");
+        command.push_back("NULL");
+    }
+
+    for (const auto& e: attrs)
+    {
+        command.push_back(fvField(e));
+        command.push_back(fvValue(e));
+    }
+
+    return command;
+}
+
+void RedisClient::writeAsicState(
+        _In_ const std::vector<std::vector<std::string>>& commands) const
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = m_dbAsic->getContext();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    for (const auto& command: commands)
+    {
+        argv.clear();
+        argvlen.clear();
+
+        for (const auto& arg: command)
+        {
+            argv.push_back(arg.c_str());
+            argvlen.push_back(arg.size());
+        }
+
+        if (redisAppendCommandArgv(ctx, (int)argv.size(), argv.data(), argvlen.data()) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to append %s %s", command.at(0).c_str(), command.at(1).c_str());
+        }
+    }
+
+    if (redisAppendCommand(ctx, "INCR %s", REDIS_KEY_ASIC_STATE_GENERATION) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append INCR %s", REDIS_KEY_ASIC_STATE_GENERATION);
+    }
+
+    // all replies must be read, even on error, to keep connection in sync
 
-        command.format(
-                "EVALSHA %s 3 %s %s %s",
-                m_fdbFlushSha.c_str(),
-                pattern.c_str(),
-                portStr.c_str(),
-                std::to_string(flush_static).c_str());
+    bool success = true;
+
+    for (size_t idx = 0; idx <= commands.size(); idx++)
+    {
+        redisReply* reply = nullptr;
 
-        swss::RedisReply r(m_dbAsic.get(), command);
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == nullptr)
+        {
+            SWSS_LOG_THROW("failed to get ASIC state write reply");
+        }
+
+        if (reply->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_ERROR("ASIC state write failed: %s", reply->str);
+
+            success = false;
+        }
+
+        freeReplyObject(reply);
+    }
+
+    if (!success)
+    {
+        SWSS_LOG_THROW("failed to write ASIC state");
     }
 }
\ No newline at end of file
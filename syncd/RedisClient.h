@@ -7,6 +7,7 @@ extern "C" {
 #include "swss/table.h"
 
 #include <string>
+#include <functional>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -16,6 +17,18 @@ namespace syncd
 {
     class RedisClient
     {
+        public:
+
+            /**
+             * @brief ASIC view object callback.
+             *
+             * Key is object key without table name, map contains object
+             * attributes, "NULL" placeholder attribute is skipped.
+             */
+            typedef std::function<void(const std::string& key, const swss::TableMap& map)> AsicObjectCallback;
+
+            static constexpr size_t DEFAULT_SCAN_PAGE_SIZE = 1000;
+
         public:
 
             RedisClient(
@@ -148,14 +161,50 @@ namespace syncd
                     _In_ const sai_object_id_t* rids,
                     _Out_ sai_object_id_t* vids);
 
+            /**
+             * @brief Get RIDs for VIDs with single redis query.
+             *
+             * Unknown VIDs will be mapped to SAI_NULL_OBJECT_ID.
+             */
+            void getRidsForVids(
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* vids,
+                    _Out_ sai_object_id_t* rids);
+
             void removeAsicStateTable();
 
             void removeTempAsicStateTable();
 
+            /**
+             * @brief Increment ASIC state generation.
+             *
+             * Every ASIC state write increments generation, this is used
+             * when ASIC state may be changed without writes (like on syncd
+             * start), to invalidate sairedis meta snapshots.
+             */
+            void incrementAsicStateGeneration() const;
+
             std::map<sai_object_id_t, swss::TableDump> getAsicView();
 
             std::map<sai_object_id_t, swss::TableDump> getTempAsicView();
 
+            /**
+             * @brief Stream ASIC view objects to callback.
+             *
+             * Table is iterated by SCAN and objects on each page are fetched
+             * by pipelined HGETALL, so only single page is kept in memory
+             * instead of entire table dump.
+             *
+             * @return Number of objects passed to callback.
+             */
+            size_t scanAsicView(
+                    _In_ const AsicObjectCallback& callback,
+                    _In_ size_t pageSize = DEFAULT_SCAN_PAGE_SIZE);
+
+            size_t scanTempAsicView(
+                    _In_ const AsicObjectCallback& callback,
+                    _In_ size_t pageSize = DEFAULT_SCAN_PAGE_SIZE);
+
             void setAsicObject(
                     _In_ const sai_object_meta_key_t& metaKey,
                     _In_ const std::string& attr,
@@ -177,9 +226,33 @@ namespace syncd
             std::map<sai_object_id_t, swss::TableDump> getAsicView(
                     _In_ const std::string &tableName);
 
+            static std::vector<std::string> makeHset(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& attrs);
+
+            /**
+             * @brief Write ASIC state and increment ASIC state generation.
+             *
+             * Commands are pipelined on ASIC DB connection together with
+             * generation increment, so write costs single round trip.
+             */
+            void writeAsicState(
+                    _In_ const std::vector<std::vector<std::string>>& commands) const;
+
+            size_t scanAsicView(
+                    _In_ const std::string &tableName,
+                    _In_ const AsicObjectCallback& callback,
+                    _In_ size_t pageSize);
+
             std::string getRedisLanesKey(
                     _In_ sai_object_id_t switchVid) const;
 
+            void getObjectIds(
+                    _In_ const std::string& hashName,
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* fields,
+                    _Out_ sai_object_id_t* values);
+
             std::string getRedisColdVidsKey(
                     _In_ sai_object_id_t switchVid) const;
 
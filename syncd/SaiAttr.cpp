@@ -35,7 +35,7 @@ SaiAttr::SaiAttr(
 
         auto val = sai_serialize_enum(m_attr.value.s32, m_meta->enummetadata);
 
-        if (val != m_str_attr_value)
+        if (val != m_str_attr_value.str())
         {
             SWSS_LOG_NOTICE("translating deprecated/ignore enum %s to %s",
                     m_str_attr_value.c_str(),
@@ -4,6 +4,8 @@ extern "C" {
 #include "saimetadata.h"
 }
 
+#include "StringPool.h"
+
 #include <string>
 #include <vector>
 
@@ -89,9 +91,15 @@ namespace syncd
 
         private:
 
-            const std::string m_str_attr_id;
+            /*
+             * Attribute id and value strings are interned, since most of
+             * attributes in large views share same id and often same
+             * value (enums, next hop OIDs).
+             */
+
+            const InternedString m_str_attr_id;
 
-            std::string m_str_attr_value;
+            InternedString m_str_attr_value;
 
             const sai_attr_metadata_t* m_meta;
 
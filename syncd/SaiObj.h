@@ -5,6 +5,7 @@ extern "C" {
 }
 
 #include "SaiAttr.h"
+#include "StringPool.h"
 
 #include <string>
 #include <memory>
@@ -133,7 +134,7 @@ namespace syncd
 
         public: // TODO to private
 
-            std::string m_str_object_type;
+            InternedString m_str_object_type;
             std::string m_str_object_id;
 
             sai_object_meta_key_t m_meta_key;
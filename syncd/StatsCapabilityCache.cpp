@@ -0,0 +1,383 @@
+#include "StatsCapabilityCache.h"
+
+#include "swss/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+using json = nlohmann::json;
+
+using namespace syncd;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+StatsCapabilityCache::StatsCapabilityCache(
+        _In_ const std::string& fileName):
+    m_fileName(fileName),
+    m_dirty(false)
+{
+    SWSS_LOG_ENTER();
+
+    load();
+}
+
+StatsCapabilityCache::~StatsCapabilityCache()
+{
+    SWSS_LOG_ENTER();
+
+    save();
+}
+
+std::string StatsCapabilityCache::makeKey(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode)
+{
+    SWSS_LOG_ENTER();
+
+    return std::to_string(objectType) + ":" + std::to_string(statsMode);
+}
+
+std::string StatsCapabilityCache::makeBulkKey(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::vector<uint32_t>& counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = makeKey(objectType, statsMode) + ":";
+
+    for (size_t idx = 0; idx < counters.size(); idx++)
+    {
+        key += (idx ? "," : "") + std::to_string(counters[idx]);
+    }
+
+    return key;
+}
+
+void StatsCapabilityCache::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_capabilities.clear();
+    m_counterSupport.clear();
+    m_bulkSupport.clear();
+}
+
+void StatsCapabilityCache::load()
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(m_fileName);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_NOTICE("stats capability cache %s not found", m_fileName.c_str());
+        return;
+    }
+
+    try
+    {
+        json j = json::parse(ifs);
+
+        m_loadedPlatform = j.at("platform").get<std::string>();
+
+        for (auto it = j.at("capabilities").begin(); it != j.at("capabilities").end(); ++it)
+        {
+            m_capabilities[it.key()] = it.value().get<std::set<uint32_t>>();
+        }
+
+        for (auto it = j.at("counters").begin(); it != j.at("counters").end(); ++it)
+        {
+            auto& support = m_counterSupport[it.key()];
+
+            for (auto c = it.value().begin(); c != it.value().end(); ++c)
+            {
+                support[(uint32_t)std::stoul(c.key())] = c.value().get<bool>();
+            }
+        }
+
+        for (auto it = j.at("bulk").begin(); it != j.at("bulk").end(); ++it)
+        {
+            m_bulkSupport[it.key()] = it.value().get<bool>();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to parse %s: %s, ignoring cache", m_fileName.c_str(), e.what());
+
+        m_loadedPlatform.clear();
+
+        clear();
+        return;
+    }
+
+    SWSS_LOG_NOTICE("loaded stats capability cache %s: %zu capabilities, %zu counter probes, %zu bulk probes",
+            m_fileName.c_str(),
+            m_capabilities.size(),
+            m_counterSupport.size(),
+            m_bulkSupport.size());
+}
+
+void StatsCapabilityCache::save()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (!m_dirty || m_platform.empty())
+    {
+        return;
+    }
+
+    json j;
+
+    j["platform"] = m_platform;
+    j["capabilities"] = json::object();
+    j["counters"] = json::object();
+    j["bulk"] = json::object();
+
+    for (auto& kv: m_capabilities)
+    {
+        j["capabilities"][kv.first] = kv.second;
+    }
+
+    for (auto& kv: m_counterSupport)
+    {
+        json counters = json::object();
+
+        for (auto& c: kv.second)
+        {
+            counters[std::to_string(c.first)] = c.second;
+        }
+
+        j["counters"][kv.first] = counters;
+    }
+
+    for (auto& kv: m_bulkSupport)
+    {
+        j["bulk"][kv.first] = kv.second;
+    }
+
+    std::string tmp = m_fileName + ".tmp";
+
+    std::ofstream ofs(tmp);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s for writing", tmp.c_str());
+        return;
+    }
+
+    ofs << j.dump(4) << std::endl;
+
+    ofs.close();
+
+    if (std::rename(tmp.c_str(), m_fileName.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s", tmp.c_str(), m_fileName.c_str());
+        return;
+    }
+
+    m_dirty = false;
+}
+
+void StatsCapabilityCache::setPlatform(
+        _In_ const std::string& platform)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_platform = platform;
+
+    if (m_loadedPlatform == platform)
+    {
+        return;
+    }
+
+    if (!m_loadedPlatform.empty())
+    {
+        SWSS_LOG_NOTICE("platform changed from '%s' to '%s', invalidating stats capability cache",
+                m_loadedPlatform.c_str(),
+                platform.c_str());
+    }
+
+    clear();
+
+    m_loadedPlatform = platform;
+
+    m_dirty = true;
+}
+
+bool StatsCapabilityCache::hasPlatform() const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return !m_platform.empty();
+}
+
+bool StatsCapabilityCache::getCapability(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _Out_ std::set<uint32_t>& counters) const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return false;
+    }
+
+    auto it = m_capabilities.find(makeKey(objectType, statsMode));
+
+    if (it == m_capabilities.end())
+    {
+        return false;
+    }
+
+    counters = it->second;
+
+    return true;
+}
+
+void StatsCapabilityCache::setCapability(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::set<uint32_t>& counters)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return;
+    }
+
+    auto& entry = m_capabilities[makeKey(objectType, statsMode)];
+
+    if (entry != counters)
+    {
+        entry = counters;
+        m_dirty = true;
+    }
+}
+
+bool StatsCapabilityCache::getCounterSupport(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ uint32_t counter,
+        _Out_ bool& supported) const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return false;
+    }
+
+    auto it = m_counterSupport.find(makeKey(objectType, statsMode));
+
+    if (it == m_counterSupport.end())
+    {
+        return false;
+    }
+
+    auto c = it->second.find(counter);
+
+    if (c == it->second.end())
+    {
+        return false;
+    }
+
+    supported = c->second;
+
+    return true;
+}
+
+void StatsCapabilityCache::setCounterSupport(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ uint32_t counter,
+        _In_ bool supported)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return;
+    }
+
+    auto& support = m_counterSupport[makeKey(objectType, statsMode)];
+
+    auto it = support.find(counter);
+
+    if (it == support.end() || it->second != supported)
+    {
+        support[counter] = supported;
+        m_dirty = true;
+    }
+}
+
+bool StatsCapabilityCache::getBulkSupport(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::vector<uint32_t>& counters,
+        _Out_ bool& supported) const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return false;
+    }
+
+    auto it = m_bulkSupport.find(makeBulkKey(objectType, statsMode, counters));
+
+    if (it == m_bulkSupport.end())
+    {
+        return false;
+    }
+
+    supported = it->second;
+
+    return true;
+}
+
+void StatsCapabilityCache::setBulkSupport(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::vector<uint32_t>& counters,
+        _In_ bool supported)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (m_platform.empty())
+    {
+        return;
+    }
+
+    auto key = makeBulkKey(objectType, statsMode, counters);
+
+    auto it = m_bulkSupport.find(key);
+
+    if (it == m_bulkSupport.end() || it->second != supported)
+    {
+        m_bulkSupport[key] = supported;
+        m_dirty = true;
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Stats capability cache.
+     *
+     * Caches results of stats capability queries, per counter getStats
+     * probes and trial bulkGetStats calls, so flex counter registration
+     * can skip probing. Cache is persisted to file and is valid only for
+     * platform (ASIC hardware info and SAI version) it was created on.
+     *
+     * Entries are keyed by object type and stats mode, bulk capability
+     * also by counter set.
+     */
+    class StatsCapabilityCache
+    {
+        private:
+
+            StatsCapabilityCache(const StatsCapabilityCache&) = delete;
+            StatsCapabilityCache& operator=(const StatsCapabilityCache&) = delete;
+
+        public:
+
+            StatsCapabilityCache(
+                    _In_ const std::string& fileName);
+
+            virtual ~StatsCapabilityCache();
+
+        public:
+
+            /**
+             * @brief Set current platform.
+             *
+             * Cache loaded from file is dropped if it was created on
+             * different platform. Lookups fail until platform is set.
+             */
+            void setPlatform(
+                    _In_ const std::string& platform);
+
+            bool hasPlatform() const;
+
+            bool getCapability(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _Out_ std::set<uint32_t>& counters) const;
+
+            void setCapability(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::set<uint32_t>& counters);
+
+            bool getCounterSupport(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ uint32_t counter,
+                    _Out_ bool& supported) const;
+
+            void setCounterSupport(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ uint32_t counter,
+                    _In_ bool supported);
+
+            bool getBulkSupport(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::vector<uint32_t>& counters,
+                    _Out_ bool& supported) const;
+
+            void setBulkSupport(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::vector<uint32_t>& counters,
+                    _In_ bool supported);
+
+            /**
+             * @brief Write cache to file if it was modified.
+             */
+            void save();
+
+        private:
+
+            static std::string makeKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode);
+
+            static std::string makeBulkKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::vector<uint32_t>& counters);
+
+            void load();
+
+            void clear();
+
+        private:
+
+            std::string m_fileName;
+
+            mutable std::mutex m_mutex;
+
+            bool m_dirty;
+
+            /**
+             * @brief Platform of current process, empty until set.
+             */
+            std::string m_platform;
+
+            /**
+             * @brief Platform cache was loaded for.
+             */
+            std::string m_loadedPlatform;
+
+            std::map<std::string, std::set<uint32_t>> m_capabilities;
+
+            std::map<std::string, std::map<uint32_t, bool>> m_counterSupport;
+
+            std::map<std::string, bool> m_bulkSupport;
+    };
+}
@@ -0,0 +1,230 @@
+#include "StringPool.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+StringPool& StringPool::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    static StringPool* pool = new StringPool();
+
+    return *pool;
+}
+
+StringPool::Entry::Entry(
+        _In_ const std::string& str):
+    m_str(str),
+    m_refCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+StringPool::Entry* StringPool::acquire(
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(std::cref(str));
+
+    if (it != m_index.end())
+    {
+        it->second->m_refCount.fetch_add(1, std::memory_order_relaxed);
+
+        return it->second;
+    }
+
+    m_entries.emplace_back(str);
+
+    auto& entry = m_entries.back();
+
+    entry.m_position = std::prev(m_entries.end());
+    entry.m_refCount.store(1, std::memory_order_relaxed);
+
+    m_index.emplace(std::cref(entry.m_str), &entry);
+
+    return &entry;
+}
+
+void StringPool::acquire(
+        _In_ Entry* entry)
+{
+    SWSS_LOG_ENTER();
+
+    // caller holds reference, so entry can't be released meanwhile
+
+    entry->m_refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void StringPool::release(
+        _In_ Entry* entry)
+{
+    SWSS_LOG_ENTER();
+
+    size_t refCount = entry->m_refCount.load(std::memory_order_relaxed);
+
+    while (refCount > 1)
+    {
+        if (entry->m_refCount.compare_exchange_weak(refCount, refCount - 1, std::memory_order_release, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    /*
+     * Last reference is released under lock, since acquire of string is
+     * also under lock, reference count can't go up from zero before entry
+     * is erased.
+     */
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (entry->m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        m_index.erase(std::cref(entry->m_str));
+
+        m_entries.erase(entry->m_position);
+    }
+}
+
+size_t StringPool::size() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries.size();
+}
+
+InternedString::InternedString():
+    m_entry(nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+InternedString::InternedString(
+        _In_ const std::string& str):
+    m_entry(StringPool::getInstance().acquire(str))
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+InternedString::InternedString(
+        _In_ const char* str):
+    m_entry(StringPool::getInstance().acquire(str))
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+InternedString::InternedString(
+        _In_ const InternedString& other):
+    m_entry(other.m_entry)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_entry)
+    {
+        StringPool::getInstance().acquire(m_entry);
+    }
+}
+
+InternedString::InternedString(
+        _In_ InternedString&& other):
+    m_entry(other.m_entry)
+{
+    SWSS_LOG_ENTER();
+
+    other.m_entry = nullptr;
+}
+
+InternedString::~InternedString()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_entry)
+    {
+        StringPool::getInstance().release(m_entry);
+    }
+}
+
+InternedString& InternedString::operator=(
+        _In_ const InternedString& other)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_entry != other.m_entry)
+    {
+        InternedString tmp(other);
+
+        std::swap(m_entry, tmp.m_entry);
+    }
+
+    return *this;
+}
+
+InternedString& InternedString::operator=(
+        _In_ InternedString&& other)
+{
+    SWSS_LOG_ENTER();
+
+    std::swap(m_entry, other.m_entry);
+
+    return *this;
+}
+
+bool InternedString::operator==(
+        _In_ const InternedString& other) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entry == other.m_entry;
+}
+
+bool InternedString::operator!=(
+        _In_ const InternedString& other) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entry != other.m_entry;
+}
+
+InternedString::operator const std::string&() const
+{
+    SWSS_LOG_ENTER();
+
+    return str();
+}
+
+const std::string& InternedString::str() const
+{
+    SWSS_LOG_ENTER();
+
+    static const std::string empty;
+
+    return m_entry ? m_entry->m_str : empty;
+}
+
+const char* InternedString::c_str() const
+{
+    SWSS_LOG_ENTER();
+
+    return str().c_str();
+}
+
+size_t InternedString::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return str().size();
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <list>
+#include <functional>
+#include <unordered_map>
+
+namespace syncd
+{
+    /**
+     * @brief Reference counted string pool.
+     *
+     * ASIC views contain millions of repeated strings (object types,
+     * attribute ids, enum and OID values), pool keeps single copy of each
+     * string as long as it is referenced by any InternedString.
+     *
+     * Reference count is atomic, pool is locked only when string is
+     * interned and when last reference is released.
+     */
+    class StringPool
+    {
+        private:
+
+            StringPool(const StringPool&) = delete;
+            StringPool& operator=(const StringPool&) = delete;
+
+        public:
+
+            class Entry
+            {
+                public:
+
+                    Entry(
+                            _In_ const std::string& str);
+
+                public:
+
+                    const std::string m_str;
+
+                    std::atomic<size_t> m_refCount;
+
+                    /**
+                     * @brief Position of entry in pool, it stays valid
+                     * until entry is erased.
+                     */
+                    std::list<Entry>::iterator m_position;
+            };
+
+            typedef std::unordered_map<
+                std::reference_wrapper<const std::string>,
+                Entry*,
+                std::hash<std::string>,
+                std::equal_to<std::string>> Index;
+
+        public:
+
+            StringPool() = default;
+
+            virtual ~StringPool() = default;
+
+        public:
+
+            /**
+             * @brief Get process wide pool.
+             *
+             * Pool is never destroyed, so views in static objects can be
+             * safely released at exit.
+             */
+            static StringPool& getInstance();
+
+            /**
+             * @brief Intern string and increase its reference count.
+             */
+            Entry* acquire(
+                    _In_ const std::string& str);
+
+            /**
+             * @brief Increase reference count of already referenced entry.
+             */
+            void acquire(
+                    _In_ Entry* entry);
+
+            /**
+             * @brief Decrease reference count, string is removed from pool
+             * when no longer referenced.
+             */
+            void release(
+                    _In_ Entry* entry);
+
+            /**
+             * @brief Number of unique strings in pool.
+             */
+            size_t size() const;
+
+        private:
+
+            mutable std::mutex m_mutex;
+
+            std::list<Entry> m_entries;
+
+            /**
+             * @brief Entries by string, keys refer to strings of entries.
+             */
+            Index m_index;
+    };
+
+    /**
+     * @brief Handle to string in StringPool.
+     *
+     * Equal strings share same storage, handle is size of pointer.
+     */
+    class InternedString
+    {
+        public:
+
+            InternedString();
+
+            InternedString(
+                    _In_ const std::string& str);
+
+            InternedString(
+                    _In_ const char* str);
+
+            InternedString(
+                    _In_ const InternedString& other);
+
+            InternedString(
+                    _In_ InternedString&& other);
+
+            ~InternedString();
+
+        public:
+
+            InternedString& operator=(
+                    _In_ const InternedString& other);
+
+            InternedString& operator=(
+                    _In_ InternedString&& other);
+
+            bool operator==(
+                    _In_ const InternedString& other) const;
+
+            bool operator!=(
+                    _In_ const InternedString& other) const;
+
+            operator const std::string&() const;
+
+        public:
+
+            const std::string& str() const;
+
+            const char* c_str() const;
+
+            size_t size() const;
+
+        private:
+
+            StringPool::Entry* m_entry;
+    };
+}
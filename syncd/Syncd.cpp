@@ -13,6 +13,7 @@
 #include "ZeroMQNotificationProducer.h"
 #include "WatchdogScope.h"
 #include "VendorSaiOptions.h"
+#include "BulkAttributeDecoder.h"
 
 #include "sairediscommon.h"
 
@@ -34,9 +35,11 @@
 
 #include <unistd.h>
 #include <inttypes.h>
+#include <sys/resource.h>
 
 #include <iterator>
 #include <algorithm>
+#include <chrono>
 
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 #define SAI_FAILURE_DUMP_SCRIPT "/usr/bin/sai_failure_dump.sh"
@@ -115,7 +118,22 @@ Syncd::Syncd(
 
     m_vendorSai->setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
 
-    m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters, m_commandLineOptions->m_supportingBulkCounterGroups);
+    m_manager = std::make_shared<FlexCounterManager>(
+            m_vendorSai,
+            m_contextConfig->m_dbCounters,
+            m_commandLineOptions->m_supportingBulkCounterGroups,
+            m_commandLineOptions->m_statsCapabilityCacheFile);
+
+    if (m_commandLineOptions->m_latencyHistogramInterval > 0)
+    {
+        // exporter is using its own connection since it runs in separate thread
+
+        m_latencyHistogramExporter = std::make_shared<LatencyHistogramExporter>(
+                std::make_shared<swss::DBConnector>(m_contextConfig->m_dbCounters, 0),
+                std::chrono::seconds(m_commandLineOptions->m_latencyHistogramInterval));
+
+        m_latencyHistogramExporter->start();
+    }
 
     loadProfileMap();
 
@@ -427,6 +445,9 @@ sai_status_t Syncd::processSingleEvent(
     if (op == REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP)
         return processFlexCounterGroupEvent(key, DEL_COMMAND, kfvFieldsValues(kco));
 
+    if (op == REDIS_FLEX_COUNTER_COMMAND_BULK_POLL)
+        return processBulkFlexCounterEvent(kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY)
         return processStatsCapabilityQuery(kco);
 
@@ -1011,8 +1032,6 @@ sai_status_t Syncd::processBulkQuadEvent(
 
     const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
 
-    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
-
     // field = objectId
     // value = attrid=attrvalue|...
 
@@ -1020,39 +1039,15 @@ sai_status_t Syncd::processBulkQuadEvent(
 
     std::vector<std::shared_ptr<SaiAttributeList>> attributes;
 
-    for (const auto &fvt: values)
-    {
-        std::string strObjectId = fvField(fvt);
-        std::string joined = fvValue(fvt);
-
-        // decode values
-
-        auto v = swss::tokenize(joined, '|');
-
-        objectIds.push_back(strObjectId);
-
-        std::vector<swss::FieldValueTuple> entries; // attributes per object id
-
-        for (size_t i = 0; i < v.size(); ++i)
-        {
-            const std::string item = v.at(i);
-
-            auto start = item.find_first_of("=");
-
-            auto field = item.substr(0, start);
-            auto value = item.substr(start + 1);
-
-            entries.emplace_back(field, value);
-        }
-
-        strAttributes.push_back(entries);
-
-        // since now we converted this to proper list, we can extract attributes
-
-        auto list = std::make_shared<SaiAttributeList>(objectType, entries, false);
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
 
-        attributes.push_back(list);
-    }
+    BulkAttributeDecoder::decode(
+            objectType,
+            values,
+            m_commandLineOptions->m_bulkDecodeThreads,
+            objectIds,
+            attributes,
+            strAttributes);
 
     SWSS_LOG_INFO("bulk %s executing with %zu items",
             strObjectType.c_str(),
@@ -1239,6 +1234,12 @@ sai_status_t Syncd::processBulkCreateEntry(
 
     sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
 
+    // VIDs in entry keys are translated to RIDs in single batch
+
+    std::vector<sai_object_id_t*> oids;
+
+    oids.reserve(2 * object_count);
+
     std::vector<uint32_t> attr_counts(object_count);
     std::vector<const sai_attribute_t*> attr_lists(object_count);
 
@@ -1257,10 +1258,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             static PerformanceIntervalTimer timer("Syncd::processBulkCreateEntry(route_entry) CREATE");
 
             timer.start();
@@ -1286,10 +1289,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_neighbor_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].rif_id = m_translator->translateVidToRid(entries[it].rif_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].rif_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1307,10 +1312,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].bv_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1329,10 +1336,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1351,9 +1360,11 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1373,10 +1384,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1395,9 +1408,11 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_direction_lookup_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1416,9 +1431,11 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_eni_ether_address_map_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1437,9 +1454,11 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_vip_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1458,10 +1477,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_inbound_routing_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].eni_id = m_translator->translateVidToRid(entries[it].eni_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].eni_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1480,10 +1501,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_pa_validation_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vnet_id = m_translator->translateVidToRid(entries[it].vnet_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vnet_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1502,10 +1525,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_outbound_routing_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].outbound_routing_group_id = m_translator->translateVidToRid(entries[it].outbound_routing_group_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].outbound_routing_group_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1524,10 +1549,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_outbound_ca_to_pa_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].dst_vnet_id = m_translator->translateVidToRid(entries[it].dst_vnet_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].dst_vnet_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1546,10 +1573,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_outbound_port_map_port_range_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].outbound_port_map_id = m_translator->translateVidToRid(entries[it].outbound_port_map_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].outbound_port_map_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1568,9 +1597,11 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_global_trusted_vni_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1589,10 +1620,12 @@ sai_status_t Syncd::processBulkCreateEntry(
             {
                 sai_deserialize_eni_trusted_vni_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].eni_id = m_translator->translateVidToRid(entries[it].eni_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].eni_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1629,6 +1662,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
 
     sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
 
+    // VIDs in entry keys are translated to RIDs in single batch
+
+    std::vector<sai_object_id_t*> oids;
+
+    oids.reserve(2 * object_count);
+
     switch ((int)objectType)
     {
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
@@ -1638,10 +1677,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1658,10 +1699,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_neighbor_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].rif_id = m_translator->translateVidToRid(entries[it].rif_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].rif_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1677,10 +1720,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].bv_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1697,10 +1742,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1718,10 +1765,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1737,9 +1786,11 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1756,9 +1807,11 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_direction_lookup_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1775,9 +1828,11 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_eni_ether_address_map_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1794,9 +1849,11 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_vip_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1813,10 +1870,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_inbound_routing_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].eni_id = m_translator->translateVidToRid(entries[it].eni_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].eni_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1833,10 +1892,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_pa_validation_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vnet_id = m_translator->translateVidToRid(entries[it].vnet_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vnet_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1853,10 +1914,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_outbound_routing_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].outbound_routing_group_id = m_translator->translateVidToRid(entries[it].outbound_routing_group_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].outbound_routing_group_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1873,10 +1936,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_outbound_ca_to_pa_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].dst_vnet_id = m_translator->translateVidToRid(entries[it].dst_vnet_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].dst_vnet_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1893,10 +1958,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_outbound_port_map_port_range_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].outbound_port_map_id = m_translator->translateVidToRid(entries[it].outbound_port_map_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].outbound_port_map_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1913,9 +1980,11 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_global_trusted_vni_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1932,10 +2001,12 @@ sai_status_t Syncd::processBulkRemoveEntry(
             {
                 sai_deserialize_eni_trusted_vni_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].eni_id = m_translator->translateVidToRid(entries[it].eni_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].eni_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkRemove(
                     object_count,
                     entries.data(),
@@ -1974,6 +2045,12 @@ sai_status_t Syncd::processBulkSetEntry(
 
     sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
 
+    // VIDs in entry keys are translated to RIDs in single batch
+
+    std::vector<sai_object_id_t*> oids;
+
+    oids.reserve(2 * object_count);
+
     for (uint32_t it = 0; it < object_count; it++)
     {
         attr_lists.push_back(attributes[it]->get_attr_list()[0]);
@@ -1988,10 +2065,12 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -2009,10 +2088,12 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_neighbor_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].rif_id = m_translator->translateVidToRid(entries[it].rif_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].rif_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -2029,10 +2110,12 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].bv_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -2050,10 +2133,12 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -2072,10 +2157,12 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-                entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
+                oids.push_back(&entries[it].switch_id);
+                oids.push_back(&entries[it].vr_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -2092,9 +2179,11 @@ sai_status_t Syncd::processBulkSetEntry(
             {
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
-                entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
+                oids.push_back(&entries[it].switch_id);
             }
 
+            m_translator->translateVidsToRids(oids.size(), oids.data());
+
             status = m_vendorSai->bulkSet(
                     object_count,
                     entries.data(),
@@ -3125,16 +3214,74 @@ sai_status_t Syncd::processFlexCounterEvent(
 {
     SWSS_LOG_ENTER();
 
-    auto delimiter = key.find_first_of(":");
+    auto status = applyFlexCounterEvent(key, op, values, fromAsicChannel);
 
-    if (delimiter == std::string::npos)
+    if (fromAsicChannel)
     {
-        SWSS_LOG_ERROR("Failed to parse the key %s", key.c_str());
+        sendApiResponse(SAI_COMMON_API_SET, status);
+    }
 
-        if (fromAsicChannel)
+    return status;
+}
+
+sai_status_t Syncd::processBulkFlexCounterEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& entries = kfvFieldsValues(kco);
+
+    std::vector<sai_status_t> statuses(entries.size());
+
+    sai_status_t all = SAI_STATUS_SUCCESS;
+
+    for (size_t idx = 0; idx < entries.size(); idx++)
+    {
+        // field: counter key
+        // value: field=value|field=value, empty to stop polling
+
+        std::vector<swss::FieldValueTuple> values;
+
+        for (auto& token: swss::tokenize(fvValue(entries[idx]), '|'))
+        {
+            auto pos = token.find('=');
+
+            if (pos != std::string::npos)
+            {
+                values.emplace_back(token.substr(0, pos), token.substr(pos + 1));
+            }
+        }
+
+        statuses[idx] = applyFlexCounterEvent(
+                fvField(entries[idx]),
+                values.empty() ? DEL_COMMAND : SET_COMMAND,
+                values,
+                true);
+
+        if (statuses[idx] != SAI_STATUS_SUCCESS)
         {
-            sendApiResponse(SAI_COMMON_API_SET, SAI_STATUS_FAILURE);
+            all = SAI_STATUS_FAILURE;
         }
+    }
+
+    sendApiResponse(SAI_COMMON_API_BULK_SET, all, (uint32_t)statuses.size(), statuses.data());
+
+    return all;
+}
+
+sai_status_t Syncd::applyFlexCounterEvent(
+        _In_ const std::string &key,
+        _In_ const std::string &op,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ bool fromAsicChannel)
+{
+    SWSS_LOG_ENTER();
+
+    auto delimiter = key.find_first_of(":");
+
+    if (delimiter == std::string::npos)
+    {
+        SWSS_LOG_ERROR("Failed to parse the key %s", key.c_str());
 
         return SAI_STATUS_FAILURE; // if key is invalid there is no need to process this event again
     }
@@ -3176,11 +3323,6 @@ sai_status_t Syncd::processFlexCounterEvent(
             m_flexCounterTable->set(singleKey, values);
         }
 
-        if (fromAsicChannel)
-        {
-            sendApiResponse(SAI_COMMON_API_SET, SAI_STATUS_SUCCESS);
-        }
-
         return SAI_STATUS_SUCCESS;
     }
 
@@ -3231,11 +3373,6 @@ sai_status_t Syncd::processFlexCounterEvent(
         }
     }
 
-    if (fromAsicChannel)
-    {
-        sendApiResponse(SAI_COMMON_API_SET, SAI_STATUS_SUCCESS);
-    }
-
     return SAI_STATUS_SUCCESS;
 }
 
@@ -3516,6 +3653,21 @@ sai_status_t Syncd::processQuadEvent(
 
     auto info = sai_metadata_get_object_type_info(metaKey.objecttype);
 
+    // per API x object type x switch latency, indexed by sai_common_api_t
+
+    static PerformanceIntervalTimer apiTimers[] = {
+        "Syncd::processQuadEvent(create)",
+        "Syncd::processQuadEvent(remove)",
+        "Syncd::processQuadEvent(set)",
+        "Syncd::processQuadEvent(get)" };
+
+    PerformanceIntervalTimer* apiTimer = (api <= SAI_COMMON_API_GET) ? &apiTimers[api] : nullptr;
+
+    if (apiTimer)
+    {
+        apiTimer->start();
+    }
+
     sai_status_t status;
 
     if (info->isnonobjectid)
@@ -3542,6 +3694,15 @@ sai_status_t Syncd::processQuadEvent(
         status = processOid(metaKey.objecttype, strObjectId, api, attr_count, attr_list);
     }
 
+    if (apiTimer)
+    {
+        apiTimer->stop();
+
+        // switch_id is first member of all entry structs, so it aliases object_id
+
+        apiTimer->inc(1, metaKey.objecttype, VidManager::switchIdQuery(metaKey.objectkey.key.object_id));
+    }
+
     if (api == SAI_COMMON_API_GET)
     {
         if (status != SAI_STATUS_SUCCESS)
@@ -4726,8 +4887,25 @@ sai_status_t Syncd::applyView()
 
     // Read current and temporary views from REDIS.
 
-    auto currentMap = m_client->getAsicView();
-    auto temporaryMap = m_client->getTempAsicView();
+    std::map<sai_object_id_t, std::shared_ptr<AsicView>> currentMap;
+    std::map<sai_object_id_t, std::shared_ptr<AsicView>> temporaryMap;
+
+    try
+    {
+        currentMap = loadAsicViews(false);
+        temporaryMap = loadAsicViews(true);
+    }
+    catch (const std::exception &e)
+    {
+        /*
+         * Views are built while streaming from redis, this is still part of
+         * first stage, so failure is non destructive.
+         */
+
+        SWSS_LOG_ERROR("Exception: %s", e.what());
+
+        return SAI_STATUS_FAILURE;
+    }
 
     if (currentMap.size() != temporaryMap.size())
     {
@@ -4780,8 +4958,8 @@ sai_status_t Syncd::applyView()
              * Each ASIC view at this point will contain only 1 switch.
              */
 
-            auto current = std::make_shared<AsicView>(currentMap.at(switchVid));
-            auto temp = std::make_shared<AsicView>(temporaryMap.at(switchVid));
+            auto current = currentMap.at(switchVid);
+            auto temp = temporaryMap.at(switchVid);
 
             auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig);
 
@@ -4837,6 +5015,69 @@ sai_status_t Syncd::applyView()
     return SAI_STATUS_SUCCESS;
 }
 
+std::map<sai_object_id_t, std::shared_ptr<AsicView>> Syncd::loadAsicViews(
+        _In_ bool temporary)
+{
+    SWSS_LOG_ENTER();
+
+    const char* name = temporary ? "temporary" : "current";
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::map<sai_object_id_t, std::shared_ptr<AsicView>> views;
+
+    // objects are inserted into views as they arrive, so entire table dump
+    // is never kept in memory next to views
+
+    auto callback = [&](const std::string& key, const swss::TableMap& map)
+    {
+        sai_object_meta_key_t mk;
+        sai_deserialize_object_meta_key(key, mk);
+
+        auto switchVid = VidManager::switchIdQuery(mk.objectkey.key.object_id);
+
+        auto& view = views[switchVid];
+
+        if (view == nullptr)
+        {
+            view = std::make_shared<AsicView>();
+        }
+
+        view->insertObject(key, map);
+    };
+
+    size_t count = temporary
+        ? m_client->scanTempAsicView(callback)
+        : m_client->scanAsicView(callback);
+
+    for (auto& kvp: views)
+    {
+        // each ASIC view at this point should contain only 1 switch
+
+        kvp.second->checkSwitchCount();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        usage.ru_maxrss = 0;
+    }
+
+    SWSS_LOG_NOTICE("loaded %s view: %zu objects, %zu switches in %.3f sec, peak RSS %ld KB",
+            name,
+            count,
+            views.size(),
+            seconds,
+            usage.ru_maxrss);
+
+    return views;
+}
+
 void Syncd::dumpComparisonLogicOutput(
     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews)
 {
@@ -4977,6 +5218,10 @@ void Syncd::onSyncdStart(
 
     SWSS_LOG_TIMER("on syncd start");
 
+    // ASIC view may be changed by warm restart or removed by hard reinit
+
+    m_client->incrementAsicStateGeneration();
+
     if (warmStart)
     {
         /*
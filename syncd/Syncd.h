@@ -21,6 +21,7 @@
 
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
+#include "meta/LatencyHistogramExporter.h"
 
 #include "swss/consumertable.h"
 #include "swss/producertable.h"
@@ -216,6 +217,18 @@ namespace syncd
                     _In_ const std::vector<swss::FieldValueTuple> &values,
                     _In_ bool fromAsicChannel=true);
 
+            sai_status_t processBulkFlexCounterEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            /**
+             * @brief Apply flex counter event without sending response.
+             */
+            sai_status_t applyFlexCounterEvent(
+                    _In_ const std::string &key,
+                    _In_ const std::string &op,
+                    _In_ const std::vector<swss::FieldValueTuple> &values,
+                    _In_ bool fromAsicChannel);
+
         private: // process quad oid
 
             sai_status_t processOidCreate(
@@ -326,6 +339,15 @@ namespace syncd
 
             sai_status_t applyView();
 
+            /**
+             * @brief Load current or temporary ASIC views from redis.
+             *
+             * Objects are streamed from database directly into views, one
+             * view per switch VID.
+             */
+            std::map<sai_object_id_t, std::shared_ptr<AsicView>> loadAsicViews(
+                    _In_ bool temporary);
+
             void dumpComparisonLogicOutput(
                     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews);
 
@@ -539,6 +561,8 @@ namespace syncd
 
             TimerWatchdog m_timerWatchdog;
 
+            std::shared_ptr<sairediscommon::LatencyHistogramExporter> m_latencyHistogramExporter;
+
             std::set<sai_object_id_t> m_createdInInitView;
     };
 }
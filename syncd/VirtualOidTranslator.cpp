@@ -7,6 +7,8 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+
 using namespace syncd;
 
 VirtualOidTranslator::VirtualOidTranslator(
@@ -38,11 +40,10 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
         return true;
     }
 
-    auto it = m_rid2vid.find(vid);
+    vid = m_rid2vid.lookup(rid);
 
-    if (it != m_rid2vid.end())
+    if (vid != SAI_NULL_OBJECT_ID)
     {
-        vid = it->second;
         return true;
     }
 
@@ -78,16 +79,14 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
         return SAI_NULL_OBJECT_ID;
     }
 
-    auto it = m_rid2vid.find(rid);
+    auto vid = m_rid2vid.lookup(rid);
 
-    if (it != m_rid2vid.end())
+    if (vid != SAI_NULL_OBJECT_ID)
     {
-        return it->second;
+        return vid;
     }
 
-    std::string strRid = sai_serialize_object_id(rid);
-
-    auto vid = m_client->getVidForRid(rid);
+    vid = m_client->getVidForRid(rid);
 
     if (vid != SAI_NULL_OBJECT_ID)
     {
@@ -141,8 +140,8 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
 
     m_client->insertVidAndRid(vid, rid);
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    m_rid2vid.insert(rid, vid);
+    m_vid2rid.insert(vid, rid);
 
     return vid;
 }
@@ -158,10 +157,40 @@ void VirtualOidTranslator::translateRidsToVids(
     std::lock_guard<std::mutex> lock(m_mutex);
 
     /*
-     * Fetch VIDs for given RIDs from database.
-     * Unknown RID's will be mapped to SAI_NULL_OBJECT_ID in vids array.
+     * Get VIDs for given RIDs from local cache, only RIDs missing there are
+     * fetched from database. Unknown RID's will be mapped to
+     * SAI_NULL_OBJECT_ID in vids array.
      */
-    m_client->getVidsForRids(count, rids, vids);
+    std::vector<size_t> missing;
+    missing.reserve(m_rid2vid.lookup(count, rids, vids));
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (vids[idx] == SAI_NULL_OBJECT_ID)
+        {
+            missing.push_back(idx);
+        }
+    }
+
+    if (missing.empty())
+    {
+        return;
+    }
+
+    std::vector<sai_object_id_t> missingRids(missing.size());
+    std::vector<sai_object_id_t> missingVids(missing.size());
+
+    for (size_t idx = 0; idx < missing.size(); idx++)
+    {
+        missingRids[idx] = rids[missing[idx]];
+    }
+
+    m_client->getVidsForRids(missing.size(), missingRids.data(), missingVids.data());
+
+    for (size_t idx = 0; idx < missing.size(); idx++)
+    {
+        vids[missing[idx]] = missingVids[idx];
+    }
 
     std::vector<sai_object_id_t> newRids;
     std::vector<sai_object_id_t> newVids;
@@ -213,10 +242,10 @@ void VirtualOidTranslator::translateRidsToVids(
         }
     }
 
-    for (size_t idx = 0; idx < count; idx++)
+    for (auto idx: missing)
     {
-        m_rid2vid[rids[idx]] = vids[idx];
-        m_vid2rid[vids[idx]] = rids[idx];
+        m_rid2vid.insert(rids[idx], vids[idx]);
+        m_vid2rid.insert(vids[idx], rids[idx]);
     }
 }
 
@@ -231,7 +260,7 @@ bool VirtualOidTranslator::checkRidExists(
     if (rid == SAI_NULL_OBJECT_ID)
         return true;
 
-    if (m_rid2vid.find(rid) != m_rid2vid.end())
+    if (m_rid2vid.lookup(rid) != SAI_NULL_OBJECT_ID)
         return true;
 
     auto vid = m_client->getVidForRid(rid);
@@ -255,10 +284,32 @@ void VirtualOidTranslator::translateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < element.count; i++)
+    std::vector<sai_object_id_t> vids(element.count);
+
+    size_t missing;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        missing = m_rid2vid.lookup(element.count, element.list, vids.data());
+    }
+
+    /*
+     * RIDs not present in local cache (new, removed or null) are translated
+     * one by one, since they may need new VID to be allocated.
+     */
+
+    for (uint32_t i = 0; i < element.count && missing; i++)
     {
-        element.list[i] = translateRidToVid(element.list[i], switchVid, translateRemoved);
+        if (vids[i] == SAI_NULL_OBJECT_ID)
+        {
+            vids[i] = translateRidToVid(element.list[i], switchVid, translateRemoved);
+
+            missing--;
+        }
     }
+
+    std::copy(vids.begin(), vids.end(), element.list);
 }
 
 void VirtualOidTranslator::translateRidToVid(
@@ -355,14 +406,14 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
         return SAI_NULL_OBJECT_ID;
     }
 
-    auto it = m_vid2rid.find(vid);
+    auto rid = m_vid2rid.lookup(vid);
 
-    if (it != m_vid2rid.end())
+    if (rid != SAI_NULL_OBJECT_ID)
     {
-        return it->second;
+        return rid;
     }
 
-    auto rid = m_client->getRidForVid(vid);
+    rid = m_client->getRidForVid(vid);
 
     if (rid == SAI_NULL_OBJECT_ID)
     {
@@ -390,7 +441,7 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
      * faster to retrieve it late on.
      */
 
-    m_vid2rid[vid] = rid;
+    m_vid2rid.insert(vid, rid);
 
     SWSS_LOG_DEBUG("translated VID %s to RID %s",
             sai_serialize_object_id(vid).c_str(),
@@ -399,6 +450,83 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
     return rid;
 }
 
+void VirtualOidTranslator::translateVidsToRids(
+        _In_ size_t count,
+        _Inout_ sai_object_id_t* const* oids)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Most of entries in bulk share the same switch and virtual router, so
+     * number of unique VIDs is usually very small compared to count.
+     */
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> translated;
+
+    std::vector<sai_object_id_t> missingVids;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            sai_object_id_t vid = *oids[idx];
+
+            if (vid == SAI_NULL_OBJECT_ID || translated.find(vid) != translated.end())
+            {
+                continue;
+            }
+
+            auto rid = m_vid2rid.lookup(vid);
+
+            translated[vid] = rid;
+
+            if (rid == SAI_NULL_OBJECT_ID)
+            {
+                missingVids.push_back(vid);
+            }
+        }
+
+        if (missingVids.size())
+        {
+            std::vector<sai_object_id_t> missingRids(missingVids.size());
+
+            m_client->getRidsForVids(missingVids.size(), missingVids.data(), missingRids.data());
+
+            for (size_t idx = 0; idx < missingVids.size(); idx++)
+            {
+                if (missingRids[idx] == SAI_NULL_OBJECT_ID)
+                {
+                    SWSS_LOG_THROW("unable to get RID for VID %s",
+                            sai_serialize_object_id(missingVids[idx]).c_str());
+                }
+
+                /*
+                 * We got this RID from redis db, so put it also to local db
+                 * so it will be faster to retrieve it late on.
+                 */
+
+                m_vid2rid.insert(missingVids[idx], missingRids[idx]);
+
+                translated[missingVids[idx]] = missingRids[idx];
+            }
+        }
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (*oids[idx] != SAI_NULL_OBJECT_ID)
+        {
+            *oids[idx] = translated[*oids[idx]];
+        }
+    }
+
+    SWSS_LOG_DEBUG("translated %zu VIDs to RIDs, %zu unique, %zu from redis",
+            count,
+            translated.size(),
+            missingVids.size());
+}
+
 /*
  * NOTE: We could have in metadata utils option to execute function on each
  * object on oid like this.  Problem is that we can't then add extra
@@ -421,11 +549,10 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
         return true;
     }
 
-    auto it = m_vid2rid.find(vid);
+    rid = m_vid2rid.lookup(vid);
 
-    if (it != m_vid2rid.end())
+    if (rid != SAI_NULL_OBJECT_ID)
     {
-        rid = it->second;
         return true;
     }
 
@@ -443,7 +570,7 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
      * faster to retrieve it late on.
      */
 
-    m_vid2rid[vid] = rid;
+    m_vid2rid.insert(vid, rid);
 
     SWSS_LOG_DEBUG("translated VID %s to RID %s",
             sai_serialize_object_id(vid).c_str(),
@@ -494,10 +621,59 @@ void VirtualOidTranslator::translateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < element.count; i++)
+    std::vector<sai_object_id_t> rids(element.count);
+
     {
-        element.list[i] = translateVidToRid(element.list[i]);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_vid2rid.lookup(element.count, element.list, rids.data()))
+        {
+            std::vector<sai_object_id_t> missingVids;
+
+            for (uint32_t i = 0; i < element.count; i++)
+            {
+                if (rids[i] == SAI_NULL_OBJECT_ID && element.list[i] != SAI_NULL_OBJECT_ID)
+                {
+                    missingVids.push_back(element.list[i]);
+                }
+            }
+
+            // misses can be only null VIDs, HMGET without fields is not sent then
+
+            if (missingVids.size())
+            {
+                std::vector<sai_object_id_t> missingRids(missingVids.size());
+
+                m_client->getRidsForVids(missingVids.size(), missingVids.data(), missingRids.data());
+
+                for (size_t idx = 0; idx < missingVids.size(); idx++)
+                {
+                    if (missingRids[idx] == SAI_NULL_OBJECT_ID)
+                    {
+                        SWSS_LOG_THROW("unable to get RID for VID %s",
+                                sai_serialize_object_id(missingVids[idx]).c_str());
+                    }
+
+                    /*
+                     * We got this RID from redis db, so put it also to local db
+                     * so it will be faster to retrieve it late on.
+                     */
+
+                    m_vid2rid.insert(missingVids[idx], missingRids[idx]);
+                }
+
+                for (uint32_t i = 0, idx = 0; i < element.count; i++)
+                {
+                    if (rids[i] == SAI_NULL_OBJECT_ID && element.list[i] != SAI_NULL_OBJECT_ID)
+                    {
+                        rids[i] = missingRids[idx++];
+                    }
+                }
+            }
+        }
     }
+
+    std::copy(rids.begin(), rids.end(), element.list);
 }
 
 void VirtualOidTranslator::translateVidToRid(
@@ -610,8 +786,8 @@ void VirtualOidTranslator::insertRidAndVid(
 
     // to support multiple switches vid/rid map must be per switch
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    m_rid2vid.insert(rid, vid);
+    m_vid2rid.insert(vid, rid);
 
     m_client->insertVidAndRid(vid, rid);
 }
@@ -627,8 +803,8 @@ void VirtualOidTranslator::insertRidsAndVids(
 
     for (size_t idx = 0; idx < count; idx++)
     {
-        m_rid2vid[rids[idx]] = vids[idx];
-        m_vid2rid[vids[idx]] = rids[idx];
+        m_rid2vid.insert(rids[idx], vids[idx]);
+        m_vid2rid.insert(vids[idx], rids[idx]);
     }
 
     m_client->insertVidsAndRids(count, vids, rids);
@@ -6,6 +6,7 @@ extern "C"{
 
 #include "VirtualObjectIdManager.h"
 #include "RedisClient.h"
+#include "OidTranslationTable.h"
 
 #include "meta/SaiInterface.h"
 
@@ -95,6 +96,21 @@ namespace syncd
             sai_object_id_t translateVidToRid(
                     _In_ sai_object_id_t vid);
 
+            /*
+             * Translate VIDs to RIDs in place in batch, prefer this method
+             * when translating entry keys of bulk operations. Each unique VID
+             * is translated once under single lock, VIDs missing in local
+             * cache are fetched from redis with single query.
+             */
+            void translateVidsToRids(
+                    _In_ size_t count,
+                    _Inout_ sai_object_id_t* const* oids);
+
+            /*
+             * Translate VIDs in list in place. Whole list is looked up in
+             * local cache in single batch, VIDs missing there are fetched
+             * from redis with single query.
+             */
             void translateVidToRid(
                     _Inout_ sai_object_list_t &element);
 
@@ -138,8 +154,8 @@ namespace syncd
 
             // those hashes keep mapping from all switches
 
-            std::unordered_map<sai_object_id_t, sai_object_id_t> m_rid2vid;
-            std::unordered_map<sai_object_id_t, sai_object_id_t> m_vid2rid;
+            OidTranslationTable m_rid2vid;
+            OidTranslationTable m_vid2rid;
             std::unordered_map<sai_object_id_t, sai_object_id_t> m_removedRid2vid;
 
             std::shared_ptr<RedisClient> m_client;
@@ -0,0 +1,259 @@
+#!/usr/bin/perl
+
+# purpose of this script is to generate large synthetic recordings
+# which can be replayed by saiplayer to measure throughput of
+# client -> syncd -> vslib path, see perf.pl
+
+use strict;
+use warnings;
+use diagnostics;
+
+use Getopt::Long;
+use POSIX qw(strftime);
+
+my %opts = (
+        routes  => 10000,
+        nhgs    => 100,
+        nhgsize => 4,
+        lags    => 8,
+        acl     => 1000,
+        fdb     => 1000,
+        churn   => 1,
+        bulk    => 1000,
+        output  => "-",
+        );
+
+GetOptions(
+        "routes=i"  => \$opts{routes},
+        "nhgs=i"    => \$opts{nhgs},
+        "nhgsize=i" => \$opts{nhgsize},
+        "lags=i"    => \$opts{lags},
+        "acl=i"     => \$opts{acl},
+        "fdb=i"     => \$opts{fdb},
+        "churn=i"   => \$opts{churn},
+        "bulk=i"    => \$opts{bulk},
+        "output=s"  => \$opts{output},
+        "help"      => sub { usage(); exit 0; },
+        ) or do { usage(); exit 1; };
+
+sub usage
+{
+    print <<"EOF";
+Usage: $0 [options]
+
+    --routes N     number of IPv4 routes (default $opts{routes})
+    --nhgs M       number of ECMP next hop groups (default $opts{nhgs})
+    --nhgsize S    number of members in next hop group (default $opts{nhgsize})
+    --lags L       number of LAGs with router interface and next hop (default $opts{lags})
+    --acl K        number of ACL rules (default $opts{acl})
+    --fdb F        number of FDB entries created and removed per churn round (default $opts{fdb})
+    --churn R      number of FDB churn rounds (default $opts{churn})
+    --bulk B       bulk size for routes and FDB entries, 0 disables bulk (default $opts{bulk})
+    --output FILE  output recording file (default stdout)
+EOF
+}
+
+die "--lags must be at least 1\n" if $opts{lags} < 1;
+
+$opts{nhgsize} = $opts{lags} if $opts{nhgsize} > $opts{lags};
+
+my $H;
+
+if ($opts{output} eq "-")
+{
+    $H = \*STDOUT;
+}
+else
+{
+    open ($H, ">", $opts{output}) or die "failed to open $opts{output}: $!";
+}
+
+my $SWITCH = "oid:0x21000000000000";
+
+my %counters;
+
+# object id encodes object type the same way as vslib does, index is
+# unique per object type
+
+sub oid
+{
+    my $ot = shift;
+
+    my $index = ++$counters{$ot};
+
+    return sprintf("oid:0x%x%012x", $ot, $index);
+}
+
+my $now = time;
+my $usec = 0;
+
+sub timestamp
+{
+    if (++$usec >= 1000000)
+    {
+        $usec = 0;
+        $now++;
+    }
+
+    return strftime("%Y-%m-%d.%H:%M:%S", localtime($now)) . sprintf(".%06d", $usec);
+}
+
+sub emit
+{
+    my ($op, $data) = @_;
+
+    print $H timestamp() . "|$op|$data\n";
+}
+
+sub ip
+{
+    my ($base, $index) = @_;
+
+    return sprintf("%d.%d.%d.%d", $base, ($index >> 16) & 0xff, ($index >> 8) & 0xff, $index & 0xff);
+}
+
+sub mac
+{
+    my $index = shift;
+
+    return sprintf("00-22-%02X-%02X-%02X-%02X",
+            ($index >> 24) & 0xff, ($index >> 16) & 0xff, ($index >> 8) & 0xff, $index & 0xff);
+}
+
+# emit entries (key, attributes) as bulk lines or as single create/remove
+
+sub emit_entries
+{
+    my ($op, $ot, @entries) = @_;
+
+    if ($opts{bulk} == 0)
+    {
+        for my $entry (@entries)
+        {
+            my $line = "$ot:$entry->[0]";
+
+            $line .= "|$entry->[1]" if defined $entry->[1];
+
+            emit lc($op), $line;
+        }
+
+        return;
+    }
+
+    while (my @chunk = splice(@entries, 0, $opts{bulk}))
+    {
+        my $line = $ot;
+
+        for my $entry (@chunk)
+        {
+            $line .= "||$entry->[0]";
+
+            $line .= "|$entry->[1]" if defined $entry->[1];
+        }
+
+        emit $op, $line;
+    }
+}
+
+emit "#", "synthetic recording: " . join(" ", map { "$_=$opts{$_}" } grep { $_ ne "output" } sort keys %opts);
+emit "a", "INIT_VIEW";
+emit "A", "SAI_STATUS_SUCCESS";
+emit "c", "SAI_OBJECT_TYPE_SWITCH:$SWITCH|SAI_SWITCH_ATTR_INIT_SWITCH=true";
+
+my $vr = oid(0x3);
+
+emit "c", "SAI_OBJECT_TYPE_VIRTUAL_ROUTER:$vr";
+
+# LAGs with router interfaces, neighbors and next hops
+
+my @nexthops;
+
+for my $idx (0 .. $opts{lags} - 1)
+{
+    my $lag = oid(0x2);
+    my $rif = oid(0x6);
+    my $nh = oid(0x4);
+    my $nip = ip(10, ($idx << 8) + 1);
+
+    emit "c", "SAI_OBJECT_TYPE_LAG:$lag|NULL=NULL";
+    emit "c", "SAI_OBJECT_TYPE_ROUTER_INTERFACE:$rif|SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID=$vr|SAI_ROUTER_INTERFACE_ATTR_SRC_MAC_ADDRESS=00:11:11:11:11:11|SAI_ROUTER_INTERFACE_ATTR_TYPE=SAI_ROUTER_INTERFACE_TYPE_PORT|SAI_ROUTER_INTERFACE_ATTR_PORT_ID=$lag";
+    emit "c", "SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:{\"ip\":\"$nip\",\"rif\":\"$rif\",\"switch_id\":\"$SWITCH\"}|SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS=" . mac($idx) =~ s/-/:/gr;
+    emit "c", "SAI_OBJECT_TYPE_NEXT_HOP:$nh|SAI_NEXT_HOP_ATTR_TYPE=SAI_NEXT_HOP_TYPE_IP|SAI_NEXT_HOP_ATTR_IP=$nip|SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID=$rif";
+
+    push @nexthops, $nh;
+}
+
+# ECMP next hop groups
+
+my @nhgs;
+
+for my $idx (0 .. $opts{nhgs} - 1)
+{
+    my $nhg = oid(0x5);
+
+    emit "c", "SAI_OBJECT_TYPE_NEXT_HOP_GROUP:$nhg|SAI_NEXT_HOP_GROUP_ATTR_TYPE=SAI_NEXT_HOP_GROUP_TYPE_ECMP";
+
+    for my $m (0 .. $opts{nhgsize} - 1)
+    {
+        my $nh = $nexthops[($idx + $m) % @nexthops];
+
+        emit "c", "SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:" . oid(0x2d) . "|SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID=$nhg|SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID=$nh";
+    }
+
+    push @nhgs, $nhg;
+}
+
+# routes, spread over next hop groups, or next hops if there are no groups
+
+my @targets = @nhgs ? @nhgs : @nexthops;
+
+my @routes;
+
+for my $idx (0 .. $opts{routes} - 1)
+{
+    my $dest = ip(100 + ($idx >> 16), $idx << 8) . "/24";
+
+    push @routes, [
+        "{\"dest\":\"$dest\",\"switch_id\":\"$SWITCH\",\"vr\":\"$vr\"}",
+        "SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID=" . $targets[$idx % @targets] ];
+}
+
+emit_entries "C", "SAI_OBJECT_TYPE_ROUTE_ENTRY", @routes;
+
+# ACL rules
+
+if ($opts{acl} > 0)
+{
+    my $table = oid(0x7);
+
+    emit "c", "SAI_OBJECT_TYPE_ACL_TABLE:$table|SAI_ACL_TABLE_ATTR_ACL_BIND_POINT_TYPE_LIST=1:SAI_ACL_BIND_POINT_TYPE_PORT|SAI_ACL_TABLE_ATTR_ACL_STAGE=SAI_ACL_STAGE_INGRESS|SAI_ACL_TABLE_ATTR_FIELD_SRC_IP=true";
+
+    for my $idx (0 .. $opts{acl} - 1)
+    {
+        my $priority = 1 + $idx % 10000;
+
+        emit "c", "SAI_OBJECT_TYPE_ACL_ENTRY:" . oid(0x8) . "|SAI_ACL_ENTRY_ATTR_TABLE_ID=$table|SAI_ACL_ENTRY_ATTR_PRIORITY=$priority|SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP=" . ip(20, $idx) . "&mask:255.255.255.255|SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION=SAI_PACKET_ACTION_DROP";
+    }
+}
+
+# FDB churn, entries are created and removed in each round
+
+if ($opts{fdb} > 0)
+{
+    my $bridge = oid(0x39);
+
+    emit "c", "SAI_OBJECT_TYPE_BRIDGE:$bridge|SAI_BRIDGE_ATTR_TYPE=SAI_BRIDGE_TYPE_1D";
+
+    my @fdbs = map { "{\"bvid\":\"$bridge\",\"mac\":\"" . mac($_) . "\",\"switch_id\":\"$SWITCH\"}" } (0 .. $opts{fdb} - 1);
+
+    for my $round (1 .. $opts{churn})
+    {
+        emit_entries "C", "SAI_OBJECT_TYPE_FDB_ENTRY", map { [ $_, "SAI_FDB_ENTRY_ATTR_TYPE=SAI_FDB_ENTRY_TYPE_STATIC" ] } @fdbs;
+        emit_entries "R", "SAI_OBJECT_TYPE_FDB_ENTRY", map { [ $_ ] } @fdbs;
+    }
+}
+
+emit "a", "APPLY_VIEW";
+emit "A", "SAI_STATUS_SUCCESS";
+
+close ($H) if $opts{output} ne "-";
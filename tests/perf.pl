@@ -0,0 +1,124 @@
+#!/usr/bin/perl
+
+# purpose of this script is to measure replay throughput on synthetic
+# recordings generated by genperfrec.pl, results are written as JSON
+# to perf directory (one file per scenario) for trend tracking
+#
+# suite is not part of make check, since it takes long time to run
+
+BEGIN { push @INC,'.'; }
+
+use strict;
+use warnings;
+use diagnostics;
+
+use utils;
+
+my $ROUTES = $ENV{PERF_ROUTES} // 100000;
+my $NHGS = $ENV{PERF_NHGS} // 512;
+my $ACL = $ENV{PERF_ACL} // 2000;
+my $FDB = $ENV{PERF_FDB} // 4000;
+
+sub generate
+{
+    my ($name, @params) = @_;
+
+    print color('bright_blue') . "Generating $name.rec" . color('reset') . "\n";
+
+    `./genperfrec.pl @params --output perf/$name.rec`;
+
+    if ($? != 0)
+    {
+        print color('red') . "failed to generate $name.rec: exitcode: $?" . color('reset') . "\n";
+        exit 1;
+    }
+}
+
+sub report
+{
+    my $name = shift;
+
+    open (my $H, "<", "perf/$name.json") or die "failed to open perf/$name.json $!";
+
+    local $/ = undef;
+
+    my $json = <$H>;
+
+    close ($H);
+
+    my ($ops) = $json =~ /"ops_per_sec": ([\d.e+]+)/;
+
+    printf "%s: %.0f ops/sec\n", $name, $ops // 0;
+}
+
+sub test_perf_routes_single
+{
+    fresh_start;
+
+    generate "routes_single", "--routes", $ROUTES, "--nhgs", $NHGS, "--acl", 0, "--fdb", 0, "--bulk", 0;
+
+    play "-b", "perf/routes_single.json", "routes_single.rec";
+
+    report "routes_single";
+}
+
+sub test_perf_routes_single_fast_replay
+{
+    fresh_start_bulk;
+
+    generate "routes_single_fast", "--routes", $ROUTES, "--nhgs", $NHGS, "--acl", 0, "--fdb", 0, "--bulk", 0;
+
+    # single operations are joined into bulk by player
+
+    play "-F", "-b", "perf/routes_single_fast.json", "routes_single_fast.rec";
+
+    report "routes_single_fast";
+}
+
+sub test_perf_routes_bulk
+{
+    fresh_start_bulk;
+
+    generate "routes_bulk", "--routes", $ROUTES, "--nhgs", $NHGS, "--acl", 0, "--fdb", 0, "--bulk", 1000;
+
+    play "-b", "perf/routes_bulk.json", "routes_bulk.rec";
+
+    report "routes_bulk";
+}
+
+sub test_perf_full
+{
+    fresh_start_bulk;
+
+    generate "full", "--routes", $ROUTES, "--nhgs", $NHGS, "--acl", $ACL, "--fdb", $FDB, "--churn", 4;
+
+    play "-b", "perf/full.json", "full.rec";
+
+    report "full";
+}
+
+sub test_perf_full_warm_boot
+{
+    fresh_start_bulk;
+
+    generate "full_warm", "--routes", $ROUTES, "--nhgs", $NHGS, "--acl", $ACL, "--fdb", 0;
+
+    play "full_warm.rec";
+
+    request_warm_shutdown;
+    start_syncd_warm;
+
+    # apply view after warm boot compares current and temporary view
+
+    play "-b", "perf/full_warm.json", "full_warm.rec";
+
+    report "full_warm";
+}
+
+test_perf_routes_single;
+test_perf_routes_single_fast_replay;
+test_perf_routes_bulk;
+test_perf_full;
+test_perf_full_warm_boot;
+
+kill_syncd;
@@ -0,0 +1,82 @@
+#include "AutoBulkBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+using namespace sairedis;
+
+TEST(AutoBulkBuffer, isSupported)
+{
+    EXPECT_TRUE(AutoBulkBuffer::isSupported(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_TRUE(AutoBulkBuffer::isSupported(SAI_COMMON_API_REMOVE, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY));
+    EXPECT_TRUE(AutoBulkBuffer::isSupported(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_FDB_ENTRY));
+    EXPECT_TRUE(AutoBulkBuffer::isSupported(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_NEXT_HOP));
+
+    EXPECT_FALSE(AutoBulkBuffer::isSupported(SAI_COMMON_API_GET, SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_FALSE(AutoBulkBuffer::isSupported(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_FALSE(AutoBulkBuffer::isSupported(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_SWITCH));
+    EXPECT_FALSE(AutoBulkBuffer::isSupported(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_PORT));
+}
+
+TEST(AutoBulkBuffer, append)
+{
+    auto buffer = std::make_shared<AutoBulkBuffer>();
+
+    EXPECT_TRUE(buffer->empty());
+    EXPECT_THROW(buffer->getBulkApi(), std::runtime_error);
+
+    buffer->append(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, "a", "x=1");
+    buffer->append(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, "b", "x=2");
+
+    EXPECT_EQ(buffer->size(), 2u);
+    EXPECT_EQ(buffer->getBulkApi(), SAI_COMMON_API_BULK_CREATE);
+    EXPECT_EQ(buffer->getObjectType(), SAI_OBJECT_TYPE_ROUTE_ENTRY);
+
+    EXPECT_EQ(fvField(buffer->getEntries().at(1)), "b");
+    EXPECT_EQ(fvValue(buffer->getEntries().at(1)), "x=2");
+
+    // different api, object type or same object breaks batch
+
+    EXPECT_FALSE(buffer->canAppend(SAI_COMMON_API_REMOVE, SAI_OBJECT_TYPE_ROUTE_ENTRY, "c"));
+    EXPECT_FALSE(buffer->canAppend(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_NEXT_HOP, "c"));
+    EXPECT_FALSE(buffer->canAppend(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, "a"));
+    EXPECT_TRUE(buffer->canAppend(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, "c"));
+
+    EXPECT_THROW(buffer->append(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_ROUTE_ENTRY, "a", "x=3"), std::runtime_error);
+
+    buffer->clear();
+
+    EXPECT_TRUE(buffer->empty());
+    EXPECT_TRUE(buffer->canAppend(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_ROUTE_ENTRY, "a"));
+}
+
+TEST(AutoBulkBuffer, maxSize)
+{
+    auto buffer = std::make_shared<AutoBulkBuffer>();
+
+    buffer->setMaxSize(2);
+
+    buffer->append(SAI_COMMON_API_REMOVE, SAI_OBJECT_TYPE_FDB_ENTRY, "a", "");
+
+    EXPECT_FALSE(buffer->isFull());
+
+    buffer->append(SAI_COMMON_API_REMOVE, SAI_OBJECT_TYPE_FDB_ENTRY, "b", "");
+
+    EXPECT_TRUE(buffer->isFull());
+    EXPECT_FALSE(buffer->canAppend(SAI_COMMON_API_REMOVE, SAI_OBJECT_TYPE_FDB_ENTRY, "c"));
+}
+
+TEST(AutoBulkBuffer, maxDelay)
+{
+    auto buffer = std::make_shared<AutoBulkBuffer>();
+
+    buffer->setMaxDelay(1);
+
+    buffer->append(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, "a", "x=1");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    EXPECT_FALSE(buffer->canAppend(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, "b"));
+}
@@ -0,0 +1,65 @@
+#include "ContextMutex.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace sairedis;
+
+TEST(ContextMutex, lockRecursive)
+{
+    ContextMutex mutex;
+
+    mutex.lock();
+    mutex.lock();
+
+    // held by outer call
+
+    EXPECT_FALSE(mutex.unlockForWait());
+
+    mutex.unlock();
+
+    EXPECT_TRUE(mutex.unlockForWait());
+
+    // not held
+
+    EXPECT_FALSE(mutex.unlockForWait());
+}
+
+TEST(ContextMutex, unlockForWait)
+{
+    ContextMutex mutex;
+
+    mutex.lock();
+
+    bool unlocked = true;
+
+    std::thread other([&]() {
+
+        // not owner
+
+        unlocked = mutex.unlockForWait();
+    });
+
+    other.join();
+
+    EXPECT_FALSE(unlocked);
+
+    EXPECT_TRUE(mutex.unlockForWait());
+
+    bool locked = false;
+
+    std::thread waiter([&]() {
+
+        std::lock_guard<ContextMutex> lock(mutex);
+
+        locked = true;
+    });
+
+    waiter.join();
+
+    EXPECT_TRUE(locked);
+
+    mutex.lock();
+    mutex.unlock();
+}
@@ -0,0 +1,172 @@
+#include "RecordingIndex.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+#define TEST_RECORDING "TestRecordingIndex.rec"
+
+static void writeRecording(
+        _In_ const std::string& content)
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream ofs(TEST_RECORDING, std::ios::trunc);
+
+    ofs << content;
+}
+
+static const std::string recording =
+"2017-06-14.01:55:46.541806|#|recording on: sairedis.rec\n"
+"2017-06-14.01:55:46.543987|a|INIT_VIEW\n"
+"2017-06-14.01:55:46.551164|A|SAI_STATUS_SUCCESS\n"
+"2017-06-14.01:55:46.555975|c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true\n"
+"2017-06-14.01:56:05.508992|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000004\n"
+"2017-06-14.01:56:06.105336|C|SAI_OBJECT_TYPE_ROUTE_ENTRY||{\"dest\":\"10.0.0.0/8\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000004\"}|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP||{\"dest\":\"11.0.0.0/8\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000004\"}|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP\n"
+"2017-06-14.01:56:07.000000|a|INIT_VIEW\n"
+"2017-06-14.01:56:08|r|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000004\n"
+"2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000ABCdef";
+
+TEST(RecordingIndex, parseTimestamp)
+{
+    uint64_t ts;
+
+    EXPECT_TRUE(RecordingIndex::parseTimestamp("2017-06-14.01:56:06", 19, ts));
+
+    uint64_t ts2;
+
+    EXPECT_TRUE(RecordingIndex::parseTimestamp("2017-06-14.01:56:06.5", 21, ts2));
+
+    EXPECT_EQ(ts2 - ts, 500000);
+
+    EXPECT_FALSE(RecordingIndex::parseTimestamp("2017-06-14 01:56:06", 19, ts));
+
+    EXPECT_FALSE(RecordingIndex::parseTimestamp("2017-06-14", 10, ts));
+}
+
+TEST(RecordingIndex, build)
+{
+    writeRecording(recording);
+
+    auto indexFile = RecordingIndex::getIndexFileName(TEST_RECORDING);
+
+    EXPECT_TRUE(RecordingIndex::build(TEST_RECORDING, indexFile));
+
+    RecordingIndex index;
+
+    EXPECT_TRUE(index.open(TEST_RECORDING, indexFile));
+
+    EXPECT_EQ(index.getLineCount(), 9);
+
+    EXPECT_EQ(index.getLine(1), "2017-06-14.01:55:46.543987|a|INIT_VIEW");
+
+    EXPECT_EQ(index.getLine(8), "2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000ABCdef");
+
+    EXPECT_EQ(index.getOffset(1), recording.find("2017-06-14.01:55:46.543987"));
+
+    EXPECT_EQ(index.getOp(5), 'C');
+
+    EXPECT_EQ(index.getTimestamp(8) - index.getTimestamp(7), 1100000);
+
+    EXPECT_THROW(index.getLine(9), std::runtime_error);
+
+    unlink(indexFile.c_str());
+}
+
+TEST(RecordingIndex, findCheckpoint)
+{
+    writeRecording(recording);
+
+    auto indexFile = RecordingIndex::getIndexFileName(TEST_RECORDING);
+
+    EXPECT_TRUE(RecordingIndex::build(TEST_RECORDING, indexFile));
+
+    RecordingIndex index;
+
+    EXPECT_TRUE(index.open(TEST_RECORDING, indexFile));
+
+    uint64_t ts;
+
+    EXPECT_TRUE(RecordingIndex::parseTimestamp("2017-06-14.01:56:06", 19, ts));
+
+    EXPECT_EQ(index.findTimestamp(ts), 5);
+
+    EXPECT_EQ(index.findTimestamp(ts * 2), RecordingIndex::INVALID_LINE);
+
+    EXPECT_EQ(index.findCheckpoint(0), RecordingIndex::INVALID_LINE);
+
+    EXPECT_EQ(index.findCheckpoint(5), 1);
+
+    EXPECT_EQ(index.findCheckpoint(8), 6);
+
+    EXPECT_EQ(index.findCheckpoint(100), 6);
+
+    unlink(indexFile.c_str());
+}
+
+TEST(RecordingIndex, getObjectHistory)
+{
+    writeRecording(recording);
+
+    auto indexFile = RecordingIndex::getIndexFileName(TEST_RECORDING);
+
+    EXPECT_TRUE(RecordingIndex::build(TEST_RECORDING, indexFile));
+
+    RecordingIndex index;
+
+    EXPECT_TRUE(index.open(TEST_RECORDING, indexFile));
+
+    EXPECT_EQ(index.getObjectHistory(0x3000000000004), std::vector<uint64_t>({4, 5, 7}));
+
+    EXPECT_EQ(index.getObjectHistory(0x21000000000000), std::vector<uint64_t>({3, 5}));
+
+    EXPECT_EQ(index.getObjectHistory(0x3000000abcdef), std::vector<uint64_t>({8}));
+
+    EXPECT_TRUE(index.getObjectHistory(0x1).empty());
+
+    unlink(indexFile.c_str());
+}
+
+TEST(RecordingIndex, open)
+{
+    writeRecording(recording);
+
+    auto indexFile = RecordingIndex::getIndexFileName(TEST_RECORDING);
+
+    RecordingIndex index;
+
+    EXPECT_FALSE(index.open(TEST_RECORDING, "not_existing.idx"));
+
+    EXPECT_FALSE(index.open(TEST_RECORDING, TEST_RECORDING));
+
+    EXPECT_TRUE(RecordingIndex::build(TEST_RECORDING, indexFile));
+
+    // recording changed after index was built
+
+    writeRecording(recording + "\n");
+
+    EXPECT_FALSE(index.open(TEST_RECORDING, indexFile));
+
+    EXPECT_EQ(index.getLineCount(), 0);
+
+    writeRecording("");
+
+    EXPECT_TRUE(RecordingIndex::build(TEST_RECORDING, indexFile));
+
+    EXPECT_TRUE(index.open(TEST_RECORDING, indexFile));
+
+    EXPECT_EQ(index.getLineCount(), 0);
+
+    EXPECT_EQ(index.findCheckpoint(0), RecordingIndex::INVALID_LINE);
+
+    EXPECT_EQ(index.findTimestamp(0), RecordingIndex::INVALID_LINE);
+
+    unlink(indexFile.c_str());
+    unlink(TEST_RECORDING);
+}
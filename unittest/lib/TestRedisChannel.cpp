@@ -1,11 +1,19 @@
 #include "RedisChannel.h"
 #include "sairediscommon.h"
 
+#include "meta/RedisSelectableChannel.h"
+#include "meta/sai_serialize.h"
+
 #include "swss/notificationproducer.h"
+#include "swss/select.h"
 
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <iostream>
 
 using namespace sairedis;
 
@@ -54,3 +62,179 @@ TEST(RedisChannel, flush)
 
     rc.flush();
 }
+
+TEST(RedisChannel, processResponse)
+{
+    RedisChannel rc("ASIC_DB", callback);
+
+    rc.setResponseTimeout(10);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    // response with request id
+
+    auto index = rc.registerRequest(true);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("foo", "bar");
+    values.emplace_back(REDIS_FIELD_REQUEST_ID, rc.m_requestIdPrefix + std::to_string(index));
+
+    swss::KeyOpFieldsValuesTuple response("SAI_STATUS_SUCCESS", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, values);
+
+    rc.processResponse(response);
+
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(kfvFieldsValues(kco).size(), 1);
+
+    // response for other channel is ignored
+
+    rc.registerRequest(true);
+
+    values.back() = swss::FieldValueTuple(REDIS_FIELD_REQUEST_ID, "1:2:3");
+
+    response = swss::KeyOpFieldsValuesTuple("SAI_STATUS_SUCCESS", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, values);
+
+    rc.processResponse(response);
+
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+    EXPECT_TRUE(rc.m_pendingRequests.empty());
+
+    // response without request id is matched by order
+
+    rc.registerRequest(false);
+
+    response = swss::KeyOpFieldsValuesTuple("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, std::vector<swss::FieldValueTuple>());
+
+    rc.processResponse(response);
+
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(kfvKey(kco), "SAI_STATUS_FAILURE");
+
+    EXPECT_TRUE(rc.m_pendingRequests.empty());
+}
+
+TEST(RedisChannel, concurrentWait)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    // acts as syncd, response contains request key
+
+    RedisSelectableChannel responder(db, ASIC_STATE_TABLE, REDIS_TABLE_GETRESPONSE, TEMP_PREFIX, false);
+
+    swss::SelectableEvent endEvent;
+
+    std::thread responderThread([&responder, &endEvent]() {
+
+        swss::Select s;
+
+        s.addSelectable(&responder);
+        s.addSelectable(&endEvent);
+
+        while (true)
+        {
+            swss::Selectable *sel;
+
+            int result = s.select(&sel);
+
+            if (sel == &endEvent)
+            {
+                break;
+            }
+
+            if (result != swss::Select::OBJECT)
+            {
+                continue;
+            }
+
+            do
+            {
+                swss::KeyOpFieldsValuesTuple kco;
+
+                responder.pop(kco, false);
+
+                if (kfvKey(kco).empty())
+                {
+                    break;
+                }
+
+                responder.set("SAI_STATUS_SUCCESS", {{"key", kfvKey(kco)}}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+            }
+            while (!responder.empty());
+        }
+    });
+
+    RedisChannel rc("ASIC_DB", callback);
+
+    rc.setBuffered(false);
+
+    const int iterations = 2000;
+
+    double singleRate = 0;
+
+    for (int threadCount = 1; threadCount <= 8; threadCount *= 2)
+    {
+        std::vector<std::thread> threads;
+
+        std::vector<int> failures(threadCount, 0);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&rc, &failures, t]() {
+
+                for (int i = 0; i < iterations; i++)
+                {
+                    auto key = "SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(t) + "0000" + std::to_string(i);
+
+                    rc.set(key, {}, REDIS_ASIC_STATE_COMMAND_GET);
+
+                    swss::KeyOpFieldsValuesTuple kco;
+
+                    auto status = rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+
+                    auto& values = kfvFieldsValues(kco);
+
+                    // each thread must get response for its own request
+
+                    if (status != SAI_STATUS_SUCCESS || values.size() != 1 || fvValue(values[0]) != key)
+                    {
+                        failures[t]++;
+                    }
+                }
+            });
+        }
+
+        for (auto& t: threads)
+        {
+            t.join();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        double ms = (double)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+
+        double rate = (threadCount * iterations) / (ms > 0 ? ms : 1);
+
+        if (threadCount == 1)
+        {
+            singleRate = rate;
+        }
+
+        std::cout << "[ BENCH    ] " << threadCount << " concurrent callers: "
+            << rate << " calls/ms, speedup " << (singleRate > 0 ? rate / singleRate : 0) << std::endl;
+
+        for (auto f: failures)
+        {
+            EXPECT_EQ(f, 0);
+        }
+    }
+
+    endEvent.notify();
+
+    responderThread.join();
+}
@@ -2,9 +2,13 @@
 #include "ContextConfigContainer.h"
 #include "sairediscommon.h"
 
+#include "meta/sai_serialize.h"
+
 #include <gtest/gtest.h>
 #include <functional>
 
+#include <arpa/inet.h>
+
 using namespace sairedis;
 using namespace std;
 using namespace swss;
@@ -88,3 +92,270 @@ TEST(RedisRemoteSaiInterface, queryStatsStCapability)
                                          SAI_OBJECT_TYPE_PORT,
                                          &stats_capability));
 }
+
+class TestAutoBulkMockChannel : public RedisChannel
+{
+public:
+  TestAutoBulkMockChannel(_In_ const string &dbAsic,
+              _In_ Channel::Callback callback) : RedisChannel(dbAsic, callback) {
+      SWSS_LOG_ENTER();
+    }
+
+  void set(
+      _In_ const string &key,
+      _In_ const vector<FieldValueTuple> &values,
+      _In_ const string &command)
+    {
+      SWSS_LOG_ENTER();
+
+      m_commands.push_back(command + " " + key);
+      m_values = values;
+      m_command = command;
+    }
+
+  void del(
+      _In_ const string &key,
+      _In_ const string &command)
+    {
+      SWSS_LOG_ENTER();
+
+      m_commands.push_back(command + " " + key);
+      m_values.clear();
+      m_command = command;
+    }
+
+  sai_status_t wait(
+      _In_ const string &command,
+      _Out_ KeyOpFieldsValuesTuple &kco)
+    {
+      SWSS_LOG_ENTER();
+
+      if (m_command == REDIS_ASIC_STATE_COMMAND_GET)
+      {
+          return SAI_STATUS_FAILURE;
+      }
+
+      // first object of each bulk request fails
+
+      for (size_t idx = 0; idx < m_values.size(); idx++)
+      {
+          kfvFieldsValues(kco).push_back(make_pair(
+                      sai_serialize_status(idx ? SAI_STATUS_SUCCESS : SAI_STATUS_ITEM_ALREADY_EXISTS), ""));
+      }
+
+      return m_values.size() ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    }
+
+  vector<string> m_commands;
+
+  vector<FieldValueTuple> m_values;
+
+  string m_command;
+};
+
+TEST(RedisRemoteSaiInterface, autoBulk)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestAutoBulkMockChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BULK;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_DELAY;
+    attr.value.u64 = 60000;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    sai_route_entry_t routes[3];
+
+    memset(routes, 0, sizeof(routes));
+
+    for (uint32_t idx = 0; idx < 3; idx++)
+    {
+        routes[idx].switch_id = 0x21000000000000;
+        routes[idx].vr_id = 0x3000000000022;
+        routes[idx].destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        routes[idx].destination.addr.ip4 = htonl(0x0a000000 + (idx << 8));
+        routes[idx].destination.mask.ip4 = htonl(0xffffff00);
+    }
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    for (uint32_t idx = 0; idx < 3; idx++)
+    {
+        EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(&routes[idx], 1, &attr));
+    }
+
+    // operations are deferred
+
+    EXPECT_EQ(channel->m_commands.size(), 0u);
+
+    // different API sends pending operations first
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(&routes[0], &attr));
+
+    ASSERT_EQ(channel->m_commands.size(), 1u);
+    EXPECT_EQ(channel->m_commands[0], REDIS_ASIC_STATE_COMMAND_BULK_CREATE " SAI_OBJECT_TYPE_ROUTE_ENTRY:3");
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.remove(&routes[1]));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.remove(&routes[2]));
+
+    ASSERT_EQ(channel->m_commands.size(), 2u);
+    EXPECT_EQ(channel->m_commands[1], REDIS_ASIC_STATE_COMMAND_BULK_SET " SAI_OBJECT_TYPE_ROUTE_ENTRY:1");
+
+    // get must see all previous operations
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, sai.get(&routes[0], 1, &attr));
+
+    ASSERT_EQ(channel->m_commands.size(), 4u);
+    EXPECT_EQ(channel->m_commands[2], REDIS_ASIC_STATE_COMMAND_BULK_REMOVE " SAI_OBJECT_TYPE_ROUTE_ENTRY:2");
+    EXPECT_EQ(channel->m_commands[3].find(REDIS_ASIC_STATE_COMMAND_GET " SAI_OBJECT_TYPE_ROUTE_ENTRY:"), 0u);
+
+    // flush returns first failed deferred status and resets it
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLUSH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_ITEM_ALREADY_EXISTS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    // max size bounds batch
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BULK_MAX_SIZE;
+    attr.value.u32 = 2;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(&routes[1], 1, &attr));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(&routes[2], 1, &attr));
+
+    ASSERT_EQ(channel->m_commands.size(), 5u);
+    EXPECT_EQ(channel->m_commands[4], REDIS_ASIC_STATE_COMMAND_BULK_CREATE " SAI_OBJECT_TYPE_ROUTE_ENTRY:2");
+
+    // disabling sends pending operations
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.remove(&routes[1]));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BULK;
+    attr.value.booldata = false;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    ASSERT_EQ(channel->m_commands.size(), 6u);
+    EXPECT_EQ(channel->m_commands[5], REDIS_ASIC_STATE_COMMAND_BULK_REMOVE " SAI_OBJECT_TYPE_ROUTE_ENTRY:1");
+
+    // single operations are sent right away
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.remove(&routes[2]));
+
+    ASSERT_EQ(channel->m_commands.size(), 7u);
+    EXPECT_EQ(channel->m_commands[6].find(REDIS_ASIC_STATE_COMMAND_REMOVE " SAI_OBJECT_TYPE_ROUTE_ENTRY:"), 0u);
+}
+
+TEST(RedisRemoteSaiInterface, bulkCounterPolling)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestAutoBulkMockChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    string keys[] = {
+        "PORT_STAT_COUNTER:oid:0x1000000000001",
+        "PORT_STAT_COUNTER:oid:0x1000000000002",
+        "PORT_STAT_COUNTER:oid:0x1000000000003" };
+
+    string field = "PORT_COUNTER_ID_LIST";
+    string ids = "SAI_PORT_STAT_IF_IN_OCTETS,SAI_PORT_STAT_IF_OUT_OCTETS";
+
+    sai_redis_flex_counter_parameter_t params[3];
+
+    memset(params, 0, sizeof(params));
+
+    for (uint32_t idx = 0; idx < 3; idx++)
+    {
+        params[idx].counter_key.list = (int8_t*)const_cast<char*>(keys[idx].c_str());
+        params[idx].counter_key.count = (uint32_t)keys[idx].length();
+        params[idx].counter_field_name.list = (int8_t*)const_cast<char*>(field.c_str());
+        params[idx].counter_field_name.count = (uint32_t)field.length();
+        params[idx].counter_ids.list = (int8_t*)const_cast<char*>(ids.c_str());
+        params[idx].counter_ids.count = (uint32_t)ids.length();
+    }
+
+    // second key is invalid and is not sent to syncd
+
+    params[1].counter_key.list = nullptr;
+
+    sai_status_t statuses[3];
+
+    sai_redis_flex_counter_bulk_parameter_t bulk;
+
+    bulk.count = 3;
+    bulk.params = params;
+    bulk.statuses = statuses;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_BULK;
+    attr.value.ptr = &bulk;
+
+    EXPECT_NE(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    ASSERT_EQ(channel->m_commands.size(), 1u);
+    EXPECT_EQ(channel->m_commands[0], REDIS_FLEX_COUNTER_COMMAND_BULK_POLL " 2");
+
+    ASSERT_EQ(channel->m_values.size(), 2u);
+    EXPECT_EQ(fvField(channel->m_values[0]), keys[0]);
+    EXPECT_EQ(fvValue(channel->m_values[0]), field + "=" + ids);
+    EXPECT_EQ(fvField(channel->m_values[1]), keys[2]);
+
+    // mock channel fails first entry of bulk request
+
+    EXPECT_EQ(statuses[0], SAI_STATUS_ITEM_ALREADY_EXISTS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_FAILURE);
+    EXPECT_EQ(statuses[2], SAI_STATUS_SUCCESS);
+
+    // empty counter ids stop polling
+
+    params[1] = params[0];
+    params[1].counter_ids.list = nullptr;
+    params[1].counter_ids.count = 0;
+
+    bulk.count = 2;
+
+    EXPECT_NE(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    ASSERT_EQ(channel->m_values.size(), 2u);
+    EXPECT_EQ(fvValue(channel->m_values[1]), "");
+
+    bulk.params = nullptr;
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+}
@@ -1,8 +1,17 @@
 #include "Sai.h"
+#include "Channel.h"
+
+#include "sairedis.h"
 
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstring>
 
 using namespace sairedis;
 
@@ -28,6 +37,25 @@ static sai_service_method_table_t test_services = {
     profile_get_next_value
 };
 
+static const char* profile_get_value_multi_context(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable && strcmp(variable, SAI_REDIS_KEY_CONTEXT_CONFIG) == 0)
+    {
+        return "files/context_config_multi.json";
+    }
+
+    return NULL;
+}
+
+static sai_service_method_table_t test_services_multi_context = {
+    profile_get_value_multi_context,
+    profile_get_next_value
+};
+
 TEST(Sai, queryApiVersion)
 {
     Sai sai;
@@ -60,3 +88,328 @@ TEST(Sai, bulkGet)
                 statuses));
 }
 
+
+/**
+ * @brief Rendezvous of given number of parties with timeout.
+ */
+class TestSaiBarrier
+{
+    public:
+
+        TestSaiBarrier(
+                _In_ size_t parties):
+            m_parties(parties),
+            m_count(0),
+            m_generation(0),
+            m_timeouts(0)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+    public:
+
+        void wait()
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            auto generation = m_generation;
+
+            if (++m_count == m_parties)
+            {
+                m_count = 0;
+                m_generation++;
+
+                m_cv.notify_all();
+
+                return;
+            }
+
+            if (!m_cv.wait_for(lock, std::chrono::seconds(1), [&] { return generation != m_generation; }))
+            {
+                // nobody arrived in time, leave barrier
+
+                m_count--;
+                m_timeouts++;
+            }
+        }
+
+    private:
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_cv;
+
+        size_t m_parties;
+
+        size_t m_count;
+
+        uint64_t m_generation;
+
+    public:
+
+        std::atomic<int> m_timeouts;
+};
+
+/**
+ * @brief Channel which answers every request with success and blocks on
+ * barrier while waiting for response, counting concurrent waiters.
+ */
+class TestSaiBlockingChannel:
+    public Channel
+{
+    public:
+
+        TestSaiBlockingChannel():
+            Channel(nullptr),
+            m_active(0),
+            m_maxActive(0)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+    public:
+
+        virtual bool supportsConcurrentWait() const override
+        {
+            SWSS_LOG_ENTER();
+
+            return true;
+        }
+
+        virtual void setBuffered(
+                _In_ bool buffered) override
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual void flush() override
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual void set(
+                _In_ const std::string& key,
+                _In_ const std::vector<swss::FieldValueTuple>& values,
+                _In_ const std::string& command) override
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual void del(
+                _In_ const std::string& key,
+                _In_ const std::string& command) override
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual sai_status_t wait(
+                _In_ const std::string& command,
+                _Out_ swss::KeyOpFieldsValuesTuple& kco) override
+        {
+            SWSS_LOG_ENTER();
+
+            int active = ++m_active;
+
+            int max = m_maxActive;
+
+            while (active > max && !m_maxActive.compare_exchange_weak(max, active))
+            {
+                // max reloaded, retry
+            }
+
+            if (m_barrier)
+            {
+                m_barrier->wait();
+            }
+
+            m_active--;
+
+            // response to get, ignored by create/remove/set
+
+            kfvFieldsValues(kco).push_back(swss::FieldValueTuple("SAI_SWITCH_ATTR_FDB_AGING_TIME", "0"));
+
+            return SAI_STATUS_SUCCESS;
+        }
+
+    protected:
+
+        virtual void notificationThreadFunction() override
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+    public:
+
+        std::shared_ptr<TestSaiBarrier> m_barrier;
+
+        std::atomic<int> m_active;
+
+        std::atomic<int> m_maxActive;
+};
+
+static sai_object_id_t createSwitchWithBlockingChannel(
+        _In_ Sai& sai,
+        _In_ uint32_t globalContext,
+        _In_ std::shared_ptr<TestSaiBlockingChannel> channel)
+{
+    SWSS_LOG_ENTER();
+
+    auto context = sai.getContext(globalContext);
+
+    context->m_redisSai->m_communicationChannel = channel;
+    context->m_redisSai->m_syncMode = true;
+
+    channel->setSyncMode(true);
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attrs[0].value.booldata = true;
+
+    attrs[1].id = SAI_REDIS_SWITCH_ATTR_CONTEXT;
+    attrs[1].value.u32 = globalContext;
+
+    sai_object_id_t switchId = SAI_NULL_OBJECT_ID;
+
+    EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 2, attrs), SAI_STATUS_SUCCESS);
+
+    return switchId;
+}
+
+TEST(Sai, contextConcurrency)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services_multi_context), SAI_STATUS_SUCCESS);
+
+    const uint32_t contexts = 2;
+    const int threadsPerContext = 2;
+    const int iterations = 4;
+
+    // every wait for response must meet wait on other context, which is
+    // only possible when contexts don't block each other
+
+    auto barrier = std::make_shared<TestSaiBarrier>(contexts);
+
+    std::vector<std::shared_ptr<TestSaiBlockingChannel>> channels;
+    std::vector<sai_object_id_t> switchIds;
+
+    for (uint32_t ctx = 0; ctx < contexts; ctx++)
+    {
+        channels.push_back(std::make_shared<TestSaiBlockingChannel>());
+
+        switchIds.push_back(createSwitchWithBlockingChannel(sai, ctx, channels[ctx]));
+
+        channels[ctx]->m_barrier = barrier;
+    }
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t ctx = 0; ctx < contexts; ctx++)
+    {
+        for (int t = 0; t < threadsPerContext; t++)
+        {
+            threads.emplace_back([&sai, &switchIds, ctx]() {
+
+                sai_attribute_t attr;
+
+                attr.id = SAI_SWITCH_ATTR_FDB_AGING_TIME;
+
+                for (int i = 0; i < iterations; i++)
+                {
+                    attr.value.u32 = i;
+
+                    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, switchIds[ctx], &attr), SAI_STATUS_SUCCESS);
+                }
+            });
+        }
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    // calls on different contexts overlap
+
+    EXPECT_EQ(barrier->m_timeouts.load(), 0);
+
+    // calls on the same context don't overlap
+
+    for (auto& channel: channels)
+    {
+        EXPECT_EQ(channel->m_maxActive.load(), 1);
+    }
+
+    EXPECT_EQ(sai.apiUninitialize(), SAI_STATUS_SUCCESS);
+}
+
+TEST(Sai, getReleasesContextMutex)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services_multi_context), SAI_STATUS_SUCCESS);
+
+    const int threads = 2;
+    const int iterations = 4;
+
+    auto channel = std::make_shared<TestSaiBlockingChannel>();
+
+    auto switchId = createSwitchWithBlockingChannel(sai, 0, channel);
+
+    // gets on the same context must wait for response at the same time
+
+    auto barrier = std::make_shared<TestSaiBarrier>(threads);
+
+    channel->m_barrier = barrier;
+
+    std::vector<std::thread> getThreads;
+
+    for (int t = 0; t < threads; t++)
+    {
+        getThreads.emplace_back([&sai, switchId]() {
+
+            sai_attribute_t attr;
+
+            for (int i = 0; i < iterations; i++)
+            {
+                attr.id = SAI_SWITCH_ATTR_FDB_AGING_TIME;
+
+                EXPECT_EQ(sai.get(SAI_OBJECT_TYPE_SWITCH, switchId, 1, &attr), SAI_STATUS_SUCCESS);
+            }
+        });
+    }
+
+    for (auto& t: getThreads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(barrier->m_timeouts.load(), 0);
+
+    EXPECT_EQ(channel->m_maxActive.load(), threads);
+
+    // context mutex is locked again after response
+
+    auto context = sai.getContext(0);
+
+    EXPECT_FALSE(context->m_mutex.unlockForWait());
+
+    EXPECT_EQ(sai.apiUninitialize(), SAI_STATUS_SUCCESS);
+}
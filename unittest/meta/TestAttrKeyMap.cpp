@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <chrono>
+#include <iostream>
 
 using namespace saimeta;
 
@@ -33,3 +35,105 @@ TEST(AttrKeyMap, clear)
 
     EXPECT_EQ(akm.getAllKeys().size(), 0);
 }
+
+TEST(AttrKeyMap, constructBinaryKey)
+{
+    sai_attribute_t attrs[2];
+
+    uint32_t list[4] = {1,2,3,4};
+
+    attrs[0].id = SAI_PORT_ATTR_SPEED;
+    attrs[0].value.u32 = 10000;
+
+    attrs[1].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    attrs[1].value.u32list.count = 4;
+    attrs[1].value.u32list.list = list;
+
+    sai_object_meta_key_t mk;
+
+    memset(&mk, 0, sizeof(mk));
+
+    mk.objecttype = SAI_OBJECT_TYPE_PORT;
+
+    auto key = AttrKeyMap::constructBinaryKey(0x21000000000000, mk, 2, attrs);
+
+    // switch id, object type, attr id, count and 4 lanes
+
+    EXPECT_EQ(key.size(), sizeof(sai_object_id_t) + sizeof(int32_t) + sizeof(sai_attr_id_t) + sizeof(uint32_t) + 4 * sizeof(uint32_t));
+
+    EXPECT_EQ(AttrKeyMap::keyToString(key), "oid:0x21000000000000;SAI_PORT_ATTR_HW_LANE_LIST:1,2,3,4;");
+
+    EXPECT_EQ(AttrKeyMap::constructKey(0x21000000000000, mk, 2, attrs), AttrKeyMap::keyToString(key));
+
+    EXPECT_NE(key, AttrKeyMap::constructBinaryKey(0x21000000000001, mk, 2, attrs));
+
+    EXPECT_THROW(AttrKeyMap::keyToString(key.substr(0, key.size() - 1)), std::runtime_error);
+}
+
+TEST(AttrKeyMap, attrKeyExists)
+{
+    AttrKeyMap akm;
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+
+    akm.insert("foo", "bar");
+
+    EXPECT_TRUE(akm.attrKeyExists("bar"));
+
+    // meta key is updated with new attr key
+
+    akm.insert("foo", "baz");
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+    EXPECT_TRUE(akm.attrKeyExists("baz"));
+
+    akm.eraseMetaKey("foo");
+
+    EXPECT_FALSE(akm.attrKeyExists("baz"));
+
+    akm.insert("foo", "bar");
+    akm.clear();
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+}
+
+TEST(AttrKeyMap, scale)
+{
+    AttrKeyMap akm;
+
+    sai_object_meta_key_t mk;
+
+    memset(&mk, 0, sizeof(mk));
+
+    mk.objecttype = SAI_OBJECT_TYPE_PORT;
+
+    const uint32_t count = 32768;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        uint32_t lane = idx;
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_PORT_ATTR_HW_LANE_LIST;
+        attr.value.u32list.count = 1;
+        attr.value.u32list.list = &lane;
+
+        auto key = AttrKeyMap::constructBinaryKey(0x21000000000000, mk, 1, &attr);
+
+        ASSERT_FALSE(akm.attrKeyExists(key));
+
+        akm.insert("port" + std::to_string(idx), key);
+
+        ASSERT_TRUE(akm.attrKeyExists(key));
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "[ BENCH    ] " << count << " keyed objects create validation: "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    EXPECT_EQ(akm.getAllKeys().size(), count);
+}
@@ -0,0 +1,157 @@
+#include "LatencyHistogram.h"
+#include "LatencyHistogramExporter.h"
+#include "PerformanceIntervalTimer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <thread>
+
+using namespace sairediscommon;
+
+TEST(LatencyHistogram, bucketIndex)
+{
+    for (uint64_t v = 0; v < LatencyHistogram::SUB_BUCKET_COUNT; v++)
+    {
+        EXPECT_EQ(LatencyHistogram::bucketIndex(v), v);
+    }
+
+    EXPECT_EQ(LatencyHistogram::bucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+
+    uint64_t values[] = { 8, 9, 15, 16, 17, 1000, 123456789, 1ULL << 40, UINT64_MAX };
+
+    for (auto v: values)
+    {
+        auto idx = LatencyHistogram::bucketIndex(v);
+
+        EXPECT_LE(LatencyHistogram::bucketLowerBound(idx), v);
+        EXPECT_GE(LatencyHistogram::bucketUpperBound(idx), v);
+    }
+
+    // buckets are contiguous
+
+    for (unsigned int idx = 1; idx < LatencyHistogram::BUCKET_COUNT; idx++)
+    {
+        EXPECT_EQ(LatencyHistogram::bucketUpperBound(idx - 1) + 1, LatencyHistogram::bucketLowerBound(idx));
+    }
+}
+
+TEST(LatencyHistogram, percentile)
+{
+    LatencyHistogram h;
+
+    for (uint64_t v = 1; v <= 1000; v++)
+    {
+        h.record(v * 1000);
+    }
+
+    auto s = h.snapshot();
+
+    EXPECT_EQ(s.count, 1000u);
+    EXPECT_EQ(s.max, 1000000u);
+    EXPECT_EQ(s.sum, 500500000u);
+
+    // relative error bounded by bucket width
+
+    EXPECT_NEAR((double)s.percentile(0.5), 500000.0, 500000.0 / LatencyHistogram::SUB_BUCKET_COUNT);
+    EXPECT_NEAR((double)s.percentile(0.99), 990000.0, 990000.0 / LatencyHistogram::SUB_BUCKET_COUNT);
+    EXPECT_EQ(s.percentile(1.0), 1000000u);
+
+    h.reset();
+
+    EXPECT_EQ(h.snapshot().count, 0u);
+    EXPECT_EQ(h.snapshot().percentile(0.5), 0u);
+}
+
+TEST(LatencyHistogram, concurrentRecord)
+{
+    LatencyHistogram h;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&h]() {
+                for (uint64_t v = 0; v < 10000; v++)
+                {
+                    h.record(v);
+                }
+        });
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(h.snapshot().count, 40000u);
+    EXPECT_EQ(h.snapshot().max, 9999u);
+}
+
+TEST(LatencyHistogramRegistry, getHistogram)
+{
+    auto& r = LatencyHistogramRegistry::getInstance();
+
+    auto* a = r.getHistogram("foo");
+    auto* b = r.getHistogram("foo", SAI_OBJECT_TYPE_PORT, 0x21000000000000);
+
+    EXPECT_NE(a, nullptr);
+    EXPECT_NE(a, b);
+
+    EXPECT_EQ(a, r.getHistogram("foo"));
+    EXPECT_EQ(b, r.getHistogram("foo", SAI_OBJECT_TYPE_PORT, 0x21000000000000));
+}
+
+TEST(PerformanceIntervalTimer, histogram)
+{
+    PerformanceIntervalTimer p("TestLatencyHistogram::timer");
+
+    p.start();
+    p.stop();
+    p.inc();
+
+    p.start();
+    p.stop();
+    p.inc(1, SAI_OBJECT_TYPE_PORT);
+
+    auto& r = LatencyHistogramRegistry::getInstance();
+
+    EXPECT_EQ(r.getHistogram("TestLatencyHistogram::timer")->snapshot().count, 2u);
+    EXPECT_EQ(r.getHistogram("TestLatencyHistogram::timer", SAI_OBJECT_TYPE_PORT)->snapshot().count, 1u);
+}
+
+TEST(LatencyHistogramExporter, file)
+{
+    LatencyHistogramRegistry::getInstance().getHistogram("TestLatencyHistogram::export")->record(1234);
+
+    const char* fileName = "latency_histogram.json";
+
+    LatencyHistogramExporter exporter(fileName, std::chrono::seconds(1));
+
+    EXPECT_TRUE(exporter.exportOnce());
+
+    std::map<std::string, std::vector<swss::FieldValueTuple>> histograms;
+
+    EXPECT_TRUE(LatencyHistogramExporter::readFile(fileName, histograms));
+
+    auto it = histograms.find("TestLatencyHistogram::export|SAI_OBJECT_TYPE_NULL|0x0");
+
+    ASSERT_NE(it, histograms.end());
+
+    LatencyHistogram::Snapshot s;
+
+    EXPECT_TRUE(LatencyHistogramExporter::deserialize(it->second, s));
+
+    EXPECT_EQ(s.count, 1u);
+    EXPECT_EQ(s.max, 1234u);
+    EXPECT_EQ(s.buckets[LatencyHistogram::bucketIndex(1234)], 1u);
+
+    EXPECT_FALSE(LatencyHistogramExporter::deserialize({{"buckets", "foo"}}, s));
+
+    EXPECT_FALSE(LatencyHistogramExporter::readFile("not_existing.json", histograms));
+
+    exporter.start();
+    exporter.stop();
+
+    std::remove(fileName);
+}
@@ -0,0 +1,154 @@
+#include "Meta.h"
+#include "MetaSnapshot.h"
+#include "MetaTestSaiInterface.h"
+
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+#include <string.h>
+#include <unistd.h>
+
+using namespace saimeta;
+
+#define TEST_SNAPSHOT "TestMetaSnapshot.bin"
+
+#define SWITCH_ID 0x21000000000000
+
+static void populateMeta(
+        _Inout_ Meta& m)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_ACL_TABLE:oid:0x7000000000626"]["SAI_ACL_TABLE_ATTR_FIELD_ACL_IP_TYPE"] = "true";
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+    dump["SAI_OBJECT_TYPE_VLAN:oid:0x2600000000002f"]["SAI_VLAN_ATTR_VLAN_ID"] = "2";
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"]["SAI_SWITCH_ATTR_PORT_LIST"] =
+           "2:oid:0x1000000000002,oid:0x1000000000003";
+    dump["SAI_OBJECT_TYPE_ACL_ENTRY:oid:0x8000000000635"]["SAI_ACL_ENTRY_ATTR_FIELD_SRC_PORT"] = "oid:0x1000000000003";
+    dump["SAI_OBJECT_TYPE_ACL_ENTRY:oid:0x8000000000635"]["SAI_ACL_ENTRY_ATTR_FIELD_OUT_PORTS"] = "2:oid:0x1000000000002,oid:0x1000000000003";
+    dump["SAI_OBJECT_TYPE_ACL_ENTRY:oid:0x8000000000635"]["SAI_ACL_ENTRY_ATTR_ACTION_REDIRECT"] = "oid:0x1000000000003";
+    dump["SAI_OBJECT_TYPE_ACL_ENTRY:oid:0x8000000000635"]["SAI_ACL_ENTRY_ATTR_ACTION_REDIRECT_LIST"] = "2:oid:0x1000000000002,oid:0x1000000000003";
+
+    m.populate(dump);
+}
+
+TEST(MetaSnapshot, saveLoad)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    populateMeta(m);
+
+    EXPECT_TRUE(m.saveSnapshot(TEST_SNAPSHOT, 7));
+
+    Meta n(std::make_shared<MetaTestSaiInterface>());
+
+    EXPECT_TRUE(n.loadSnapshot(TEST_SNAPSHOT, 7, SWITCH_ID));
+
+    EXPECT_FALSE(n.isEmpty());
+
+    for (auto oid: {0x1000000000002ULL, 0x1000000000003ULL, 0x3000000000022ULL, 0x60000000005cfULL, 0x8000000000635ULL})
+    {
+        EXPECT_EQ(m.getObjectReferenceCount(oid), n.getObjectReferenceCount(oid));
+    }
+
+    sai_object_meta_key_t mk;
+
+    sai_deserialize_object_meta_key("SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}", mk);
+
+    EXPECT_TRUE(n.objectExists(mk));
+
+    sai_deserialize_object_meta_key("SAI_OBJECT_TYPE_ACL_ENTRY:oid:0x8000000000635", mk);
+
+    EXPECT_TRUE(n.objectExists(mk));
+
+    // loaded database can be saved again
+
+    EXPECT_TRUE(n.saveSnapshot(TEST_SNAPSHOT, 8));
+
+    unlink(TEST_SNAPSHOT);
+}
+
+TEST(MetaSnapshot, stale)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    populateMeta(m);
+
+    EXPECT_TRUE(m.saveSnapshot(TEST_SNAPSHOT, 7));
+
+    Meta n(std::make_shared<MetaTestSaiInterface>());
+
+    EXPECT_FALSE(n.loadSnapshot(TEST_SNAPSHOT, 8, SWITCH_ID));
+
+    EXPECT_FALSE(n.loadSnapshot(TEST_SNAPSHOT, 7, SWITCH_ID + 1));
+
+    EXPECT_FALSE(n.loadSnapshot("not_existing.bin", 7, SWITCH_ID));
+
+    EXPECT_TRUE(n.isEmpty());
+
+    // database must be empty
+
+    EXPECT_FALSE(m.loadSnapshot(TEST_SNAPSHOT, 7, SWITCH_ID));
+
+    unlink(TEST_SNAPSHOT);
+}
+
+TEST(MetaSnapshot, saveWithoutSwitch)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    EXPECT_FALSE(m.saveSnapshot(TEST_SNAPSHOT, 1));
+}
+
+TEST(MetaSnapshot, truncated)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    populateMeta(m);
+
+    EXPECT_TRUE(m.saveSnapshot(TEST_SNAPSHOT, 7));
+
+    std::string content;
+
+    {
+        std::ifstream ifs(TEST_SNAPSHOT, std::ios::binary);
+
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    ASSERT_GT(content.size(), sizeof(MetaSnapshotHeader));
+
+    // header size is updated, so only content is truncated
+
+    MetaSnapshotHeader header;
+
+    memcpy(&header, content.data(), sizeof(header));
+
+    content.resize(content.size() - 4);
+
+    header.size = content.size();
+
+    memcpy(&content[0], &header, sizeof(header));
+
+    {
+        std::ofstream ofs(TEST_SNAPSHOT, std::ios::binary | std::ios::trunc);
+
+        ofs << content;
+    }
+
+    Meta n(std::make_shared<MetaTestSaiInterface>());
+
+    EXPECT_FALSE(n.loadSnapshot(TEST_SNAPSHOT, 7, SWITCH_ID));
+
+    EXPECT_TRUE(n.isEmpty());
+
+    unlink(TEST_SNAPSHOT);
+}
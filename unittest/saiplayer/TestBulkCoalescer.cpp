@@ -0,0 +1,146 @@
+#include "BulkCoalescer.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace saiplayer;
+
+#define SWITCH_ID   0x21000000000000
+#define ROUTE_1     "{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"
+#define ROUTE_2     "{\"dest\":\"10.0.1.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"
+
+TEST(BulkCoalescer, isSupported)
+{
+    EXPECT_TRUE(BulkCoalescer::isSupported('c', SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_TRUE(BulkCoalescer::isSupported('r', SAI_OBJECT_TYPE_NEXT_HOP));
+    EXPECT_TRUE(BulkCoalescer::isSupported('s', SAI_OBJECT_TYPE_PORT));
+
+    EXPECT_FALSE(BulkCoalescer::isSupported('g', SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_FALSE(BulkCoalescer::isSupported('c', SAI_OBJECT_TYPE_SWITCH));
+    EXPECT_FALSE(BulkCoalescer::isSupported('c', SAI_OBJECT_TYPE_NULL));
+}
+
+TEST(BulkCoalescer, getBulkLine)
+{
+    BulkCoalescer bc(16);
+
+    EXPECT_TRUE(bc.empty());
+
+    bc.append("ts1", 'c', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_1, "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP");
+    bc.append("ts2", 'c', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_2, "");
+
+    EXPECT_FALSE(bc.empty());
+    EXPECT_FALSE(bc.full());
+
+    EXPECT_EQ(bc.getBulkOp(), 'C');
+    EXPECT_EQ(bc.getBulkApi(), SAI_COMMON_API_BULK_CREATE);
+
+    // timestamp of first line is used for the whole bulk
+
+    EXPECT_EQ(bc.getBulkLine(),
+            "ts1|C|SAI_OBJECT_TYPE_ROUTE_ENTRY||" ROUTE_1 "|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP||" ROUTE_2);
+
+    bc.clear();
+
+    EXPECT_TRUE(bc.empty());
+    EXPECT_EQ(bc.getBulkLine(), "");
+
+    EXPECT_THROW(bc.getBulkOp(), std::runtime_error);
+
+    bc.append("ts3", 'r', SAI_OBJECT_TYPE_NEXT_HOP, SWITCH_ID, "oid:0x4000000000001", "");
+
+    EXPECT_EQ(bc.getBulkApi(), SAI_COMMON_API_BULK_REMOVE);
+
+    EXPECT_EQ(bc.getBulkLine(), "ts3|R|SAI_OBJECT_TYPE_NEXT_HOP||oid:0x4000000000001");
+}
+
+TEST(BulkCoalescer, flushOnChange)
+{
+    BulkCoalescer bc(16);
+
+    // empty bulk accepts any line
+
+    EXPECT_TRUE(bc.canAppend('s', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000002", "SAI_PORT_ATTR_MTU=9100"));
+
+    bc.append("ts", 's', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000002", "SAI_PORT_ATTR_MTU=9100");
+
+    EXPECT_TRUE(bc.canAppend('s', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000003", "SAI_PORT_ATTR_MTU=9100"));
+
+    // op change
+
+    EXPECT_FALSE(bc.canAppend('r', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000003", ""));
+
+    // object type change
+
+    EXPECT_FALSE(bc.canAppend('s', SAI_OBJECT_TYPE_LAG, SWITCH_ID, "oid:0x2000000000003", "SAI_LAG_ATTR_PORT_VLAN_ID=2"));
+
+    // switch change
+
+    EXPECT_FALSE(bc.canAppend('s', SAI_OBJECT_TYPE_PORT, 0x21000000000001, "oid:0x1000000000003", "SAI_PORT_ATTR_MTU=9100"));
+
+    // same object again, order of operations must be kept
+
+    EXPECT_FALSE(bc.canAppend('s', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000002", "SAI_PORT_ATTR_ADMIN_STATE=true"));
+
+    EXPECT_THROW(bc.append("ts", 'r', SAI_OBJECT_TYPE_PORT, SWITCH_ID, "oid:0x1000000000003", ""), std::runtime_error);
+}
+
+TEST(BulkCoalescer, flushOnReferenceToCreated)
+{
+    BulkCoalescer bc(16);
+
+    EXPECT_FALSE(bc.referencesCreated("SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID=oid:0x4000000000001"));
+
+    bc.append("ts", 'c', SAI_OBJECT_TYPE_NEXT_HOP, SWITCH_ID, "oid:0x4000000000001", "SAI_NEXT_HOP_ATTR_TYPE=SAI_NEXT_HOP_TYPE_IP");
+
+    EXPECT_TRUE(bc.referencesCreated("oid:0x4000000000001"));
+    EXPECT_TRUE(bc.referencesCreated("SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID=oid:0x6000000000001|SAI_NEXT_HOP_ATTR_TUNNEL_ID=oid:0x4000000000001"));
+    EXPECT_TRUE(bc.referencesCreated("SAI_ACL_ENTRY_ATTR_FIELD_IN_PORTS=2:oid:0x1000000000002,oid:0x4000000000001"));
+
+    EXPECT_FALSE(bc.referencesCreated("oid:0x4000000000002"));
+    EXPECT_FALSE(bc.referencesCreated("SAI_NEXT_HOP_ATTR_IP=10.0.0.1"));
+
+    // next hop referencing next hop created by pending bulk
+
+    EXPECT_FALSE(bc.canAppend('c', SAI_OBJECT_TYPE_NEXT_HOP, SWITCH_ID, "oid:0x4000000000002",
+                "SAI_NEXT_HOP_ATTR_TYPE=SAI_NEXT_HOP_TYPE_TUNNEL_ENCAP|SAI_NEXT_HOP_ATTR_TUNNEL_ID=oid:0x4000000000001"));
+
+    EXPECT_TRUE(bc.canAppend('c', SAI_OBJECT_TYPE_NEXT_HOP, SWITCH_ID, "oid:0x4000000000002",
+                "SAI_NEXT_HOP_ATTR_TYPE=SAI_NEXT_HOP_TYPE_IP"));
+
+    // created entries are not object ids, so they are not tracked
+
+    bc.clear();
+
+    bc.append("ts", 'c', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_1, "");
+
+    EXPECT_FALSE(bc.referencesCreated(ROUTE_1));
+
+    EXPECT_TRUE(bc.canAppend('c', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_2, ""));
+}
+
+TEST(BulkCoalescer, flushOnSizeLimit)
+{
+    BulkCoalescer bc(2);
+
+    bc.append("ts", 'r', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_1, "");
+
+    EXPECT_FALSE(bc.full());
+
+    bc.append("ts", 'r', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_2, "");
+
+    EXPECT_TRUE(bc.full());
+
+    bc.clear();
+
+    EXPECT_FALSE(bc.full());
+
+    // zero size limit means no coalescing, single line in bulk
+
+    BulkCoalescer single(0);
+
+    single.append("ts", 'r', SAI_OBJECT_TYPE_ROUTE_ENTRY, SWITCH_ID, ROUTE_1, "");
+
+    EXPECT_TRUE(single.full());
+}
@@ -0,0 +1,144 @@
+#include "RecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+using namespace saiplayer;
+
+#define TEST_RECORDING "TestRecordingReader.rec"
+
+static void writeRecording(
+        _In_ const std::string& content)
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream ofs(TEST_RECORDING, std::ios::trunc);
+
+    ofs << content;
+}
+
+static std::vector<std::string> readRecording(
+        _In_ bool threaded,
+        _In_ uint64_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    RecordingReader reader(TEST_RECORDING, threaded, offset);
+
+    EXPECT_TRUE(reader.isOpen());
+
+    std::vector<std::string> lines;
+
+    std::string line;
+
+    while (reader.getline(line))
+    {
+        lines.push_back(line);
+    }
+
+    // end of file is sticky
+
+    EXPECT_FALSE(reader.getline(line));
+
+    return lines;
+}
+
+static const std::string recording =
+"2017-06-14.01:55:46.541806|#|recording on: sairedis.rec\n"
+"2017-06-14.01:55:46.543987|a|INIT_VIEW\n"
+"\n"
+"2017-06-14.01:55:46.555975|c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true\n"
+"2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000004";
+
+TEST(RecordingReader, getline)
+{
+    writeRecording(recording);
+
+    std::vector<std::string> expected = {
+        "2017-06-14.01:55:46.541806|#|recording on: sairedis.rec",
+        "2017-06-14.01:55:46.543987|a|INIT_VIEW",
+        "",
+        "2017-06-14.01:55:46.555975|c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true",
+        "2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000004",
+    };
+
+    // last line without new line is also returned
+
+    EXPECT_EQ(readRecording(false, 0), expected);
+    EXPECT_EQ(readRecording(true, 0), expected);
+}
+
+TEST(RecordingReader, offset)
+{
+    writeRecording(recording);
+
+    // offset of third line, which is empty
+
+    uint64_t offset = recording.find("\n\n") + 1;
+
+    std::vector<std::string> expected = {
+        "",
+        "2017-06-14.01:55:46.555975|c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true",
+        "2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000004",
+    };
+
+    EXPECT_EQ(readRecording(false, offset), expected);
+    EXPECT_EQ(readRecording(true, offset), expected);
+
+    // offset at end of file
+
+    EXPECT_TRUE(readRecording(false, recording.size()).empty());
+    EXPECT_TRUE(readRecording(true, recording.size()).empty());
+}
+
+TEST(RecordingReader, chunks)
+{
+    // more lines than parser thread reads ahead, lines are handed over
+    // in many chunks and last chunk is partial
+
+    std::string content;
+
+    std::vector<std::string> expected;
+
+    for (size_t idx = 0; idx < RecordingReader::CHUNK_LINES * RecordingReader::MAX_CHUNKS * 2 + 7; idx++)
+    {
+        expected.push_back("2017-06-14.01:56:09.1|c|SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x300000000" + std::to_string(idx));
+
+        content += expected.back() + "\n";
+    }
+
+    writeRecording(content);
+
+    EXPECT_EQ(readRecording(false, 0), expected);
+    EXPECT_EQ(readRecording(true, 0), expected);
+
+    // reader released while parser thread waits for free chunk
+
+    RecordingReader reader(TEST_RECORDING, true);
+
+    std::string line;
+
+    EXPECT_TRUE(reader.getline(line));
+
+    EXPECT_EQ(line, expected.front());
+}
+
+TEST(RecordingReader, notExisting)
+{
+    RecordingReader reader("TestRecordingReader.notexisting.rec", false);
+
+    EXPECT_FALSE(reader.isOpen());
+
+    std::string line;
+
+    EXPECT_FALSE(reader.getline(line));
+
+    RecordingReader threaded("TestRecordingReader.notexisting.rec", true);
+
+    EXPECT_FALSE(threaded.isOpen());
+
+    EXPECT_FALSE(threaded.getline(line));
+}
@@ -0,0 +1,175 @@
+#include "AsicView.h"
+#include "StringPool.h"
+
+#include "swss/logger.h"
+#include "swss/table.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+using namespace syncd;
+
+#define SWITCH_VID  "oid:0x21000000000000"
+#define VR_VID      "oid:0x3000000000022"
+
+static swss::TableDump createDump(
+        _In_ size_t routes,
+        _In_ size_t nextHops)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:" SWITCH_VID]["SAI_SWITCH_ATTR_INIT_SWITCH"] = "true";
+
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:" VR_VID]["SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE"] = "true";
+
+    char buffer[256];
+
+    for (size_t idx = 0; idx < nextHops; idx++)
+    {
+        snprintf(buffer, sizeof(buffer), "SAI_OBJECT_TYPE_NEXT_HOP:oid:0x40000000001%02zx", idx);
+
+        auto& nh = dump[buffer];
+
+        nh["SAI_NEXT_HOP_ATTR_TYPE"] = "SAI_NEXT_HOP_TYPE_IP";
+
+        snprintf(buffer, sizeof(buffer), "10.0.0.%zu", idx);
+
+        nh["SAI_NEXT_HOP_ATTR_IP"] = buffer;
+    }
+
+    for (size_t idx = 0; idx < routes; idx++)
+    {
+        snprintf(buffer, sizeof(buffer),
+                "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"%zu.%zu.%zu.0/24\",\"switch_id\":\"" SWITCH_VID "\",\"vr\":\"" VR_VID "\"}",
+                20 + (idx >> 16), (idx >> 8) & 0xff, idx & 0xff);
+
+        auto& route = dump[buffer];
+
+        route["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_FORWARD";
+
+        snprintf(buffer, sizeof(buffer), "oid:0x40000000001%02zx", idx % nextHops);
+
+        route["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = buffer;
+    }
+
+    return dump;
+}
+
+static size_t getRss()
+{
+    SWSS_LOG_ENTER();
+
+    long pages = 0;
+    long resident = 0;
+
+    FILE* f = fopen("/proc/self/statm", "r");
+
+    if (f)
+    {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2)
+        {
+            resident = 0;
+        }
+
+        fclose(f);
+    }
+
+    return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+TEST(AsicView, fromDump)
+{
+    auto dump = createDump(100, 4);
+
+    AsicView view(dump);
+
+    EXPECT_EQ(view.m_soRoutes.size(), 100u);
+    EXPECT_EQ(view.m_soOids.size(), 6u);
+
+    // interned strings are equal to dump content
+
+    for (auto& kvp: dump)
+    {
+        auto pos = kvp.first.find(":");
+
+        auto& obj = view.m_soAll.at(kvp.first.substr(pos + 1));
+
+        EXPECT_EQ(obj->m_str_object_type.str(), kvp.first.substr(0, pos));
+
+        EXPECT_EQ(obj->getAllAttributes().size(), kvp.second.size());
+
+        for (auto& attr: obj->getAllAttributes())
+        {
+            EXPECT_EQ(kvp.second.at(attr.second->getStrAttrId()), attr.second->getStrAttrValue());
+        }
+    }
+
+    EXPECT_EQ(view.getVidReferenceCount(0x4000000000100), 25);
+}
+
+TEST(AsicView, memoryBenchmark)
+{
+    // number of routes can be increased to simulate large views,
+    // for example ASIC_VIEW_BENCHMARK_ROUTES=1000000
+
+    size_t routes = 10000;
+
+    const char* env = getenv("ASIC_VIEW_BENCHMARK_ROUTES");
+
+    if (env)
+    {
+        routes = (size_t)strtoull(env, nullptr, 10);
+    }
+
+    auto dump = createDump(routes, 64);
+
+    size_t poolSize = StringPool::getInstance().size();
+
+    size_t rss = getRss();
+
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        AsicView view(dump);
+
+        auto end = std::chrono::steady_clock::now();
+
+        size_t used = getRss() - rss;
+
+        std::cout << "[ BENCH    ] AsicView with " << routes << " routes: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms, "
+            << used / 1024 << " KB RSS, "
+            << (routes ? used / routes : 0) << " bytes per route, "
+            << StringPool::getInstance().size() - poolSize << " interned strings" << std::endl;
+
+        EXPECT_EQ(view.m_soRoutes.size(), routes);
+
+        // all attribute ids, enum values and next hops are shared
+
+        EXPECT_LT(StringPool::getInstance().size() - poolSize, 256u);
+
+        const std::string* action = nullptr;
+
+        for (auto& kvp: view.m_soRoutes)
+        {
+            auto& value = kvp.second->getSaiAttr(SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION)->getStrAttrValue();
+
+            if (action == nullptr)
+            {
+                action = &value;
+            }
+
+            EXPECT_EQ(&value, action);
+        }
+    }
+
+    EXPECT_EQ(StringPool::getInstance().size(), poolSize);
+}
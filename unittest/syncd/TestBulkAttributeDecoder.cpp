@@ -0,0 +1,173 @@
+#include "BulkAttributeDecoder.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace syncd;
+using namespace saimeta;
+
+static std::vector<swss::FieldValueTuple> generateRoutes(
+        _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.reserve(count);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        sai_route_entry_t re;
+
+        memset(&re, 0, sizeof(re));
+
+        re.switch_id = 0x21000000000000;
+        re.vr_id = 0x3000000000022;
+        re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        re.destination.addr.ip4 = htonl((uint32_t)(0x0a000000 + (idx << 8)));
+        re.destination.mask.ip4 = htonl(0xffffff00);
+
+        values.emplace_back(sai_serialize_route_entry(re),
+                "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_FORWARD|SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID=oid:0x4000000000100");
+    }
+
+    return values;
+}
+
+TEST(BulkAttributeDecoder, splitAttributes)
+{
+    std::vector<swss::FieldValueTuple> entries;
+
+    BulkAttributeDecoder::splitAttributes("", entries);
+
+    EXPECT_EQ(entries.size(), 0);
+
+    BulkAttributeDecoder::splitAttributes("A=1|B=2=3|C=", entries);
+
+    ASSERT_EQ(entries.size(), 3);
+
+    EXPECT_EQ(fvField(entries[0]), "A");
+    EXPECT_EQ(fvValue(entries[0]), "1");
+    EXPECT_EQ(fvField(entries[1]), "B");
+    EXPECT_EQ(fvValue(entries[1]), "2=3");
+    EXPECT_EQ(fvField(entries[2]), "C");
+    EXPECT_EQ(fvValue(entries[2]), "");
+
+    // trailing delimiter is ignored, same as swss::tokenize
+
+    BulkAttributeDecoder::splitAttributes("A=1|", entries);
+
+    ASSERT_EQ(entries.size(), 1);
+
+    BulkAttributeDecoder::splitAttributes("NULL", entries);
+
+    ASSERT_EQ(entries.size(), 1);
+
+    EXPECT_EQ(fvField(entries[0]), "NULL");
+    EXPECT_EQ(fvValue(entries[0]), "NULL");
+}
+
+TEST(BulkAttributeDecoder, decode)
+{
+    auto values = generateRoutes(3 * BulkAttributeDecoder::PARALLEL_MIN_OBJECTS);
+
+    std::vector<std::string> objectIds;
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+    BulkAttributeDecoder::decode(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, 1, objectIds, attributes, strAttributes);
+
+    std::vector<std::string> parallelObjectIds;
+    std::vector<std::shared_ptr<SaiAttributeList>> parallelAttributes;
+    std::vector<std::vector<swss::FieldValueTuple>> parallelStrAttributes;
+
+    BulkAttributeDecoder::decode(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, 4, parallelObjectIds, parallelAttributes, parallelStrAttributes);
+
+    ASSERT_EQ(objectIds.size(), values.size());
+    ASSERT_EQ(attributes.size(), values.size());
+    ASSERT_EQ(strAttributes.size(), values.size());
+
+    EXPECT_EQ(objectIds, parallelObjectIds);
+    EXPECT_EQ(strAttributes, parallelStrAttributes);
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        EXPECT_EQ(objectIds[idx], fvField(values[idx]));
+
+        ASSERT_EQ(attributes[idx]->get_attr_count(), 2);
+        ASSERT_EQ(parallelAttributes[idx]->get_attr_count(), 2);
+
+        auto attr = attributes[idx]->get_attr_list();
+
+        EXPECT_EQ(attr[0].id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+        EXPECT_EQ(attr[0].value.s32, SAI_PACKET_ACTION_FORWARD);
+        EXPECT_EQ(attr[1].id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+        EXPECT_EQ(attr[1].value.oid, 0x4000000000100);
+    }
+
+    // attribute lists are valid after other lists are released
+
+    auto last = attributes.back();
+
+    attributes.clear();
+
+    EXPECT_EQ(last->get_attr_list()[1].value.oid, 0x4000000000100);
+}
+
+TEST(BulkAttributeDecoder, decodeInvalid)
+{
+    auto values = generateRoutes(2 * BulkAttributeDecoder::PARALLEL_MIN_OBJECTS);
+
+    values.back() = swss::FieldValueTuple(fvField(values.back()), "SAI_ROUTE_ENTRY_ATTR_FOO=1");
+
+    std::vector<std::string> objectIds;
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+    EXPECT_ANY_THROW(BulkAttributeDecoder::decode(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, 1, objectIds, attributes, strAttributes));
+
+    EXPECT_ANY_THROW(BulkAttributeDecoder::decode(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, 2, objectIds, attributes, strAttributes));
+}
+
+TEST(BulkAttributeDecoder, decodeBenchmark)
+{
+    // number of routes can be changed, for example SYNCD_BULK_BENCHMARK_ROUTES=1000000
+
+    size_t routes = 65536;
+
+    const char* env = getenv("SYNCD_BULK_BENCHMARK_ROUTES");
+
+    if (env)
+    {
+        routes = (size_t)strtoull(env, nullptr, 10);
+    }
+
+    auto values = generateRoutes(routes);
+
+    for (uint32_t threads: {1, 4})
+    {
+        std::vector<std::string> objectIds;
+        std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+        std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+        auto start = std::chrono::steady_clock::now();
+
+        BulkAttributeDecoder::decode(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, threads, objectIds, attributes, strAttributes);
+
+        auto end = std::chrono::steady_clock::now();
+
+        std::cout << "[ BENCH    ] decode of " << routes << " routes, threads " << threads << ": "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+        EXPECT_EQ(attributes.size(), routes);
+    }
+}
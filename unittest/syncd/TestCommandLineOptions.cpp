@@ -7,7 +7,7 @@
 using namespace syncd;
 
 const std::string expected_usage =
-R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]
+R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-c cacheFile] [-D threads] [-h]
     -d --diag
         Enable diagnostic shell
     -p --profile profile
@@ -40,6 +40,12 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
         Counter groups those support bulk polling
     -a --enableAttrVersionCheck
         Enable attribute SAI version check when performing SAI discovery
+    -L --latencyHistogramInterval interval
+        Export SAI API latency histograms to COUNTERS_DB every interval seconds, default: 0 (disabled)
+    -c --statsCapabilityCache cacheFile
+        Persist stats capability probing results in cacheFile to speed up counter registration
+    -D --bulkDecodeThreads threads
+        Number of threads deserializing attributes of large bulk requests, default: 1
     -h --help
         Print out this message
 )";
@@ -53,7 +59,8 @@ TEST(CommandLineOptions, getCommandLineString)
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
             " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig="
-            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO");
+            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO LatencyHistogramInterval=0"
+            " StatsCapabilityCacheFile= BulkDecodeThreads=1");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -81,9 +88,18 @@ TEST(CommandLineOptionsParser, parseCommandLine)
     char arg3[] = "1000";
     char arg4[] = "-B";
     char arg5[] = "WATERMARK";
-    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5};
+    char arg6[] = "-L";
+    char arg7[] = "10";
+    char arg8[] = "-c";
+    char arg9[] = "/tmp/stats_capability.json";
+    char arg10[] = "-D";
+    char arg11[] = "4";
+    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11};
 
     auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
     EXPECT_EQ(opt->m_watchdogWarnTimeSpan, 1000);
     EXPECT_EQ(opt->m_supportingBulkCounterGroups, "WATERMARK");
+    EXPECT_EQ(opt->m_latencyHistogramInterval, 10u);
+    EXPECT_EQ(opt->m_statsCapabilityCacheFile, "/tmp/stats_capability.json");
+    EXPECT_EQ(opt->m_bulkDecodeThreads, 4u);
 }
@@ -0,0 +1,100 @@
+#include "CounterRateCalculator.h"
+
+#include "swss/logger.h"
+#include "swss/schema.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static std::vector<swss::FieldValueTuple> makeCounters(
+        _In_ uint64_t octets,
+        _In_ uint64_t ucast,
+        _In_ uint64_t nonUcast)
+{
+    SWSS_LOG_ENTER();
+
+    return {
+        {"SAI_PORT_STAT_IF_IN_OCTETS", std::to_string(octets)},
+        {"SAI_PORT_STAT_IF_IN_UCAST_PKTS", std::to_string(ucast)},
+        {"SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS", std::to_string(nonUcast)},
+    };
+}
+
+TEST(CounterRateCalculator, formatNumber)
+{
+    EXPECT_EQ(CounterRateCalculator::formatNumber(1000), "1000");
+    EXPECT_EQ(CounterRateCalculator::formatNumber(0.5), "0.5");
+    EXPECT_EQ(CounterRateCalculator::formatNumber(1.0 / 3), "0.33333333333333");
+}
+
+TEST(CounterRateCalculator, update)
+{
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table ratesTable(&db, RATES_TABLE);
+
+    ratesTable.del("oid:0x1");
+    ratesTable.del("oid:0x1:PORT");
+
+    CounterRateCalculator calculator("PORT", {
+            {"RX_BPS", {"SAI_PORT_STAT_IF_IN_OCTETS"}},
+            {"RX_PPS", {"SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS"}}});
+
+    std::chrono::steady_clock::time_point now(std::chrono::seconds(1));
+
+    // nothing is computed until alpha is configured
+
+    calculator.update("oid:0x1", makeCounters(0, 0, 0), now);
+    calculator.flush(ratesTable);
+
+    std::string value;
+
+    EXPECT_FALSE(ratesTable.hget("oid:0x1:PORT", "INIT_DONE", value));
+
+    calculator.setAlpha(0.5);
+
+    calculator.update("oid:0x1", makeCounters(0, 0, 0), now);
+    calculator.flush(ratesTable);
+
+    EXPECT_TRUE(ratesTable.hget("oid:0x1:PORT", "INIT_DONE", value));
+    EXPECT_EQ(value, "COUNTERS_LAST");
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "SAI_PORT_STAT_IF_IN_OCTETS_last", value));
+    EXPECT_EQ(value, "0");
+    EXPECT_FALSE(ratesTable.hget("oid:0x1", "RX_BPS", value));
+
+    // first rates are not smoothed
+
+    now += std::chrono::seconds(1);
+
+    calculator.update("oid:0x1", makeCounters(1000, 100, 10), now);
+    calculator.flush(ratesTable);
+
+    EXPECT_TRUE(ratesTable.hget("oid:0x1:PORT", "INIT_DONE", value));
+    EXPECT_EQ(value, "DONE");
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "RX_BPS", value));
+    EXPECT_EQ(value, "1000");
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "RX_PPS", value));
+    EXPECT_EQ(value, "110");
+
+    now += std::chrono::seconds(1);
+
+    calculator.update("oid:0x1", makeCounters(4000, 110, 10), now);
+    calculator.flush(ratesTable);
+
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "RX_BPS", value));
+    EXPECT_EQ(value, "2000");
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "RX_PPS", value));
+    EXPECT_EQ(value, "60");
+    EXPECT_TRUE(ratesTable.hget("oid:0x1", "SAI_PORT_STAT_IF_IN_UCAST_PKTS_last", value));
+    EXPECT_EQ(value, "110");
+
+    // object missing rate counter is skipped
+
+    calculator.update("oid:0x2", {{"SAI_PORT_STAT_IF_IN_OCTETS", "1"}}, now);
+    calculator.flush(ratesTable);
+
+    EXPECT_FALSE(ratesTable.hget("oid:0x2:PORT", "INIT_DONE", value));
+
+    ratesTable.del("oid:0x1");
+    ratesTable.del("oid:0x1:PORT");
+}
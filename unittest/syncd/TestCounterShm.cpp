@@ -0,0 +1,193 @@
+#include "CounterShmReader.h"
+#include "CounterShmWriter.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+
+using namespace syncd;
+
+static const std::string SHM_DIRECTORY = "/tmp";
+
+static std::vector<swss::FieldValueTuple> makeValues(
+        _In_ uint64_t a,
+        _In_ uint64_t b)
+{
+    SWSS_LOG_ENTER();
+
+    return {{"SAI_PORT_STAT_IF_IN_OCTETS", std::to_string(a)}, {"SAI_PORT_STAT_IF_OUT_OCTETS", std::to_string(b)}};
+}
+
+TEST(CounterShm, getFileName)
+{
+    EXPECT_EQ(CounterShm::getFileName("PORT_STAT_COUNTER", "/dev/shm"), "/dev/shm/sonic_counters_PORT_STAT_COUNTER");
+    EXPECT_EQ(CounterShm::getFileName("a/b c", "/tmp"), "/tmp/sonic_counters_a_b_c");
+}
+
+static ino_t getInode(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    struct stat st;
+
+    return stat(fileName.c_str(), &st) == 0 ? st.st_ino : 0;
+}
+
+TEST(CounterShm, readWrite)
+{
+    auto fileName = CounterShm::getFileName("TestCounterShm", SHM_DIRECTORY);
+
+    auto writer = std::make_shared<CounterShmWriter>(fileName);
+
+    CounterShmReader reader(fileName);
+
+    uint64_t value;
+
+    // nothing published yet
+
+    EXPECT_FALSE(reader.read());
+
+    writer->begin();
+    writer->update(0x1000000000001, makeValues(10, 20));
+    writer->update(0x1000000000002, makeValues(30, 40));
+    writer->commit();
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_EQ(reader.getObjectIds().size(), 2);
+    EXPECT_EQ(reader.getCounterNames().size(), 2);
+    EXPECT_NE(reader.getTimestamp(), 0);
+
+    EXPECT_TRUE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_EQ(value, 40);
+    EXPECT_FALSE(reader.getValue(0x1000000000003, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_FALSE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_IN_ERRORS", value));
+
+    // same layout is updated in place
+
+    writer->begin();
+    writer->update(0x1000000000001, makeValues(11, 21));
+    writer->update(0x1000000000002, makeValues(31, 41));
+    writer->commit();
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_TRUE(reader.getValue(0x1000000000001, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+    EXPECT_EQ(value, 11);
+
+    // removed object and new counter publish new file
+
+    writer->begin();
+    writer->update(0x1000000000001, {{"SAI_PORT_STAT_IF_IN_OCTETS", "12"}, {"SAI_PORT_STAT_IF_IN_ERRORS", "1"}});
+    writer->update(0x1000000000003, makeValues(50, 60));
+    writer->commit();
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_EQ(reader.getObjectIds(), std::vector<uint64_t>({0x1000000000001, 0x1000000000003}));
+    EXPECT_EQ(reader.getCounterNames().size(), 3);
+
+    EXPECT_FALSE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+
+    EXPECT_TRUE(reader.getValue(0x1000000000001, "SAI_PORT_STAT_IF_IN_ERRORS", value));
+    EXPECT_EQ(value, 1);
+
+    // counter not collected for object
+
+    EXPECT_FALSE(reader.getValue(0x1000000000001, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_FALSE(reader.getValue(0x1000000000003, "SAI_PORT_STAT_IF_IN_ERRORS", value));
+
+    EXPECT_TRUE(reader.getValue(0x1000000000003, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_EQ(value, 60);
+
+    // writer removes file on destroy
+
+    writer = nullptr;
+
+    EXPECT_NE(access(fileName.c_str(), F_OK), 0);
+    EXPECT_FALSE(reader.read());
+}
+
+TEST(CounterShm, keep)
+{
+    auto fileName = CounterShm::getFileName("TestCounterShmKeep", SHM_DIRECTORY);
+
+    CounterShmWriter writer(fileName);
+
+    CounterShmReader reader(fileName);
+
+    uint64_t value;
+
+    writer.begin();
+    writer.update(0x1000000000001, makeValues(10, 20));
+    writer.update(0x1000000000002, makeValues(30, 40));
+    writer.commit();
+
+    auto inode = getInode(fileName);
+
+    ASSERT_NE(inode, 0);
+
+    // object which failed to collect keeps previous values in place
+
+    writer.begin();
+    writer.update(0x1000000000001, makeValues(11, 21));
+    writer.keep(0x1000000000002);
+    writer.keep(0x1000000000004);
+    writer.commit();
+
+    EXPECT_EQ(getInode(fileName), inode);
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_EQ(reader.getObjectIds(), std::vector<uint64_t>({0x1000000000001, 0x1000000000002}));
+
+    EXPECT_TRUE(reader.getValue(0x1000000000001, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+    EXPECT_EQ(value, 11);
+
+    EXPECT_TRUE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_EQ(value, 40);
+
+    // new object publishes new file, kept object values are copied
+
+    writer.begin();
+    writer.keep(0x1000000000001);
+    writer.keep(0x1000000000002);
+    writer.update(0x1000000000003, makeValues(50, 60));
+    writer.commit();
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_EQ(reader.getObjectIds(), std::vector<uint64_t>({0x1000000000001, 0x1000000000002, 0x1000000000003}));
+    EXPECT_EQ(reader.getCounterNames().size(), 2);
+
+    EXPECT_TRUE(reader.getValue(0x1000000000001, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_EQ(value, 21);
+
+    EXPECT_TRUE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+    EXPECT_EQ(value, 30);
+
+    EXPECT_TRUE(reader.getValue(0x1000000000003, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+    EXPECT_EQ(value, 50);
+
+    // object neither collected nor kept was removed
+
+    writer.begin();
+    writer.update(0x1000000000001, makeValues(12, 22));
+    writer.keep(0x1000000000003);
+    writer.commit();
+
+    ASSERT_TRUE(reader.read());
+
+    EXPECT_EQ(reader.getObjectIds(), std::vector<uint64_t>({0x1000000000001, 0x1000000000003}));
+
+    EXPECT_FALSE(reader.getValue(0x1000000000002, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+
+    EXPECT_TRUE(reader.getValue(0x1000000000003, "SAI_PORT_STAT_IF_OUT_OCTETS", value));
+    EXPECT_EQ(value, 60);
+}
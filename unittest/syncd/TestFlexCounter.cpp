@@ -4,6 +4,7 @@
 #include "MockHelper.h"
 #include "VirtualObjectIdManager.h"
 #include "NumberOidIndexGenerator.h"
+#include <cstring>
 #include <string>
 #include <gtest/gtest.h>
 
@@ -750,6 +751,121 @@ TEST(FlexCounter, noSupportedCounters)
     EXPECT_EQ(fc.isEmpty(), true);
 }
 
+TEST(FlexCounter, bulkCapabilityCacheTransientFailure)
+{
+    sai->mock_queryStatsCapability = [](sai_object_id_t switch_id, sai_object_type_t object_type, sai_stat_capability_list_t *stats_capability) {
+        if (stats_capability->count == 0)
+        {
+            stats_capability->count = 1;
+            return SAI_STATUS_BUFFER_OVERFLOW;
+        }
+        else
+        {
+            stats_capability->list[0].stat_enum = SAI_PORT_STAT_IF_IN_OCTETS;
+            stats_capability->list[0].stat_modes = SAI_STATS_MODE_READ | SAI_STATS_MODE_BULK_READ;
+            return SAI_STATUS_SUCCESS;
+        }
+    };
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *, uint64_t *counters) {
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = 1000;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+
+    sai_status_t getStatus = SAI_STATUS_SUCCESS;
+
+    sai->mock_get = [&] (sai_object_type_t objectType, sai_object_id_t objectId, uint32_t attr_count, sai_attribute_t *attr_list) {
+        if (getStatus == SAI_STATUS_SUCCESS && attr_list[0].id == SAI_SWITCH_ATTR_SWITCH_HARDWARE_INFO)
+        {
+            strncpy((char*)attr_list[0].value.s8list.list, "hw", attr_list[0].value.s8list.count);
+        }
+        return getStatus;
+    };
+
+    sai_status_t bulkStatus = SAI_STATUS_FAILURE;
+    int bulkCalls = 0;
+
+    sai->mock_bulkGetStats = [&](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *)
+    {
+        bulkCalls++;
+        return bulkStatus;
+    };
+
+    const char* cacheFile = "/tmp/TestFlexCounterStatsCapabilityCache.json";
+
+    std::remove(cacheFile);
+
+    auto cache = std::make_shared<StatsCapabilityCache>(cacheFile);
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+    fc.setStatsCapabilityCache(cache);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS");
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<sai_object_id_t> oids = generateOids(4, SAI_OBJECT_TYPE_PORT);
+    std::vector<uint32_t> counterIds = {SAI_PORT_STAT_IF_IN_OCTETS};
+    bool supported;
+
+    // transient failure is not cached, next object probes again
+
+    fc.addCounter(oids[0], oids[0], values);
+    EXPECT_EQ(bulkCalls, 1);
+    EXPECT_FALSE(cache->getBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, counterIds, supported));
+
+    fc.addCounter(oids[1], oids[1], values);
+    EXPECT_EQ(bulkCalls, 2);
+
+    // not supported status is cached
+
+    bulkStatus = SAI_STATUS_NOT_SUPPORTED;
+
+    fc.addCounter(oids[2], oids[2], values);
+    EXPECT_EQ(bulkCalls, 3);
+    EXPECT_TRUE(cache->getBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, counterIds, supported));
+    EXPECT_FALSE(supported);
+
+    fc.addCounter(oids[3], oids[3], values);
+    EXPECT_EQ(bulkCalls, 3);
+
+    for (auto oid: oids)
+    {
+        fc.removeCounter(oid);
+    }
+
+    EXPECT_EQ(fc.isEmpty(), true);
+
+    // cache is not used if hardware info is not available
+
+    getStatus = SAI_STATUS_FAILURE;
+
+    cache = nullptr;
+
+    std::remove(cacheFile);
+
+    cache = std::make_shared<StatsCapabilityCache>(cacheFile);
+
+    FlexCounter fc2("test2", sai, "COUNTERS_DB");
+    fc2.setStatsCapabilityCache(cache);
+
+    fc2.addCounter(oids[0], oids[0], values);
+    fc2.addCounter(oids[1], oids[1], values);
+    EXPECT_EQ(bulkCalls, 5);
+    EXPECT_FALSE(cache->hasPlatform());
+
+    fc2.removeCounter(oids[0]);
+    fc2.removeCounter(oids[1]);
+
+    sai->mock_get = nullptr;
+
+    std::remove(cacheFile);
+}
+
 void testAddRemovePlugin(const std::string& pluginFieldName)
 {
     SWSS_LOG_ENTER();
@@ -765,6 +881,26 @@ void testAddRemovePlugin(const std::string& pluginFieldName)
     EXPECT_EQ(fc.isEmpty(), true);
 }
 
+TEST(FlexCounter, removePollStats)
+{
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table pollStatsTable(&db, FlexCounterPollStats::POLL_STATS_TABLE);
+
+    pollStatsTable.set("POLL_STATS_TEST", {{"POLL_COUNT", "1"}});
+    pollStatsTable.set("POLL_STATS_TEST:HISTOGRAM", {{"COUNT", "1"}});
+
+    {
+        FlexCounter fc("POLL_STATS_TEST", sai, "COUNTERS_DB");
+    }
+
+    // group torn down
+
+    std::vector<swss::FieldValueTuple> values;
+
+    EXPECT_FALSE(pollStatsTable.get("POLL_STATS_TEST", values));
+    EXPECT_FALSE(pollStatsTable.get("POLL_STATS_TEST:HISTOGRAM", values));
+}
+
 TEST(FlexCounter, addRemoveCounterPlugin)
 {
     std::string fields[] = {QUEUE_PLUGIN_FIELD,
@@ -0,0 +1,108 @@
+#include "FlexCounterPollStats.h"
+
+#include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static std::chrono::steady_clock::time_point at(
+        _In_ int64_t ms)
+{
+    SWSS_LOG_ENTER();
+
+    return std::chrono::steady_clock::time_point(std::chrono::milliseconds(ms));
+}
+
+TEST(FlexCounterPollStats, missedDeadlines)
+{
+    FlexCounterPollStats stats("PORT_STAT_COUNTER");
+
+    // polls on aligned deadlines
+
+    stats.recordPoll(at(1000), std::chrono::milliseconds(100), 1000);
+    stats.recordPoll(at(2001), std::chrono::milliseconds(300), 1000);
+
+    EXPECT_EQ(stats.getPollCount(), 2);
+    EXPECT_EQ(stats.getMissedDeadlines(), 0);
+
+    EXPECT_EQ(stats.getCollectTime().m_last, 300000);
+    EXPECT_EQ(stats.getCollectTime().average(), 200000);
+    EXPECT_EQ(stats.getCollectTime().m_max, 300000);
+
+    // collection took longer than interval, deadline 3000 and 4000 skipped
+
+    stats.recordPoll(at(5000), std::chrono::milliseconds(2500), 1000);
+
+    EXPECT_EQ(stats.getMissedDeadlines(), 2);
+
+    // idle group and interval change do not count as missed
+
+    stats.reset();
+
+    stats.recordPoll(at(9000), std::chrono::milliseconds(10), 1000);
+
+    stats.recordPoll(at(20000), std::chrono::milliseconds(10), 10000);
+
+    EXPECT_EQ(stats.getMissedDeadlines(), 2);
+    EXPECT_EQ(stats.getPollCount(), 5);
+}
+
+TEST(FlexCounterPollStats, contexts)
+{
+    FlexCounterPollStats stats("PORT_STAT_COUNTER");
+
+    stats.recordContext("Port Counter", 32, std::chrono::milliseconds(10), std::chrono::milliseconds(8));
+    stats.recordContext("Port Counter", 32, std::chrono::milliseconds(20), std::chrono::milliseconds(12));
+
+    auto& contexts = stats.getContextStats();
+
+    ASSERT_EQ(contexts.size(), 1);
+
+    auto& port = contexts.at("Port Counter");
+
+    EXPECT_EQ(port.m_objectCount, 32);
+    EXPECT_EQ(port.m_collectTime.m_last, 20000);
+    EXPECT_EQ(port.m_saiTime.average(), 10000);
+    EXPECT_EQ(port.m_redisTime.m_last, 8000);
+    EXPECT_EQ(port.m_redisTime.m_max, 8000);
+
+    stats.removeContext("Port Counter");
+
+    EXPECT_TRUE(stats.getContextStats().empty());
+}
+
+TEST(FlexCounterPollStats, remove)
+{
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table table(&db, FlexCounterPollStats::POLL_STATS_TABLE);
+
+    FlexCounterPollStats stats("POLL_STATS_REMOVE_TEST");
+
+    stats.recordPoll(at(1000), std::chrono::milliseconds(10), 1000);
+    stats.recordContext("Port Counter", 32, std::chrono::milliseconds(10), std::chrono::milliseconds(8));
+    stats.recordContext("Queue Counter", 8, std::chrono::milliseconds(10), std::chrono::milliseconds(8));
+
+    stats.publish(table);
+
+    // removed context not published yet
+
+    stats.removeContext("Queue Counter");
+
+    std::vector<swss::FieldValueTuple> values;
+
+    EXPECT_TRUE(table.get("POLL_STATS_REMOVE_TEST", values));
+    EXPECT_TRUE(table.get("POLL_STATS_REMOVE_TEST:HISTOGRAM", values));
+    EXPECT_TRUE(table.get("POLL_STATS_REMOVE_TEST:Queue Counter", values));
+
+    stats.remove(table);
+
+    EXPECT_FALSE(table.get("POLL_STATS_REMOVE_TEST", values));
+    EXPECT_FALSE(table.get("POLL_STATS_REMOVE_TEST:HISTOGRAM", values));
+    EXPECT_FALSE(table.get("POLL_STATS_REMOVE_TEST:Port Counter", values));
+    EXPECT_FALSE(table.get("POLL_STATS_REMOVE_TEST:Queue Counter", values));
+
+    EXPECT_TRUE(stats.getContextStats().empty());
+}
@@ -0,0 +1,176 @@
+#include "FlexCounterScheduler.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace syncd;
+
+class TestFlexCounterSchedulerClient:
+    public FlexCounterScheduler::Client
+{
+    public:
+
+        TestFlexCounterSchedulerClient(
+                _In_ uint32_t pollInterval,
+                _In_ uint32_t pollDuration = 0):
+            m_pollInterval(pollInterval),
+            m_pollDuration(pollDuration),
+            m_polls(0),
+            m_plugins(0)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual uint32_t pollCounters(
+                _In_ swss::Table& countersTable,
+                _In_ swss::Table& ratesTable,
+                _In_ swss::Table& pollStatsTable) override
+        {
+            SWSS_LOG_ENTER();
+
+            m_polls++;
+
+            usleep(m_pollDuration * 1000);
+
+            return m_pollInterval;
+        }
+
+        virtual void runPollPlugins(
+                _In_ swss::DBConnector& db) override
+        {
+            SWSS_LOG_ENTER();
+
+            m_plugins++;
+        }
+
+    public:
+
+        std::atomic<uint32_t> m_pollInterval;
+
+        std::atomic<uint32_t> m_pollDuration;
+
+        std::atomic<int> m_polls;
+
+        std::atomic<int> m_plugins;
+};
+
+TEST(FlexCounterScheduler, alignDeadline)
+{
+    std::chrono::steady_clock::time_point now(std::chrono::milliseconds(12345));
+
+    auto deadline = FlexCounterScheduler::alignDeadline(now, 1000);
+
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(), 13000);
+
+    deadline = FlexCounterScheduler::alignDeadline(std::chrono::steady_clock::time_point(std::chrono::milliseconds(13000)), 1000);
+
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(), 14000);
+}
+
+TEST(FlexCounterScheduler, nextDeadline)
+{
+    std::chrono::steady_clock::time_point previous(std::chrono::milliseconds(13000));
+
+    auto deadline = FlexCounterScheduler::nextDeadline(previous, previous + std::chrono::milliseconds(300), 1000);
+
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(), 14000);
+
+    // poll took longer than interval, missed deadlines are skipped
+
+    deadline = FlexCounterScheduler::nextDeadline(previous, previous + std::chrono::milliseconds(2500), 1000);
+
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(), 16000);
+
+    deadline = FlexCounterScheduler::nextDeadline(previous, previous + std::chrono::milliseconds(1000), 1000);
+
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(), 15000);
+}
+
+TEST(FlexCounterScheduler, notify)
+{
+    FlexCounterScheduler scheduler("COUNTERS_DB");
+
+    TestFlexCounterSchedulerClient idle(0);
+
+    scheduler.addClient(&idle);
+
+    EXPECT_THROW(scheduler.addClient(&idle), std::runtime_error);
+
+    // not polled until notified
+
+    usleep(50 * 1000);
+
+    EXPECT_EQ(idle.m_polls, 0);
+
+    scheduler.notify(&idle);
+
+    usleep(50 * 1000);
+
+    // nothing collected, plugins don't run and client is not rescheduled
+
+    EXPECT_EQ(idle.m_polls, 1);
+    EXPECT_EQ(idle.m_plugins, 0);
+
+    scheduler.removeClient(&idle);
+}
+
+TEST(FlexCounterScheduler, poll)
+{
+    FlexCounterScheduler scheduler("COUNTERS_DB");
+
+    TestFlexCounterSchedulerClient a(10);
+    TestFlexCounterSchedulerClient b(10);
+
+    scheduler.addClient(&a);
+    scheduler.addClient(&b);
+
+    scheduler.notify(&a);
+    scheduler.notify(&b);
+
+    usleep(200 * 1000);
+
+    EXPECT_GT(a.m_polls, 5);
+    EXPECT_GT(b.m_polls, 5);
+    EXPECT_EQ(a.m_polls, a.m_plugins);
+
+    scheduler.removeClient(&a);
+
+    int polls = a.m_polls;
+
+    usleep(50 * 1000);
+
+    EXPECT_EQ(a.m_polls, polls);
+    EXPECT_GT(b.m_polls, polls);
+
+    scheduler.removeClient(&b);
+}
+
+TEST(FlexCounterScheduler, slowClient)
+{
+    FlexCounterScheduler scheduler("COUNTERS_DB");
+
+    // deadlines of both clients are on common grid every 100 ms
+
+    TestFlexCounterSchedulerClient slow(100, 150);
+    TestFlexCounterSchedulerClient fast(10);
+
+    scheduler.addClient(&slow);
+    scheduler.addClient(&fast);
+
+    scheduler.notify(&slow);
+    scheduler.notify(&fast);
+
+    usleep(600 * 1000);
+
+    // fast client is polled by other worker while slow one is polled
+
+    EXPECT_GT(fast.m_polls, 30);
+
+    scheduler.removeClient(&slow);
+    scheduler.removeClient(&fast);
+}
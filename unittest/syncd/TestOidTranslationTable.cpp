@@ -0,0 +1,199 @@
+#include "OidTranslationTable.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+
+using namespace syncd;
+
+static sai_object_id_t createOid(
+        _In_ uint64_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return (objectType << 48) | index;
+}
+
+TEST(OidTranslationTable, insertLookup)
+{
+    OidTranslationTable table;
+
+    EXPECT_EQ(table.size(), 0);
+
+    EXPECT_EQ(table.lookup(SAI_NULL_OBJECT_ID), SAI_NULL_OBJECT_ID);
+
+    EXPECT_EQ(table.lookup(0x21000000000000), SAI_NULL_OBJECT_ID);
+
+    table.insert(0x21000000000000, 0x2100000000);
+
+    EXPECT_EQ(table.lookup(0x21000000000000), 0x2100000000);
+
+    table.insert(0x21000000000000, 0x2100000001);
+
+    EXPECT_EQ(table.lookup(0x21000000000000), 0x2100000001);
+
+    EXPECT_EQ(table.size(), 1);
+
+    // null key is never stored
+
+    table.insert(SAI_NULL_OBJECT_ID, 0x2100000000);
+
+    EXPECT_EQ(table.size(), 1);
+
+    EXPECT_EQ(table.lookup(SAI_NULL_OBJECT_ID), SAI_NULL_OBJECT_ID);
+
+    table.clear();
+
+    EXPECT_EQ(table.size(), 0);
+
+    EXPECT_EQ(table.lookup(0x21000000000000), SAI_NULL_OBJECT_ID);
+}
+
+TEST(OidTranslationTable, batchLookup)
+{
+    OidTranslationTable table;
+
+    for (uint64_t idx = 1; idx <= 1000; idx++)
+    {
+        table.insert(createOid(1, idx), createOid(1, idx) + 0x1000);
+    }
+
+    EXPECT_EQ(table.size(), 1000);
+
+    std::vector<sai_object_id_t> keys = { createOid(1, 5), SAI_NULL_OBJECT_ID, createOid(2, 5), createOid(1, 1000) };
+
+    std::vector<sai_object_id_t> values(keys.size());
+
+    EXPECT_EQ(table.lookup(keys.size(), keys.data(), values.data()), 2);
+
+    EXPECT_EQ(values, std::vector<sai_object_id_t>({ createOid(1, 5) + 0x1000, SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, createOid(1, 1000) + 0x1000 }));
+
+    EXPECT_EQ(table.lookup(0, keys.data(), values.data()), 0);
+}
+
+TEST(OidTranslationTable, erase)
+{
+    OidTranslationTable table;
+
+    EXPECT_FALSE(table.erase(SAI_NULL_OBJECT_ID));
+
+    EXPECT_FALSE(table.erase(0x1));
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> map;
+
+    std::mt19937_64 gen(1);
+
+    // small index range, so same keys are inserted and erased many times
+
+    for (int i = 0; i < 100000; i++)
+    {
+        sai_object_id_t key = createOid(gen() % 4, gen() % 512 + 1);
+
+        if (gen() % 3)
+        {
+            table.insert(key, key + 1);
+
+            map[key] = key + 1;
+        }
+        else
+        {
+            EXPECT_EQ(table.erase(key), map.erase(key) == 1);
+        }
+    }
+
+    EXPECT_EQ(table.size(), map.size());
+
+    for (uint64_t type = 0; type < 4; type++)
+    {
+        for (uint64_t idx = 1; idx <= 512; idx++)
+        {
+            sai_object_id_t key = createOid(type, idx);
+
+            auto it = map.find(key);
+
+            EXPECT_EQ(table.lookup(key), it == map.end() ? SAI_NULL_OBJECT_ID : it->second);
+        }
+    }
+}
+
+TEST(OidTranslationTable, benchmark)
+{
+    // number of OIDs can be changed, for example OID_TRANSLATION_BENCHMARK_OIDS=1000000
+
+    size_t count = 100000;
+
+    const char* env = getenv("OID_TRANSLATION_BENCHMARK_OIDS");
+
+    if (env)
+    {
+        count = (size_t)strtoull(env, nullptr, 10);
+    }
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> map;
+
+    OidTranslationTable table;
+
+    std::vector<sai_object_id_t> keys;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        // ports, queues and buffer profiles on single switch
+
+        sai_object_id_t vid = (0x21ULL << 56) | createOid(1 + idx % 3, idx + 1);
+
+        map[vid] = idx + 1;
+
+        table.insert(vid, idx + 1);
+
+        keys.push_back(vid);
+    }
+
+    // lists are translated in random order of the whole table
+
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(1));
+
+    std::vector<sai_object_id_t> expected(count);
+    std::vector<sai_object_id_t> values(count);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        expected[idx] = map.find(keys[idx])->second;
+    }
+
+    auto mapTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        values[idx] = table.lookup(keys[idx]);
+    }
+
+    auto lookupTime = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(values, expected);
+
+    start = std::chrono::steady_clock::now();
+
+    size_t missing = table.lookup(count, keys.data(), values.data());
+
+    auto batchTime = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(missing, 0);
+
+    EXPECT_EQ(values, expected);
+
+    std::cout << "[ BENCH    ] lookup of " << count << " OIDs: unordered_map "
+        << std::chrono::duration_cast<std::chrono::microseconds>(mapTime).count() << " us, table "
+        << std::chrono::duration_cast<std::chrono::microseconds>(lookupTime).count() << " us, table batch "
+        << std::chrono::duration_cast<std::chrono::microseconds>(batchTime).count() << " us" << std::endl;
+}
@@ -0,0 +1,205 @@
+#include "RedisClient.h"
+#include "AsicView.h"
+
+#include "sairediscommon.h"
+
+#include "swss/redispipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace syncd;
+
+static void populateTempView(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ size_t routes)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisPipeline pipeline(db.get());
+
+    swss::Table table(&pipeline, TEMP_PREFIX ASIC_STATE_TABLE, true);
+
+    table.set("SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000", {
+            { "SAI_SWITCH_ATTR_INIT_SWITCH", "true" },
+            { "SAI_SWITCH_ATTR_SRC_MAC_ADDRESS", "00:01:02:03:04:05" } });
+
+    table.set("SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022", {
+            { "NULL", "NULL" } });
+
+    char buffer[256];
+
+    for (size_t idx = 0; idx < routes; idx++)
+    {
+        snprintf(buffer, sizeof(buffer),
+                "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"%zu.%zu.%zu.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}",
+                (idx >> 16) & 0xff,
+                (idx >> 8) & 0xff,
+                idx & 0xff);
+
+        table.set(buffer, {
+                { "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP" } });
+    }
+
+    table.flush();
+}
+
+TEST(RedisClient, scanTempAsicView)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    auto client = std::make_shared<RedisClient>(db);
+
+    client->removeTempAsicStateTable();
+
+    populateTempView(db, 100);
+
+    std::map<std::string, swss::TableMap> objects;
+
+    // small page forces multiple SCAN iterations
+
+    size_t count = client->scanTempAsicView([&](const std::string& key, const swss::TableMap& map)
+            {
+                EXPECT_EQ(objects.find(key), objects.end());
+
+                objects[key] = map;
+            }, 10);
+
+    EXPECT_EQ(count, 102u);
+    EXPECT_EQ(objects.size(), 102u);
+
+    auto& sw = objects.at("SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000");
+
+    EXPECT_EQ(sw.size(), 2u);
+    EXPECT_EQ(sw.at("SAI_SWITCH_ATTR_INIT_SWITCH"), "true");
+
+    // NULL placeholder attribute is skipped
+
+    EXPECT_EQ(objects.at("SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022").size(), 0u);
+
+    // streamed objects build same view
+
+    AsicView view;
+
+    for (auto& kvp: objects)
+    {
+        view.insertObject(kvp.first, kvp.second);
+    }
+
+    view.checkSwitchCount();
+
+    EXPECT_EQ(view.m_soRoutes.size(), 100u);
+
+    auto map = client->getTempAsicView();
+
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.at(0x21000000000000).size(), 102u);
+
+    client->removeTempAsicStateTable();
+
+    EXPECT_EQ(client->scanTempAsicView([](const std::string& key, const swss::TableMap& map) {}), 0u);
+}
+
+static uint64_t getAsicStateGeneration(
+        _In_ std::shared_ptr<swss::DBConnector> db)
+{
+    SWSS_LOG_ENTER();
+
+    auto value = db->get(REDIS_KEY_ASIC_STATE_GENERATION);
+
+    return value ? std::stoull(*value) : 0;
+}
+
+TEST(RedisClient, asicStateGeneration)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    auto client = std::make_shared<RedisClient>(db);
+
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+    metaKey.objectkey.key.object_id = 0x3000000000123;
+
+    auto generation = getAsicStateGeneration(db);
+
+    // temporary view writes don't change ASIC state
+
+    client->createTempAsicObject(metaKey, {});
+    client->removeTempAsicObject(metaKey);
+
+    EXPECT_EQ(getAsicStateGeneration(db), generation);
+
+    client->createAsicObject(metaKey, {
+            { "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "false" },
+            { "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V6_STATE", "true" } });
+
+    EXPECT_EQ(getAsicStateGeneration(db), generation + 1);
+
+    auto attrs = client->getAttributesFromAsicKey(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000123");
+
+    EXPECT_EQ(attrs.size(), 2u);
+    EXPECT_EQ(attrs["SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V6_STATE"], "true");
+
+    client->setAsicObject(metaKey, "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "true");
+
+    EXPECT_EQ(getAsicStateGeneration(db), generation + 2);
+
+    client->removeAsicObject(metaKey);
+
+    EXPECT_EQ(getAsicStateGeneration(db), generation + 3);
+
+    client->createAsicObjects({{ "SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000123", {} }});
+    client->removeAsicObjects({ "SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000123" });
+
+    EXPECT_EQ(getAsicStateGeneration(db), generation + 5);
+}
+
+TEST(RedisClient, scanTempAsicViewBenchmark)
+{
+    size_t routes = 100000;
+
+    const char* env = getenv("ASIC_VIEW_BENCHMARK_ROUTES");
+
+    if (env)
+    {
+        routes = std::stoul(env);
+    }
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    auto client = std::make_shared<RedisClient>(db);
+
+    client->removeTempAsicStateTable();
+
+    populateTempView(db, routes);
+
+    auto start = std::chrono::steady_clock::now();
+
+    AsicView view;
+
+    size_t count = client->scanTempAsicView([&](const std::string& key, const swss::TableMap& map)
+            {
+                view.insertObject(key, map);
+            });
+
+    auto end = std::chrono::steady_clock::now();
+
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::cout << "loaded " << count << " objects in "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+        << " ms, peak RSS " << usage.ru_maxrss << " KB" << std::endl;
+
+    EXPECT_EQ(count, routes + 2);
+    EXPECT_EQ(view.m_soRoutes.size(), routes);
+
+    client->removeTempAsicStateTable();
+}
@@ -0,0 +1,93 @@
+#include "StatsCapabilityCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+
+using namespace syncd;
+
+static const char* CACHE_FILE = "/tmp/TestStatsCapabilityCache.json";
+
+TEST(StatsCapabilityCache, platform)
+{
+    std::remove(CACHE_FILE);
+
+    auto cache = std::make_shared<StatsCapabilityCache>(CACHE_FILE);
+
+    std::set<uint32_t> counters;
+    bool supported;
+
+    // nothing is cached until platform is known
+
+    cache->setCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, {1, 2});
+
+    EXPECT_FALSE(cache->hasPlatform());
+    EXPECT_FALSE(cache->getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, counters));
+
+    cache->setPlatform("A");
+
+    EXPECT_TRUE(cache->hasPlatform());
+
+    cache->setCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, {1, 2});
+    cache->setCounterSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, 3, false);
+    cache->setBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, {1, 2}, true);
+
+    EXPECT_TRUE(cache->getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, counters));
+    EXPECT_EQ(counters, std::set<uint32_t>({1, 2}));
+    EXPECT_FALSE(cache->getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ_AND_CLEAR, counters));
+
+    cache->save();
+
+    // reload on same platform
+
+    cache = std::make_shared<StatsCapabilityCache>(CACHE_FILE);
+
+    cache->setPlatform("A");
+
+    EXPECT_TRUE(cache->getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, counters));
+    EXPECT_EQ(counters, std::set<uint32_t>({1, 2}));
+
+    EXPECT_TRUE(cache->getCounterSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, 3, supported));
+    EXPECT_FALSE(supported);
+    EXPECT_FALSE(cache->getCounterSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, 4, supported));
+
+    EXPECT_TRUE(cache->getBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, {1, 2}, supported));
+    EXPECT_TRUE(supported);
+    EXPECT_FALSE(cache->getBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, {1}, supported));
+
+    // platform change invalidates cache
+
+    cache = std::make_shared<StatsCapabilityCache>(CACHE_FILE);
+
+    cache->setPlatform("B");
+
+    EXPECT_FALSE(cache->getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, counters));
+    EXPECT_FALSE(cache->getBulkSupport(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_BULK_READ, {1, 2}, supported));
+
+    cache = nullptr;
+
+    std::remove(CACHE_FILE);
+}
+
+TEST(StatsCapabilityCache, corruptedFile)
+{
+    FILE* f = fopen(CACHE_FILE, "w");
+
+    ASSERT_NE(f, nullptr);
+
+    fputs("{ not json", f);
+    fclose(f);
+
+    {
+        StatsCapabilityCache cache(CACHE_FILE);
+
+        cache.setPlatform("A");
+
+        std::set<uint32_t> counters;
+
+        EXPECT_FALSE(cache.getCapability(SAI_OBJECT_TYPE_PORT, SAI_STATS_MODE_READ, counters));
+    }
+
+    std::remove(CACHE_FILE);
+}
@@ -0,0 +1,89 @@
+#include "StringPool.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace syncd;
+
+TEST(StringPool, intern)
+{
+    auto& pool = StringPool::getInstance();
+
+    size_t size = pool.size();
+
+    {
+        InternedString a("TestStringPool::foo");
+        InternedString b(std::string("TestStringPool::foo"));
+        InternedString c("TestStringPool::bar");
+
+        EXPECT_EQ(pool.size(), size + 2);
+
+        EXPECT_EQ(a, b);
+        EXPECT_NE(a, c);
+
+        // same storage is shared
+
+        EXPECT_EQ(&a.str(), &b.str());
+
+        EXPECT_EQ(a.str(), "TestStringPool::foo");
+        EXPECT_STREQ(c.c_str(), "TestStringPool::bar");
+        EXPECT_EQ(c.size(), 19u);
+
+        const std::string& ref = a;
+
+        EXPECT_EQ(ref, "TestStringPool::foo");
+
+        InternedString d(a);
+        InternedString e(std::move(d));
+
+        EXPECT_EQ(e, a);
+        EXPECT_EQ(d.str(), "");
+
+        c = a;
+
+        EXPECT_EQ(pool.size(), size + 1);
+
+        c = InternedString("TestStringPool::baz");
+
+        EXPECT_EQ(pool.size(), size + 2);
+    }
+
+    // strings are released with last reference
+
+    EXPECT_EQ(pool.size(), size);
+
+    InternedString empty;
+
+    EXPECT_EQ(empty.str(), "");
+    EXPECT_EQ(empty, InternedString());
+}
+
+TEST(StringPool, concurrent)
+{
+    auto& pool = StringPool::getInstance();
+
+    size_t size = pool.size();
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([]() {
+                for (int i = 0; i < 10000; i++)
+                {
+                    InternedString s("TestStringPool::" + std::to_string(i % 100));
+
+                    InternedString copy = s;
+                }
+        });
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(pool.size(), size);
+}
@@ -1,4 +1,5 @@
 #include "Syncd.h"
+#include "BulkAttributeDecoder.h"
 #include "sai_serialize.h"
 #include "RequestShutdown.h"
 #include "vslib/ContextConfigContainer.h"
@@ -20,6 +21,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <arpa/inet.h>
+
+#include <chrono>
+
 using namespace syncd;
 using namespace saivs;
 using namespace testing;
@@ -677,4 +682,103 @@ TEST_F(SyncdTest, BulkRemoveTest)
 
     m_syncd->processEvent(*channel);
 }
+
+TEST_F(SyncdTest, BulkRouteCreateBenchmark)
+{
+    // number of routes can be changed, for example SYNCD_BULK_BENCHMARK_ROUTES=1000000,
+    // default is small, but big enough to be decoded by 2 threads
+
+    size_t routes = 2 * BulkAttributeDecoder::PARALLEL_MIN_OBJECTS;
+
+    const char* env = getenv("SYNCD_BULK_BENCHMARK_ROUTES");
+
+    if (env)
+    {
+        routes = (size_t)strtoull(env, nullptr, 10);
+    }
+
+    m_opt->m_enableSaiBulkSupport = true;
+
+    // per object statuses are sent in response only in synchronous mode
+
+    auto response = std::make_shared<MockSelectableChannel>();
+
+    m_syncd->m_enableSyncMode = true;
+    m_syncd->m_selectableChannel = response;
+
+    sai_object_id_t switchVid = 0x21000000000000;
+    sai_object_id_t vrVid = 0x3000000000022;
+    sai_object_id_t nhVid = 0x4000000000100;
+
+    auto translator = m_syncd->m_translator;
+    translator->insertRidAndVid(0x11000000000001, switchVid);
+    translator->insertRidAndVid(0x11000000000002, vrVid);
+    translator->insertRidAndVid(0x11000000000003, nhVid);
+
+    std::string attrs = "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_FORWARD|SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID="
+        + sai_serialize_object_id(nhVid);
+
+    size_t pass = 0;
+
+    for (uint32_t threads: {1, 4})
+    {
+        m_opt->m_bulkDecodeThreads = threads;
+
+        // each pass creates new routes, so SAI create path is measured
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.reserve(routes);
+
+        for (size_t idx = 0; idx < routes; idx++)
+        {
+            sai_route_entry_t re;
+
+            memset(&re, 0, sizeof(re));
+
+            re.switch_id = switchVid;
+            re.vr_id = vrVid;
+            re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            re.destination.addr.ip4 = htonl((uint32_t)(0x0a000000 + ((pass * routes + idx) << 8)));
+            re.destination.mask.ip4 = htonl(0xffffff00);
+
+            values.emplace_back(sai_serialize_route_entry(re), attrs);
+        }
+
+        pass++;
+
+        auto kco = std::make_tuple("SAI_OBJECT_TYPE_ROUTE_ENTRY:bulk:" + std::to_string(routes), std::string("bulkcreate"), values);
+
+        std::vector<swss::FieldValueTuple> statuses;
+
+        EXPECT_CALL(*response, set(sai_serialize_status(SAI_STATUS_SUCCESS), testing::_, REDIS_ASIC_STATE_COMMAND_GETRESPONSE))
+            .WillOnce(testing::SaveArg<1>(&statuses));
+
+        MockSelectableChannel channel;
+
+        EXPECT_CALL(channel, empty())
+            .WillOnce(testing::Return(false))
+            .WillRepeatedly(testing::Return(true));
+        EXPECT_CALL(channel, pop(testing::_, testing::_))
+            .WillOnce(testing::SetArgReferee<0>(kco));
+
+        auto start = std::chrono::steady_clock::now();
+
+        m_syncd->processEvent(channel);
+
+        auto end = std::chrono::steady_clock::now();
+
+        testing::Mock::VerifyAndClearExpectations(response.get());
+
+        ASSERT_EQ(statuses.size(), routes);
+
+        for (auto& fvt: statuses)
+        {
+            EXPECT_EQ(fvField(fvt), sai_serialize_status(SAI_STATUS_SUCCESS));
+        }
+
+        std::cout << "[ BENCH    ] bulk create of " << routes << " routes, decode threads " << threads << ": "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    }
+}
 #endif
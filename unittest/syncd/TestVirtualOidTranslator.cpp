@@ -160,3 +160,142 @@ TEST(VirtualOidTranslator, tryTranslateVidToRid)
 
     sai->apiUninitialize();
 }
+
+TEST(VirtualOidTranslator, translateVidsToRids)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    VirtualOidTranslator vot(client, nullptr, nullptr);
+
+    vot.insertRidAndVid(0x2100000000, 0x21000000000000);
+    vot.insertRidAndVid(0x300000001, 0x3000000000001);
+
+    // virtual router will be fetched from redis
+
+    vot.clearLocalCache();
+
+    vot.insertRidAndVid(0x2100000000, 0x21000000000000);
+
+    std::vector<sai_route_entry_t> entries(3);
+
+    std::vector<sai_object_id_t*> oids;
+
+    for (auto& entry: entries)
+    {
+        entry.switch_id = 0x21000000000000;
+        entry.vr_id = 0x3000000000001;
+
+        oids.push_back(&entry.switch_id);
+        oids.push_back(&entry.vr_id);
+    }
+
+    entries[2].vr_id = SAI_NULL_OBJECT_ID;
+
+    vot.translateVidsToRids(oids.size(), oids.data());
+
+    for (auto& entry: entries)
+    {
+        EXPECT_EQ(entry.switch_id, 0x2100000000);
+    }
+
+    EXPECT_EQ(entries[0].vr_id, 0x300000001);
+    EXPECT_EQ(entries[1].vr_id, 0x300000001);
+    EXPECT_EQ(entries[2].vr_id, SAI_NULL_OBJECT_ID);
+
+    sai_object_id_t rid;
+
+    EXPECT_TRUE(vot.tryTranslateVidToRid(0x3000000000001, rid));
+
+    EXPECT_EQ(rid, 0x300000001);
+
+    // unknown VID
+
+    sai_object_id_t vid = 0x21;
+
+    sai_object_id_t* pvid = &vid;
+
+    EXPECT_THROW(vot.translateVidsToRids(1, &pvid), std::runtime_error);
+
+    vot.eraseRidAndVid(0x2100000000, 0x21000000000000);
+    vot.eraseRidAndVid(0x300000001, 0x3000000000001);
+}
+
+TEST(VirtualOidTranslator, translateObjectList)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    VirtualOidTranslator vot(client, nullptr, nullptr);
+
+    vot.insertRidAndVid(0x100000001, 0x1000000000001);
+    vot.insertRidAndVid(0x100000002, 0x1000000000002);
+
+    // second port will be fetched from redis
+
+    vot.clearLocalCache();
+
+    vot.insertRidAndVid(0x100000001, 0x1000000000001);
+
+    std::vector<sai_object_id_t> list = { 0x1000000000001, SAI_NULL_OBJECT_ID, 0x1000000000002, 0x1000000000002 };
+
+    sai_object_list_t objlist;
+
+    objlist.count = (uint32_t)list.size();
+    objlist.list = list.data();
+
+    vot.translateVidToRid(objlist);
+
+    EXPECT_EQ(list, std::vector<sai_object_id_t>({ 0x100000001, SAI_NULL_OBJECT_ID, 0x100000002, 0x100000002 }));
+
+    // all RIDs are known in local cache or redis, so no VID is allocated
+
+    vot.translateRidToVid(objlist, 0x21000000000000);
+
+    EXPECT_EQ(list, std::vector<sai_object_id_t>({ 0x1000000000001, SAI_NULL_OBJECT_ID, 0x1000000000002, 0x1000000000002 }));
+
+    // unknown VID, list is not modified
+
+    list[1] = 0x21;
+
+    EXPECT_THROW(vot.translateVidToRid(objlist), std::runtime_error);
+
+    EXPECT_EQ(list[0], 0x1000000000001);
+
+    vot.eraseRidAndVid(0x100000001, 0x1000000000001);
+    vot.eraseRidAndVid(0x100000002, 0x1000000000002);
+}
+
+TEST(VirtualOidTranslator, translateObjectListWithoutMissingVids)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    VirtualOidTranslator vot(client, nullptr, nullptr);
+
+    vot.insertRidAndVid(0x100000001, 0x1000000000001);
+
+    // null VIDs are misses of local cache, but nothing is fetched from redis
+
+    std::vector<sai_object_id_t> list = { SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID };
+
+    sai_object_list_t objlist;
+
+    objlist.count = (uint32_t)list.size();
+    objlist.list = list.data();
+
+    EXPECT_NO_THROW(vot.translateVidToRid(objlist));
+
+    EXPECT_EQ(list, std::vector<sai_object_id_t>({ SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID }));
+
+    list = { 0x1000000000001, SAI_NULL_OBJECT_ID, 0x1000000000001 };
+
+    objlist.count = (uint32_t)list.size();
+    objlist.list = list.data();
+
+    EXPECT_NO_THROW(vot.translateVidToRid(objlist));
+
+    EXPECT_EQ(list, std::vector<sai_object_id_t>({ 0x100000001, SAI_NULL_OBJECT_ID, 0x100000001 }));
+
+    vot.eraseRidAndVid(0x100000001, 0x1000000000001);
+}
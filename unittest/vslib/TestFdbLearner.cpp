@@ -0,0 +1,236 @@
+#include "FdbLearner.h"
+#include "MpscQueue.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace saivs;
+
+static void buildFrame(
+        _Out_ uint8_t* frame,
+        _In_ uint8_t mac,
+        _In_ bool tagged,
+        _In_ uint16_t vlanId)
+{
+    SWSS_LOG_ENTER();
+
+    memset(frame, 0, 64);
+
+    frame[ETH_ALEN + 5] = mac; // source mac
+
+    uint16_t* proto = (uint16_t*)(frame + 2 * ETH_ALEN);
+
+    proto[0] = htons(tagged ? ETH_P_8021Q : ETH_P_IP);
+    proto[1] = htons(vlanId);
+}
+
+TEST(MpscQueue, multipleProducers)
+{
+    MpscQueue<int> queue;
+
+    int value = 0;
+
+    EXPECT_FALSE(queue.pop(value));
+
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < 4; t++)
+    {
+        producers.emplace_back([&queue, t]() {
+                for (int i = 0; i < 10000; i++)
+                {
+                    queue.push(t * 10000 + i);
+                }
+        });
+    }
+
+    for (auto& t: producers)
+    {
+        t.join();
+    }
+
+    std::vector<int> last(4, -1);
+
+    int count = 0;
+
+    while (queue.pop(value))
+    {
+        // order per producer is preserved
+
+        EXPECT_GT(value % 10000, last[value / 10000]);
+
+        last[value / 10000] = value % 10000;
+
+        count++;
+    }
+
+    EXPECT_EQ(count, 40000);
+
+    queue.push(1); // not consumed items are released by destructor
+}
+
+TEST(FdbLearner, parseFrame)
+{
+    uint8_t frame[64];
+
+    FdbLearnEvent event;
+
+    buildFrame(frame, 0x11, false, 0);
+
+    EXPECT_TRUE(FdbLearner::parseFrame(frame, sizeof(frame), event));
+    EXPECT_FALSE(event.tagged);
+    EXPECT_EQ(event.mac[5], 0x11);
+
+    buildFrame(frame, 0x11, true, 100);
+
+    EXPECT_TRUE(FdbLearner::parseFrame(frame, sizeof(frame), event));
+    EXPECT_TRUE(event.tagged);
+    EXPECT_EQ(event.vlanId, 100);
+
+    // priority tagged frame is treated as untagged
+
+    buildFrame(frame, 0x11, true, 0);
+
+    EXPECT_TRUE(FdbLearner::parseFrame(frame, sizeof(frame), event));
+    EXPECT_FALSE(event.tagged);
+
+    buildFrame(frame, 0x11, true, 0xfff);
+
+    EXPECT_FALSE(FdbLearner::parseFrame(frame, sizeof(frame), event));
+
+    EXPECT_FALSE(FdbLearner::parseFrame(frame, sizeof(ethhdr), event));
+}
+
+TEST(FdbLearner, batch)
+{
+    std::mutex mutex;
+
+    std::vector<std::vector<FdbLearnEvent>> batches;
+
+    EXPECT_THROW(FdbLearner(nullptr), std::runtime_error);
+
+    FdbLearner learner([&](const std::vector<FdbLearnEvent>& events) {
+            std::lock_guard<std::mutex> lock(mutex);
+            batches.push_back(events);
+    });
+
+    uint8_t frame[64];
+
+    buildFrame(frame, 0x22, true, 0xfff);
+
+    EXPECT_FALSE(learner.enqueue(1, frame, sizeof(frame)));
+
+    // enqueue before start, so all events end up in single batch, which
+    // is limited by MAX_BATCH_SIZE
+
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < 4; t++)
+    {
+        producers.emplace_back([&learner]() {
+                uint8_t f[64];
+
+                for (int i = 0; i < 200; i++)
+                {
+                    buildFrame(f, (uint8_t)(i % 8), true, 10);
+
+                    learner.enqueue(1, f, sizeof(f));
+                }
+        });
+    }
+
+    for (auto& t: producers)
+    {
+        t.join();
+    }
+
+    // same mac on other vlan and untagged on other ports are not duplicates
+
+    buildFrame(frame, 0, true, 20);
+    EXPECT_TRUE(learner.enqueue(1, frame, sizeof(frame)));
+
+    buildFrame(frame, 0, false, 0);
+    EXPECT_TRUE(learner.enqueue(2, frame, sizeof(frame)));
+    EXPECT_TRUE(learner.enqueue(3, frame, sizeof(frame)));
+    EXPECT_TRUE(learner.enqueue(2, frame, sizeof(frame)));
+
+    // mac move between ports in same vlan keeps last port
+
+    buildFrame(frame, 0x33, true, 30);
+    EXPECT_TRUE(learner.enqueue(4, frame, sizeof(frame)));
+    EXPECT_TRUE(learner.enqueue(5, frame, sizeof(frame)));
+
+    learner.start();
+    learner.start();
+
+    for (int i = 0; i < 200; i++)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (batches.size())
+        {
+            break;
+        }
+
+        usleep(10*1000);
+    }
+
+    learner.stop();
+    learner.stop();
+
+    ASSERT_EQ(batches.size(), 1u);
+
+    auto& batch = batches[0];
+
+    ASSERT_EQ(batch.size(), 8u + 1u + 2u + 1u);
+
+    std::set<uint8_t> macs;
+
+    for (size_t idx = 0; idx < 8; idx++)
+    {
+        EXPECT_EQ(batch[idx].vlanId, 10);
+
+        macs.insert(batch[idx].mac[5]);
+    }
+
+    EXPECT_EQ(macs.size(), 8u);
+
+    EXPECT_EQ(batch[8].vlanId, 20);
+
+    // latest event is kept, in order it was received
+
+    EXPECT_EQ(batch[9].portId, 3u);
+    EXPECT_EQ(batch[10].portId, 2u);
+
+    EXPECT_EQ(batch[11].portId, 5u);
+
+    EXPECT_EQ(learner.getDroppedCount(), 0u);
+}
+
+TEST(FdbLearner, maxPendingEvents)
+{
+    FdbLearner learner([](const std::vector<FdbLearnEvent>& events) {});
+
+    uint8_t frame[64];
+
+    buildFrame(frame, 0x44, false, 0);
+
+    for (size_t i = 0; i < FdbLearner::MAX_PENDING_EVENTS; i++)
+    {
+        learner.enqueue(1, frame, sizeof(frame));
+    }
+
+    EXPECT_FALSE(learner.enqueue(1, frame, sizeof(frame)));
+
+    EXPECT_EQ(learner.getDroppedCount(), 1u);
+}
@@ -72,6 +72,35 @@ TEST(MACsecManager, update_macsec_sa_pn)
     manager.update_macsec_sa_pn(attr, 2);
 }
 
+TEST(MACsecManager, batch_macsec_sa)
+{
+    // This is a system call that may not be valid in the test environment,
+    // So, this case is just for the testing coverage checking.
+
+    MACsecManager manager;
+
+    MACsecAttr attr;
+    attr.m_vethName = "eth0";
+    attr.m_macsecName = "macsec_eth0";
+    attr.m_sci = "0242ac1100030001";
+    attr.m_an = 0;
+    attr.m_pn = 1;
+    attr.m_cipher = MACsecAttr::CIPHER_NAME_GCM_AES_128;
+    attr.m_authKey = "";
+    attr.m_sak = "";
+    attr.m_direction = SAI_MACSEC_DIRECTION_EGRESS;
+
+    std::vector<MACsecAttr> attrs{ attr, attr };
+
+    attrs[1].m_direction = SAI_MACSEC_DIRECTION_INGRESS;
+
+    std::vector<bool> results;
+
+    manager.create_macsec_sa(attrs, results);
+
+    EXPECT_EQ(results.size(), attrs.size());
+}
+
 class MockMACsecManager_CleanupMACsecDevice : public MACsecManager
 {
 public:
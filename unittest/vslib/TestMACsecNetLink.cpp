@@ -0,0 +1,192 @@
+#include "MACsecNetLink.h"
+
+#include <swss/logger.h>
+
+#include <gtest/gtest.h>
+
+#include <linux/if_macsec.h>
+#include <net/if.h>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+using namespace saivs;
+
+#define NETNS_UNSUPPORTED (77)
+
+TEST(MACsecNetLink, parseHex)
+{
+    std::vector<std::uint8_t> bytes;
+
+    EXPECT_TRUE(MACsecNetLink::parseHex("00ff10", bytes));
+
+    EXPECT_EQ(bytes, std::vector<std::uint8_t>({ 0x00, 0xff, 0x10 }));
+
+    EXPECT_FALSE(MACsecNetLink::parseHex("0", bytes));
+
+    EXPECT_FALSE(MACsecNetLink::parseHex("zz", bytes));
+}
+
+TEST(MACsecNetLink, parseSci)
+{
+    std::uint64_t sci;
+
+    EXPECT_TRUE(MACsecNetLink::parseSci("fe5400bd9b360001", sci));
+
+    auto bytes = reinterpret_cast<const std::uint8_t*>(&sci);
+
+    EXPECT_EQ(bytes[0], 0xfe);
+    EXPECT_EQ(bytes[7], 0x01);
+
+    EXPECT_FALSE(MACsecNetLink::parseSci("fe54", sci));
+}
+
+TEST(MACsecNetLink, execute)
+{
+    // This is a system call that may not be valid in the test environment,
+    // So, this case is just for the testing coverage checking.
+
+    MACsecNetLink netlink;
+
+    MACsecNetLinkRequest request;
+
+    request.m_cmd = MACSEC_CMD_UPD_TXSA;
+    request.m_ifindex = 0xffffff;
+    request.m_setPn = true;
+    request.m_pn = 2;
+
+    EXPECT_FALSE(netlink.execute(request));
+
+    std::map<std::uint32_t, MACsecSecYState> states;
+
+    netlink.dump(states);
+}
+
+static int netns_macsec_test()
+{
+    SWSS_LOG_ENTER();
+
+    if (unshare(CLONE_NEWNET) != 0 ||
+            system("ip link add veth_ms0 type veth peer name veth_ms1 > /dev/null 2>&1") != 0 ||
+            system("ip link set veth_ms0 up > /dev/null 2>&1") != 0)
+    {
+        return NETNS_UNSUPPORTED;
+    }
+
+    // probe macsec driver with ip command, so failures of netlink control
+    // plane below are reported as test failures
+
+    if (system("ip link add link veth_ms0 name macsec_probe type macsec > /dev/null 2>&1") != 0)
+    {
+        return NETNS_UNSUPPORTED;
+    }
+
+    if (system("ip link del macsec_probe > /dev/null 2>&1") != 0)
+    {
+        return 5;
+    }
+
+    MACsecNetLink netlink;
+
+    std::uint64_t sci;
+    std::uint64_t peerSci;
+
+    MACsecNetLink::parseSci("fe5400bd9b360001", sci);
+    MACsecNetLink::parseSci("5254001234560001", peerSci);
+
+    if (!netlink.createSecY(if_nametoindex("veth_ms0"), "macsec_ms0", sci, MACSEC_CIPHER_ID_GCM_AES_128, true, true))
+    {
+        return 6;
+    }
+
+    auto ifindex = if_nametoindex("macsec_ms0");
+
+    MACsecNetLinkRequest rxsc;
+
+    rxsc.m_cmd = MACSEC_CMD_ADD_RXSC;
+    rxsc.m_ifindex = ifindex;
+    rxsc.m_sci = peerSci;
+    rxsc.m_setActive = true;
+    rxsc.m_active = true;
+
+    MACsecNetLinkRequest txsa;
+
+    txsa.m_cmd = MACSEC_CMD_ADD_TXSA;
+    txsa.m_ifindex = ifindex;
+    txsa.m_an = 1;
+    txsa.m_setActive = true;
+    txsa.m_active = true;
+    txsa.m_setPn = true;
+    txsa.m_pn = 10;
+    txsa.m_key.assign(16, 0xab);
+    txsa.m_keyId.assign(MACSEC_KEYID_LEN, 0x01);
+
+    MACsecNetLinkRequest rxsa = txsa;
+
+    rxsa.m_cmd = MACSEC_CMD_ADD_RXSA;
+    rxsa.m_sci = peerSci;
+    rxsa.m_pn = 20;
+
+    std::vector<bool> results;
+
+    if (!netlink.execute({ rxsc, txsa, rxsa }, results) || !netlink.setEncodingSa(ifindex, 1))
+    {
+        return 1;
+    }
+
+    // packet number update
+
+    txsa.m_cmd = MACSEC_CMD_UPD_TXSA;
+    txsa.m_pn = 100;
+    txsa.m_key.clear();
+    txsa.m_keyId.clear();
+
+    if (!netlink.execute({ txsa }, results))
+    {
+        return 2;
+    }
+
+    MACsecSecYState state;
+
+    if (!netlink.dump(ifindex, state) ||
+            state.m_encodingSa != 1 ||
+            state.m_txSas[1].m_pn != 100 ||
+            state.m_rxScs[peerSci].m_sas[1].m_pn != 20)
+    {
+        return 3;
+    }
+
+    return netlink.deleteSecY("macsec_ms0") ? 0 : 4;
+}
+
+TEST(MACsecNetLink, namespace)
+{
+    // Validates netlink control plane against in-kernel macsec driver in a
+    // private network namespace, skipped when namespace, veth or macsec
+    // is not available in the test environment.
+
+    pid_t pid = fork();
+
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        _exit(netns_macsec_test());
+    }
+
+    int status = 0;
+
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+
+    ASSERT_TRUE(WIFEXITED(status));
+
+    if (WEXITSTATUS(status) == NETNS_UNSUPPORTED)
+    {
+        SWSS_LOG_NOTICE("network namespace with macsec is not supported, skipping");
+        return;
+    }
+
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
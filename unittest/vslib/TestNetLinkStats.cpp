@@ -0,0 +1,25 @@
+#include "NetLinkStats.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+TEST(NetLinkStats, refresh)
+{
+    NetLinkStats stats;
+
+    EXPECT_TRUE(stats.refresh());
+}
+
+TEST(NetLinkStats, getStat)
+{
+    NetLinkStats stats;
+
+    uint64_t counter;
+
+    EXPECT_TRUE(stats.getStat("lo", RTNL_LINK_RX_BYTES, counter));
+
+    EXPECT_FALSE(stats.getStat("non_existing_if", RTNL_LINK_RX_BYTES, counter));
+
+    EXPECT_EQ(counter, 0);
+}
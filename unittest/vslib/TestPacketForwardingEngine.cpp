@@ -0,0 +1,468 @@
+#include "PacketForwardingEngine.h"
+#include "HostInterfaceInfo.h"
+#include "NetLinkStats.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <linux/if_tun.h>
+#include <net/if.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+using namespace saivs;
+
+#define NETNS_UNSUPPORTED (77)
+
+class CountingHandler:
+    public PacketHandler
+{
+    public:
+
+        CountingHandler():
+            m_count(0)
+        {
+            SWSS_LOG_ENTER();
+        }
+
+        virtual bool onReadable(
+                _In_ int fd,
+                _In_ PacketBatch& batch) override
+        {
+            batch.prepareRecv();
+
+            int count = recvmmsg(fd, batch.m_msgs, PacketBatch::BATCH_SIZE, MSG_DONTWAIT, nullptr);
+
+            if (count > 0)
+            {
+                m_count += count;
+            }
+
+            return true;
+        }
+
+        std::atomic<int> m_count;
+};
+
+static bool waitFor(
+        _In_ std::function<bool()> condition)
+{
+    for (int i = 0; i < 200; i++)
+    {
+        if (condition())
+        {
+            return true;
+        }
+
+        usleep(10*1000);
+    }
+
+    return false;
+}
+
+TEST(PacketForwardingEngine, registerFd)
+{
+    PacketForwardingEngine engine(2);
+
+    EXPECT_EQ(engine.getWorkerCount(), 2u);
+
+    EXPECT_THROW(PacketForwardingEngine(0), std::runtime_error);
+
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    CountingHandler handler;
+
+    EXPECT_EQ(engine.registerFd(sv[0], nullptr), 0u);
+    EXPECT_EQ(engine.registerFd(-1, &handler), 0u);
+
+    auto index = engine.registerFd(sv[0], &handler);
+
+    EXPECT_NE(index, 0u);
+
+    unsigned char buffer[64] = { 0 };
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+    }
+
+    EXPECT_TRUE(waitFor([&]() { return handler.m_count == 100; }));
+
+    engine.unregisterFd(index);
+    engine.unregisterFd(index);
+    engine.unregisterFd(0);
+
+    EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+
+    usleep(50*1000);
+
+    EXPECT_EQ(handler.m_count, 100);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+class SlowHandler:
+    public PacketHandler
+{
+    public:
+
+        SlowHandler():
+            m_entered(false),
+            m_exited(false)
+        {
+            SWSS_LOG_ENTER();
+        }
+
+        virtual bool onReadable(
+                _In_ int fd,
+                _In_ PacketBatch& batch) override
+        {
+            m_entered = true;
+
+            usleep(200*1000);
+
+            batch.prepareRecv();
+
+            recvmmsg(fd, batch.m_msgs, PacketBatch::BATCH_SIZE, MSG_DONTWAIT, nullptr);
+
+            m_exited = true;
+
+            return true;
+        }
+
+        std::atomic<bool> m_entered;
+
+        std::atomic<bool> m_exited;
+};
+
+TEST(PacketForwardingEngine, unregisterFdDuringHandler)
+{
+    PacketForwardingEngine engine(1);
+
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    SlowHandler slow;
+    CountingHandler handler;
+
+    auto slowIndex = engine.registerFd(sv[0], &slow);
+
+    unsigned char buffer[64] = { 0 };
+
+    EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+
+    EXPECT_TRUE(waitFor([&]() { return slow.m_entered.load(); }));
+
+    // worker lock is not held by handler, so other fd can be registered
+
+    int other[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, other), 0);
+
+    auto index = engine.registerFd(other[0], &handler);
+
+    EXPECT_NE(index, 0u);
+
+    EXPECT_FALSE(slow.m_exited);
+
+    // unregister waits for handler in progress
+
+    engine.unregisterFd(slowIndex);
+
+    EXPECT_TRUE(slow.m_exited);
+
+    engine.unregisterFd(index);
+
+    close(sv[0]);
+    close(sv[1]);
+    close(other[0]);
+    close(other[1]);
+}
+
+TEST(PacketForwardingEngine, hostInterfaceInfo)
+{
+    auto engine = std::make_shared<PacketForwardingEngine>(1);
+
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    int veth[2];
+    int tap[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, veth), 0);
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, tap), 0);
+
+    {
+        HostInterfaceInfo hii(0, veth[0], tap[0], "tap", 0, eq);
+
+        hii.startForwarding(engine);
+        hii.startForwarding(engine);
+
+        unsigned char frame[100] = { 0 };
+        unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
+
+        // veth -> tap
+
+        EXPECT_EQ(write(veth[1], frame, sizeof(frame)), (ssize_t)sizeof(frame));
+
+        EXPECT_TRUE(waitFor([&]() { return recv(tap[1], buffer, sizeof(buffer), MSG_DONTWAIT) == (ssize_t)sizeof(frame); }));
+
+        // tap -> veth, in batch
+
+        for (int i = 0; i < 50; i++)
+        {
+            EXPECT_EQ(write(tap[1], frame, sizeof(frame)), (ssize_t)sizeof(frame));
+        }
+
+        int received = 0;
+
+        EXPECT_TRUE(waitFor([&]() {
+                    while (recv(veth[1], buffer, sizeof(buffer), MSG_DONTWAIT) == (ssize_t)sizeof(frame))
+                    {
+                        received++;
+                    }
+                    return received == 50; }));
+
+        // too short frame is dropped
+
+        EXPECT_EQ(write(veth[1], frame, 4), 4);
+
+        usleep(50*1000);
+
+        EXPECT_LT(recv(tap[1], buffer, sizeof(buffer), MSG_DONTWAIT), 0);
+    }
+
+    // tap[0] is closed by HostInterfaceInfo
+
+    close(veth[0]);
+    close(veth[1]);
+    close(tap[1]);
+}
+
+static int openTap(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    int fd = open("/dev/net/tun", O_RDWR);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    struct ifreq ifr;
+
+    memset(&ifr, 0, sizeof(ifr));
+
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+
+    strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+
+    if (ioctl(fd, TUNSETIFF, (void *)&ifr) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static int openPacketSocket(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    int s = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+
+    if (s < 0)
+    {
+        return -1;
+    }
+
+    int val = 1;
+
+    setsockopt(s, SOL_PACKET, PACKET_AUXDATA, &val, sizeof(val));
+
+    struct sockaddr_ll addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    addr.sll_family = PF_PACKET;
+    addr.sll_protocol = htons(ETH_P_ALL);
+    addr.sll_ifindex = (int)if_nametoindex(name.c_str());
+
+    if (addr.sll_ifindex == 0 || bind(s, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        close(s);
+        return -1;
+    }
+
+    return s;
+}
+
+static uint64_t readCounter(
+        _In_ const std::string& ifName)
+{
+    SWSS_LOG_ENTER();
+
+    // sysfs is still showing parent namespace, so netlink is used
+
+    NetLinkStats stats;
+
+    uint64_t value = 0;
+
+    stats.getStat(ifName, RTNL_LINK_RX_PACKETS, value);
+
+    return value;
+}
+
+static int netns_benchmark()
+{
+    SWSS_LOG_ENTER();
+
+    if (unshare(CLONE_NEWNET) != 0 ||
+            system("ip link add veth_pf0 type veth peer name veth_pf1 > /dev/null 2>&1") != 0 ||
+            system("ip link set veth_pf0 up && ip link set veth_pf1 up > /dev/null 2>&1") != 0)
+    {
+        return NETNS_UNSUPPORTED;
+    }
+
+    int tapfd = openTap("tap_pf0");
+
+    if (tapfd < 0 || system("ip link set tap_pf0 up > /dev/null 2>&1") != 0)
+    {
+        return NETNS_UNSUPPORTED;
+    }
+
+    int packetSocket = openPacketSocket("veth_pf0");
+    int sender = openPacketSocket("veth_pf1");
+
+    if (packetSocket < 0 || sender < 0)
+    {
+        return NETNS_UNSUPPORTED;
+    }
+
+    auto engine = std::make_shared<PacketForwardingEngine>();
+
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    auto hii = std::make_shared<HostInterfaceInfo>(
+            (int)if_nametoindex("veth_pf0"), packetSocket, tapfd, "tap_pf0", 0, eq);
+
+    hii->startForwarding(engine);
+
+    uint64_t base = readCounter("tap_pf0");
+
+    // 64 byte frames from veth peer, forwarded veth -> tap
+
+    const unsigned int total = 200000;
+
+    unsigned char frame[64];
+
+    memset(frame, 0, sizeof(frame));
+    memset(frame, 0xff, ETH_ALEN); // broadcast
+    frame[ETH_ALEN + 5] = 0x01;
+    frame[2 * ETH_ALEN] = 0x08; // IPv4 ethertype
+
+    struct mmsghdr msgs[PacketBatch::BATCH_SIZE];
+    struct iovec iov = { frame, sizeof(frame) };
+
+    memset(msgs, 0, sizeof(msgs));
+
+    for (auto& m: msgs)
+    {
+        m.msg_hdr.msg_iov = &iov;
+        m.msg_hdr.msg_iovlen = 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned int sent = 0;
+
+    while (sent < total)
+    {
+        int res = sendmmsg(sender, msgs, PacketBatch::BATCH_SIZE, 0);
+
+        if (res > 0)
+        {
+            sent += (unsigned int)res;
+        }
+    }
+
+    uint64_t received = 0;
+    uint64_t last = UINT64_MAX;
+
+    auto end = std::chrono::steady_clock::now();
+
+    // wait until forwarding settles
+
+    while ((received = readCounter("tap_pf0") - base) != last)
+    {
+        end = std::chrono::steady_clock::now();
+
+        last = received;
+
+        usleep(100*1000);
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "[ BENCH    ] veth -> tap forwarded " << received << "/" << sent
+        << " packets, " << (uint64_t)((double)received / seconds) << " pps" << std::endl;
+
+    hii = nullptr;
+
+    close(packetSocket);
+    close(sender);
+
+    return received > 0 ? 0 : 1;
+}
+
+TEST(PacketForwardingEngine, benchmark)
+{
+    // Measures packets per second forwarded from veth to tap in private
+    // network namespace, skipped when namespace, veth or tap is not
+    // available in the test environment.
+
+    pid_t pid = fork();
+
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        _exit(netns_benchmark());
+    }
+
+    int status = 0;
+
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+
+    ASSERT_TRUE(WIFEXITED(status));
+
+    if (WEXITSTATUS(status) == NETNS_UNSUPPORTED)
+    {
+        SWSS_LOG_NOTICE("network namespace with veth and tap is not supported, skipping");
+        return;
+    }
+
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
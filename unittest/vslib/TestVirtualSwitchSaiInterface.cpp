@@ -11,6 +11,8 @@ extern "C" {
 
 #include <gtest/gtest.h>
 
+#include "meta/sai_serialize.h"
+
 #include "ContextConfigContainer.h"
 #include "VirtualSwitchSaiInterface.h"
 
@@ -164,6 +166,67 @@ TEST_F(VirtualSwitchSaiInterfaceTest, bulkGet)
                 statuses.data()));
 }
 
+TEST_F(VirtualSwitchSaiInterfaceTest, bulkGetStatsNullSwitchId)
+{
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+    ASSERT_EQ(m_vssai->get(SAI_OBJECT_TYPE_SWITCH, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    std::vector<sai_object_id_t> ports(attr.value.u32);
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = (uint32_t)ports.size();
+    attr.value.objlist.list = ports.data();
+    ASSERT_EQ(m_vssai->get(SAI_OBJECT_TYPE_SWITCH, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+    ASSERT_EQ(m_vssai->get(SAI_OBJECT_TYPE_PORT, ports.at(0), 1, &attr), SAI_STATUS_SUCCESS);
+
+    std::vector<sai_object_id_t> queues(attr.value.u32);
+
+    attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+    attr.value.objlist.count = (uint32_t)queues.size();
+    attr.value.objlist.list = queues.data();
+    ASSERT_EQ(m_vssai->get(SAI_OBJECT_TYPE_PORT, ports.at(0), 1, &attr), SAI_STATUS_SUCCESS);
+
+    ASSERT_GE(queues.size(), 2u);
+
+    queues.resize(2);
+
+    auto& countersMap = m_vssai->m_switchStateMap.at(m_swid)->m_countersMap;
+
+    std::vector<sai_object_key_t> keys(queues.size());
+
+    for (size_t idx = 0; idx < queues.size(); idx++)
+    {
+        keys[idx].key.object_id = queues[idx];
+
+        countersMap[sai_serialize_object_id(queues[idx])][SAI_QUEUE_STAT_PACKETS] = 10 + idx;
+        countersMap[sai_serialize_object_id(queues[idx])][SAI_QUEUE_STAT_BYTES] = 20 + idx;
+    }
+
+    std::vector<sai_stat_id_t> counterIds = { SAI_QUEUE_STAT_PACKETS, SAI_QUEUE_STAT_BYTES };
+
+    std::vector<sai_status_t> statuses(queues.size(), SAI_STATUS_FAILURE);
+    std::vector<uint64_t> counters(queues.size() * counterIds.size());
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+            m_vssai->bulkGetStats(
+                SAI_NULL_OBJECT_ID,
+                SAI_OBJECT_TYPE_QUEUE,
+                (uint32_t)keys.size(),
+                keys.data(),
+                (uint32_t)counterIds.size(),
+                counterIds.data(),
+                SAI_STATS_MODE_BULK_READ,
+                statuses.data(),
+                counters.data()));
+
+    EXPECT_EQ(statuses, std::vector<sai_status_t>(queues.size(), SAI_STATUS_SUCCESS));
+    EXPECT_EQ(counters, std::vector<uint64_t>({ 10, 20, 11, 21 }));
+}
+
 TEST_F(VirtualSwitchSaiInterfaceTest, queryStatsCapability)
 {
     std::vector<sai_stat_capability_t> capability_list;
@@ -0,0 +1,136 @@
+#include "WarmBootSnapshot.h"
+#include "VirtualSwitchSaiInterface.h"
+#include "ContextConfigContainer.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+using namespace saivs;
+
+static const char* WARM_BOOT_TEXT_FILE = "files/mlnx2700.warm.bin";
+
+static std::map<sai_object_id_t, WarmBootState> loadTextState()
+{
+    SWSS_LOG_ENTER();
+
+    VirtualSwitchSaiInterface vs(ContextConfigContainer::getDefault()->get(0));
+
+    EXPECT_TRUE(vs.readWarmBootFile(WARM_BOOT_TEXT_FILE));
+
+    auto states = vs.m_warmBootState;
+
+    EXPECT_EQ(states.size(), 1);
+
+    for (auto& kvp: states)
+    {
+        FdbInfo fi;
+
+        fi.m_portId = 0x100000001;
+        fi.m_vlanId = 2;
+
+        kvp.second.m_fdbInfoSet.insert(fi);
+    }
+
+    return states;
+}
+
+TEST(WarmBootSnapshot, writeRead)
+{
+    auto states = loadTextState();
+
+    const char* fileName = "warm.snapshot.bin";
+
+    EXPECT_FALSE(WarmBootSnapshot::isSnapshot(WARM_BOOT_TEXT_FILE));
+
+    VirtualSwitchSaiInterface vs(ContextConfigContainer::getDefault()->get(0));
+
+    vs.m_warmBootData = states;
+
+    EXPECT_TRUE(vs.writeWarmBootFile(fileName));
+
+    EXPECT_TRUE(WarmBootSnapshot::isSnapshot(fileName));
+
+    VirtualSwitchSaiInterface vs2(ContextConfigContainer::getDefault()->get(0));
+
+    EXPECT_TRUE(vs2.readWarmBootFile(fileName));
+
+    ASSERT_EQ(vs2.m_warmBootState.size(), states.size());
+
+    for (auto& kvp: states)
+    {
+        auto& loaded = vs2.m_warmBootState.at(kvp.first);
+
+        EXPECT_EQ(loaded.m_switchId, kvp.first);
+        EXPECT_EQ(loaded.m_fdbInfoSet.size(), 1);
+        EXPECT_EQ(WarmBootSnapshot::toText(loaded), WarmBootSnapshot::toText(kvp.second));
+    }
+
+    // text format is still supported
+
+    EXPECT_TRUE(vs.writeWarmBootFile(fileName, true));
+
+    EXPECT_FALSE(WarmBootSnapshot::isSnapshot(fileName));
+
+    VirtualSwitchSaiInterface vs3(ContextConfigContainer::getDefault()->get(0));
+
+    EXPECT_TRUE(vs3.readWarmBootFile(fileName));
+
+    for (auto& kvp: states)
+    {
+        EXPECT_EQ(WarmBootSnapshot::toText(vs3.m_warmBootState.at(kvp.first)), WarmBootSnapshot::toText(kvp.second));
+    }
+}
+
+TEST(WarmBootSnapshot, corrupted)
+{
+    auto states = loadTextState();
+
+    const char* fileName = "warm.snapshot.corrupted.bin";
+
+    ASSERT_TRUE(WarmBootSnapshot::write(fileName, states));
+
+    std::string content;
+
+    {
+        std::ifstream ifs(fileName, std::ifstream::binary);
+
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    std::map<sai_object_id_t, WarmBootState> loaded;
+
+    // flipped byte in payload
+
+    auto corrupted = content;
+
+    corrupted[corrupted.size() - 1] ^= 0x1;
+
+    std::ofstream(fileName, std::ofstream::binary) << corrupted;
+
+    EXPECT_FALSE(WarmBootSnapshot::read(fileName, loaded));
+
+    // truncated file
+
+    std::ofstream(fileName, std::ofstream::binary) << content.substr(0, content.size() / 2);
+
+    EXPECT_FALSE(WarmBootSnapshot::read(fileName, loaded));
+
+    EXPECT_TRUE(loaded.empty());
+
+    // corrupted snapshot falls back to cold boot
+
+    VirtualSwitchSaiInterface vs(ContextConfigContainer::getDefault()->get(0));
+
+    EXPECT_FALSE(vs.readWarmBootFile(fileName));
+
+    std::ofstream(fileName, std::ofstream::binary) << content;
+
+    EXPECT_TRUE(WarmBootSnapshot::read(fileName, loaded));
+
+    EXPECT_EQ(loaded.size(), states.size());
+
+    EXPECT_FALSE(WarmBootSnapshot::read("not_existing_file", loaded));
+}
@@ -0,0 +1,289 @@
+#include "FdbLearner.h"
+
+#include "swss/logger.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+
+using namespace saivs;
+
+FdbLearner::FdbLearner(
+        _In_ BatchHandler handler):
+    m_handler(handler),
+    m_pending(0),
+    m_signaled(false),
+    m_dropped(0),
+    m_run(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (!handler)
+    {
+        SWSS_LOG_THROW("batch handler can't be empty");
+    }
+
+    m_eventfd = eventfd(0, EFD_CLOEXEC);
+
+    if (m_eventfd < 0)
+    {
+        SWSS_LOG_THROW("eventfd failed, errno(%d): %s", errno, strerror(errno));
+    }
+}
+
+FdbLearner::~FdbLearner()
+{
+    SWSS_LOG_ENTER();
+
+    stop();
+
+    close(m_eventfd);
+}
+
+bool FdbLearner::parseFrame(
+        _In_ const uint8_t* buffer,
+        _In_ size_t size,
+        _Out_ FdbLearnEvent& event)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&event, 0, sizeof(event));
+
+    /*
+     * We add +2 in case if frame contains 1Q VLAN tag.
+     */
+
+    if (size < (sizeof(ethhdr) + 2))
+    {
+        SWSS_LOG_WARN("ethernet frame is too small: %zu", size);
+        return false;
+    }
+
+    const ethhdr *eh = (const ethhdr*)buffer;
+
+    memcpy(event.mac, eh->h_source, sizeof(sai_mac_t));
+
+    uint16_t proto = htons(eh->h_proto);
+
+    event.tagged = (proto == ETH_P_8021Q);
+
+    if (event.tagged)
+    {
+        // this is tagged frame, get vlan id from frame
+
+        uint16_t tci = htons(((const uint16_t*)&eh->h_proto)[1]); // tag is after h_proto field
+
+        event.vlanId = tci & 0xfff;
+
+        if (event.vlanId == 0xfff)
+        {
+            SWSS_LOG_WARN("invalid vlan id %u in ethernet frame", event.vlanId);
+            return false;
+        }
+
+        if (event.vlanId == 0)
+        {
+            // priority packet, frame should be treated as non tagged
+            event.tagged = false;
+        }
+    }
+
+    return true;
+}
+
+bool FdbLearner::enqueue(
+        _In_ sai_object_id_t portId,
+        _In_ const uint8_t* buffer,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    FdbLearnEvent event;
+
+    if (!parseFrame(buffer, size, event))
+    {
+        return false;
+    }
+
+    event.portId = portId;
+    event.timestamp = (uint32_t)time(NULL);
+
+    if (m_pending.fetch_add(1) >= MAX_PENDING_EVENTS)
+    {
+        m_pending--;
+        m_dropped++;
+
+        return false;
+    }
+
+    m_queue.push(event);
+
+    notify();
+
+    return true;
+}
+
+void FdbLearner::notify()
+{
+    SWSS_LOG_ENTER();
+
+    // only first producer after learner woke up writes to eventfd
+
+    if (m_signaled.exchange(true))
+    {
+        return;
+    }
+
+    uint64_t val = 1;
+
+    if (write(m_eventfd, &val, sizeof(val)) < 0)
+    {
+        SWSS_LOG_ERROR("failed to notify fdb learner, errno(%d): %s", errno, strerror(errno));
+    }
+}
+
+void FdbLearner::start()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_run)
+    {
+        return;
+    }
+
+    m_run = true;
+
+    m_thread = std::make_shared<std::thread>(&FdbLearner::run, this);
+}
+
+void FdbLearner::stop()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_run)
+    {
+        return;
+    }
+
+    m_run = false;
+
+    uint64_t val = 1;
+
+    if (write(m_eventfd, &val, sizeof(val)) < 0)
+    {
+        SWSS_LOG_ERROR("failed to notify fdb learner, errno(%d): %s", errno, strerror(errno));
+    }
+
+    m_thread->join();
+
+    m_thread = nullptr;
+}
+
+uint64_t FdbLearner::getDroppedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_dropped;
+}
+
+size_t FdbLearner::dequeueBatch(
+        _Out_ std::vector<FdbLearnEvent>& batch)
+{
+    SWSS_LOG_ENTER();
+
+    batch.clear();
+
+    m_keys.clear();
+
+    std::vector<bool> superseded;
+
+    FdbLearnEvent event;
+
+    while (batch.size() < MAX_BATCH_SIZE && m_queue.pop(event))
+    {
+        m_pending--;
+
+        // untagged frame vlan depends on port vlan id, so port is part of
+        // the key, mac is in lower 48 bits
+
+        uint64_t key = 0;
+
+        for (size_t idx = 0; idx < sizeof(sai_mac_t); idx++)
+        {
+            key = (key << 8) | event.mac[idx];
+        }
+
+        key |= (uint64_t)(event.tagged ? event.vlanId : 0x1000) << 48;
+
+        auto k = std::make_pair(event.tagged ? SAI_NULL_OBJECT_ID : event.portId, key);
+
+        auto it = m_keys.find(k);
+
+        if (it != m_keys.end())
+        {
+            // keep latest event, so MAC move within batch ends on last port
+
+            superseded[it->second] = true;
+        }
+
+        m_keys[k] = batch.size();
+
+        batch.push_back(event);
+
+        superseded.push_back(false);
+    }
+
+    size_t count = 0;
+
+    for (size_t idx = 0; idx < batch.size(); idx++)
+    {
+        if (!superseded[idx])
+        {
+            batch[count++] = batch[idx];
+        }
+    }
+
+    batch.resize(count);
+
+    return count;
+}
+
+void FdbLearner::run()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    std::vector<FdbLearnEvent> batch;
+
+    while (m_run)
+    {
+        uint64_t val;
+
+        if (read(m_eventfd, &val, sizeof(val)) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SWSS_LOG_ERROR("eventfd read failed, errno(%d): %s, ending fdb learner", errno, strerror(errno));
+            break;
+        }
+
+        // reset before draining, so producer which pushes after drain
+        // started will wake us again
+
+        m_signaled = false;
+
+        while (m_run && dequeueBatch(batch))
+        {
+            m_handler(batch);
+        }
+    }
+
+    SWSS_LOG_NOTICE("end");
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "MpscQueue.h"
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief MAC learn event, parsed from ingress frame on packet worker.
+     */
+    struct FdbLearnEvent
+    {
+        sai_object_id_t portId;
+
+        sai_mac_t mac;
+
+        /**
+         * @brief Vlan id from 802.1Q tag, valid only when frame is tagged,
+         * for untagged frames port vlan id is used.
+         */
+        sai_vlan_id_t vlanId;
+
+        bool tagged;
+
+        uint32_t timestamp;
+    };
+
+    /**
+     * @brief FDB learner.
+     *
+     * Packet workers push learn events into lock free queue, dedicated
+     * learner thread drains queue, deduplicates events by (vlan, mac) and
+     * passes them in batches to handler, so switch state is locked once per
+     * batch instead of once per packet.
+     */
+    class FdbLearner
+    {
+        private:
+
+            FdbLearner(const FdbLearner&) = delete;
+            FdbLearner& operator=(const FdbLearner&) = delete;
+
+        public:
+
+            typedef std::function<void(const std::vector<FdbLearnEvent>&)> BatchHandler;
+
+            /**
+             * @brief Events above this limit are dropped, learning is best
+             * effort and MAC will be learned again from next frame.
+             */
+            static constexpr size_t MAX_PENDING_EVENTS = 64 * 1024;
+
+            static constexpr size_t MAX_BATCH_SIZE = 1024;
+
+        public:
+
+            FdbLearner(
+                    _In_ BatchHandler handler);
+
+            virtual ~FdbLearner();
+
+        public:
+
+            /**
+             * @brief Parse ethernet frame into learn event.
+             *
+             * @return False if frame is too short or vlan id is invalid.
+             */
+            static bool parseFrame(
+                    _In_ const uint8_t* buffer,
+                    _In_ size_t size,
+                    _Out_ FdbLearnEvent& event);
+
+            /**
+             * @brief Enqueue frame for learning, safe to call from any thread.
+             *
+             * @return False if frame was dropped.
+             */
+            bool enqueue(
+                    _In_ sai_object_id_t portId,
+                    _In_ const uint8_t* buffer,
+                    _In_ size_t size);
+
+            void start();
+
+            void stop();
+
+            uint64_t getDroppedCount() const;
+
+        private:
+
+            void run();
+
+            void notify();
+
+            /**
+             * @brief Dequeue up to MAX_BATCH_SIZE events, only latest event
+             * for given key is kept, in order it was received.
+             *
+             * @return Number of events in batch.
+             */
+            size_t dequeueBatch(
+                    _Out_ std::vector<FdbLearnEvent>& batch);
+
+        private:
+
+            BatchHandler m_handler;
+
+            MpscQueue<FdbLearnEvent> m_queue;
+
+            std::atomic<size_t> m_pending;
+
+            std::atomic<bool> m_signaled;
+
+            std::atomic<uint64_t> m_dropped;
+
+            std::atomic<bool> m_run;
+
+            int m_eventfd;
+
+            std::shared_ptr<std::thread> m_thread;
+
+            std::map<std::pair<sai_object_id_t, uint64_t>, size_t> m_keys;
+    };
+}
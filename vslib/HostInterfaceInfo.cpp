@@ -1,10 +1,8 @@
 #include "HostInterfaceInfo.h"
 #include "SwitchStateBase.h"
-#include "SelectableFd.h"
 #include "EventPayloadPacket.h"
 
 #include "swss/logger.h"
-#include "swss/select.h"
 
 #include "meta/sai_serialize.h"
 
@@ -30,36 +28,31 @@ HostInterfaceInfo::HostInterfaceInfo(
         _In_ int tapfd,
         _In_ const std::string& tapname,
         _In_ sai_object_id_t portId,
-        _In_ std::shared_ptr<EventQueue> eventQueue):
+        _In_ std::shared_ptr<EventQueue> eventQueue,
+        _In_ std::shared_ptr<FdbLearner> fdbLearner):
     m_ifindex(ifindex),
     m_packet_socket(socket),
     m_name(tapname),
     m_portId(portId),
     m_eventQueue(eventQueue),
-    m_tapfd(tapfd)
+    m_fdbLearner(fdbLearner),
+    m_tapfd(tapfd),
+    m_e2tIndex(0),
+    m_t2eIndex(0)
 {
     SWSS_LOG_ENTER();
 
-    m_run_thread = false;
+    // empty
 }
 
 HostInterfaceInfo::~HostInterfaceInfo()
 {
     SWSS_LOG_ENTER();
 
-    m_run_thread = false;
-
-    m_e2tEvent.notify();
-    m_t2eEvent.notify();
-
-    if (m_t2e)
-    {
-        m_t2e->join();
-    }
-
-    if (m_e2t)
+    if (m_engine)
     {
-        m_e2t->join();
+        m_engine->unregisterFd(m_e2tIndex);
+        m_engine->unregisterFd(m_t2eIndex);
     }
 
     // remove tap device
@@ -71,22 +64,32 @@ HostInterfaceInfo::~HostInterfaceInfo()
         SWSS_LOG_ERROR("failed to remove tap device: %s, err: %d", m_name.c_str(), err);
     }
 
-    SWSS_LOG_NOTICE("joined threads for hostif: %s", m_name.c_str());
+    SWSS_LOG_NOTICE("stopped forwarding for hostif: %s", m_name.c_str());
 }
 
-void HostInterfaceInfo::runThreads()
+void HostInterfaceInfo::startForwarding(
+        _In_ std::shared_ptr<PacketForwardingEngine> engine)
 {
     SWSS_LOG_ENTER();
 
-    if (m_run_thread)
+    if (m_engine)
     {
         return;
     }
 
-    m_run_thread = true;
+    // tap is read in batches until it would block
+
+    int flags = fcntl(m_tapfd, F_GETFL, 0);
+
+    if (flags < 0 || fcntl(m_tapfd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        SWSS_LOG_ERROR("failed to set tap fd %d non blocking, errno(%d): %s", m_tapfd, errno, strerror(errno));
+    }
+
+    m_engine = engine ? engine : PacketForwardingEngine::getInstance();
 
-    m_e2t = std::make_shared<std::thread>(&HostInterfaceInfo::veth2tap_fun, this);
-    m_t2e = std::make_shared<std::thread>(&HostInterfaceInfo::tap2veth_fun, this);
+    m_e2tIndex = m_engine->registerFd(m_packet_socket, this);
+    m_t2eIndex = m_engine->registerFd(m_tapfd, this);
 }
 
 void HostInterfaceInfo::async_process_packet_for_fdb_event(
@@ -95,6 +98,15 @@ void HostInterfaceInfo::async_process_packet_for_fdb_event(
 {
     SWSS_LOG_ENTER();
 
+    if (m_fdbLearner)
+    {
+        // lock free, switch state is updated by learner in batches
+
+        m_fdbLearner->enqueue(m_portId, data, size);
+
+        return;
+    }
+
     auto buffer = Buffer(data, size);
 
     auto payload = std::make_shared<EventPayloadPacket>(m_portId, m_ifindex, m_name, buffer);
@@ -136,74 +148,61 @@ bool HostInterfaceInfo::uninstallTap2EthFilter(
     return m_t2eFilters.uninstallFilter(filter);
 }
 
-void HostInterfaceInfo::veth2tap_fun()
+bool HostInterfaceInfo::onReadable(
+        _In_ int fd,
+        _In_ PacketBatch& batch)
 {
     SWSS_LOG_ENTER();
 
-    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
-
-    swss::Select s;
-    SelectableFd fd(m_packet_socket);
-
-    s.addSelectable(&m_e2tEvent);
-    s.addSelectable(&fd);
-
-    while (m_run_thread)
+    if (fd == m_packet_socket)
     {
-        struct msghdr  msg;
-        memset(&msg, 0, sizeof(struct msghdr));
-
-        struct sockaddr_storage src_addr;
-
-        struct iovec iov[1];
+        return veth2tap(batch);
+    }
 
-        iov[0].iov_base = buffer;       // buffer for message
-        iov[0].iov_len = sizeof(buffer);
+    return tap2veth(batch);
+}
 
-        char control[CONTROL_MESSAGE_BUFFER_SIZE];   // buffer for control messages
+bool HostInterfaceInfo::veth2tap(
+        _In_ PacketBatch& batch)
+{
+    SWSS_LOG_ENTER();
 
-        msg.msg_name = &src_addr;
-        msg.msg_namelen = sizeof(src_addr);
-        msg.msg_iov = iov;
-        msg.msg_iovlen = 1;
-        msg.msg_control = control;
-        msg.msg_controllen = sizeof(control);
+    batch.prepareRecv();
 
-        swss::Selectable *sel = NULL;
+    int count = recvmmsg(m_packet_socket, batch.m_msgs, PacketBatch::BATCH_SIZE, MSG_DONTWAIT, nullptr);
 
-        int result = s.select(&sel);
+    if (count < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return true;
+        }
 
-        if (result != swss::Select::OBJECT)
+        if (errno != ENETDOWN)
         {
-            SWSS_LOG_ERROR("selectable failed: %d, ending thread for %s", result, m_name.c_str());
-            return;
+            SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
+                    m_packet_socket, errno, strerror(errno));
         }
 
-        if (sel == &m_e2tEvent) // thread end event
-            break;
+        return errno != EBADF;
+    }
 
-        ssize_t size = recvmsg(m_packet_socket, &msg, 0);
+    for (unsigned int idx = 0; idx < (unsigned int)count; idx++)
+    {
+        auto& msg = batch.m_msgs[idx].msg_hdr;
 
-        if (size < 0)
-        {
-            if (errno != ENETDOWN)
-            {
-                SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
-                        m_packet_socket, errno, strerror(errno));
-            }
+        unsigned char* buffer = batch.getBuffer(idx);
 
-            continue;
-        }
+        size_t length = batch.m_msgs[idx].msg_len;
 
-        if (size < (ssize_t)sizeof(ethhdr))
+        if (length < sizeof(ethhdr))
         {
-            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", msg.msg_controllen);
+            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
             continue;
         }
 
         // Buffer include the ingress packets
         // MACsec scenario: EAPOL packets and encrypted packets
-        size_t length = static_cast<size_t>(size);
         auto ret = m_e2tFilters.execute(buffer, length);
 
         if (ret == TrafficFilter::TERMINATE)
@@ -213,7 +212,7 @@ void HostInterfaceInfo::veth2tap_fun()
         else if (ret == TrafficFilter::ERROR)
         {
             // Error log should be recorded in filter
-            return;
+            return false;
         }
 
         addVlanTag(buffer, length, msg);
@@ -222,62 +221,55 @@ void HostInterfaceInfo::veth2tap_fun()
 
         if (!sendTo(m_tapfd, buffer, length))
         {
-            break;
+            return false;
         }
     }
 
-    SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
+    return true;
 }
 
-void HostInterfaceInfo::tap2veth_fun()
+bool HostInterfaceInfo::tap2veth(
+        _In_ PacketBatch& batch)
 {
     SWSS_LOG_ENTER();
 
-    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
+    batch.prepareSend();
 
-    swss::Select s;
-    SelectableFd fd(m_tapfd);
+    unsigned int count = 0;
 
-    s.addSelectable(&m_t2eEvent);
-    s.addSelectable(&fd);
+    bool run = true;
 
-    while (m_run_thread)
+    for (unsigned int idx = 0; idx < PacketBatch::BATCH_SIZE; idx++)
     {
-        swss::Selectable *sel = NULL;
-
-        int result = s.select(&sel);
-
-        if (result != swss::Select::OBJECT)
-        {
-            SWSS_LOG_ERROR("selectable failed: %d, ending thread for %s", result, m_name.c_str());
-            return;
-        }
+        unsigned char* buffer = batch.getBuffer(idx);
 
-        if (sel == &m_t2eEvent) // thread end event
-            break;
-
-        ssize_t size = read(m_tapfd, buffer, sizeof(buffer));
+        ssize_t size = read(m_tapfd, buffer, ETH_FRAME_BUFFER_SIZE);
 
         if (size < 0)
         {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            {
+                break;
+            }
+
             SWSS_LOG_ERROR("failed to read from tapfd fd %d, errno(%d): %s",
                     m_tapfd, errno, strerror(errno));
 
             if (errno == EBADF)
             {
-                // bad file descriptor, just close the thread
-                SWSS_LOG_NOTICE("ending thread for tap fd %d", m_tapfd);
-                return;
+                // bad file descriptor, just stop forwarding
+                SWSS_LOG_NOTICE("ending forwarding for tap fd %d", m_tapfd);
+
+                run = false;
             }
 
-            continue;
+            break;
         }
 
         // Buffer include the egress packets
         // MACsec scenario: EAPOL packets and plaintext packets
         size_t length = static_cast<size_t>(size);
         auto ret = m_t2eFilters.execute(buffer, length);
-        size = static_cast<ssize_t>(length);
 
         if (ret == TrafficFilter::TERMINATE)
         {
@@ -286,20 +278,56 @@ void HostInterfaceInfo::tap2veth_fun()
         else if (ret == TrafficFilter::ERROR)
         {
             // Error log should be recorded in filter
-            return;
+            run = false;
+            break;
         }
 
-        if (write(m_packet_socket, buffer, (int)size) < 0)
+        batch.m_iovs[count].iov_base = buffer;
+        batch.m_iovs[count].iov_len = length;
+
+        count++;
+    }
+
+    return sendBatch(batch, count) && run;
+}
+
+bool HostInterfaceInfo::sendBatch(
+        _In_ PacketBatch& batch,
+        _In_ unsigned int count)
+{
+    SWSS_LOG_ENTER();
+
+    unsigned int sent = 0;
+
+    while (sent < count)
+    {
+        int res = sendmmsg(m_packet_socket, &batch.m_msgs[sent], count - sent, 0);
+
+        if (res < 0)
         {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
             if (errno != ENETDOWN)
             {
                 SWSS_LOG_ERROR("failed to write to socket fd %d, errno(%d): %s",
                         m_packet_socket, errno, strerror(errno));
             }
 
-            continue;
+            if (errno == EBADF)
+            {
+                return false;
+            }
+
+            // drop failed packet and continue with rest of batch
+
+            res = 1;
         }
+
+        sent += (unsigned int)res;
     }
 
-    SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
+    return true;
 }
@@ -5,19 +5,19 @@ extern "C" {
 }
 
 #include "EventQueue.h"
+#include "FdbLearner.h"
 #include "TrafficFilterPipes.h"
 #include "TrafficForwarder.h"
-
-#include "swss/selectableevent.h"
+#include "PacketForwardingEngine.h"
 
 #include <memory>
-#include <thread>
 #include <string.h>
 
 namespace saivs
 {
     class HostInterfaceInfo:
-        public TrafficForwarder
+        public TrafficForwarder,
+        public PacketHandler
     {
         private:
 
@@ -31,7 +31,8 @@ namespace saivs
                     _In_ int tapfd,
                     _In_ const std::string& tapname,
                     _In_ sai_object_id_t portId,
-                    _In_ std::shared_ptr<EventQueue> eventQueue);
+                    _In_ std::shared_ptr<EventQueue> eventQueue,
+                    _In_ std::shared_ptr<FdbLearner> fdbLearner = nullptr);
 
             virtual ~HostInterfaceInfo();
 
@@ -55,13 +56,28 @@ namespace saivs
             bool uninstallTap2EthFilter(
                     _In_ std::shared_ptr<TrafficFilter> filter);
 
-            void runThreads();
+            /**
+             * @brief Register veth socket and tap device in packet
+             * forwarding engine, shared engine is used if none is given.
+             */
+            void startForwarding(
+                    _In_ std::shared_ptr<PacketForwardingEngine> engine = nullptr);
+
+            virtual bool onReadable(
+                    _In_ int fd,
+                    _In_ PacketBatch& batch) override;
 
         private:
 
-            void veth2tap_fun();
+            bool veth2tap(
+                    _In_ PacketBatch& batch);
 
-            void tap2veth_fun();
+            bool tap2veth(
+                    _In_ PacketBatch& batch);
+
+            bool sendBatch(
+                    _In_ PacketBatch& batch,
+                    _In_ unsigned int count);
 
         public: // TODO to private
 
@@ -73,21 +89,20 @@ namespace saivs
 
             sai_object_id_t m_portId;
 
-            bool m_run_thread;
-
             std::shared_ptr<EventQueue> m_eventQueue;
 
+            std::shared_ptr<FdbLearner> m_fdbLearner;
+
             int m_tapfd;
 
         private:
 
-            std::shared_ptr<std::thread> m_e2t;
-            std::shared_ptr<std::thread> m_t2e;
+            std::shared_ptr<PacketForwardingEngine> m_engine;
+
+            uint64_t m_e2tIndex;
+            uint64_t m_t2eIndex;
 
             TrafficFilterPipes m_e2tFilters;
             TrafficFilterPipes m_t2eFilters;
-
-            swss::SelectableEvent m_e2tEvent;
-            swss::SelectableEvent m_t2eEvent;
     };
 }
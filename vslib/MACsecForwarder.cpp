@@ -1,9 +1,7 @@
 #include "MACsecForwarder.h"
 #include "SwitchStateBase.h"
-#include "SelectableFd.h"
 
 #include "swss/logger.h"
-#include "swss/select.h"
 
 #include <sys/socket.h>
 #include <linux/if_packet.h>
@@ -18,7 +16,7 @@ MACsecForwarder::MACsecForwarder(
         _In_ const std::string &macsecInterfaceName,
         _In_ std::shared_ptr<HostInterfaceInfo> info):
     m_macsecInterfaceName(macsecInterfaceName),
-    m_runThread(true),
+    m_index(0),
     m_info(info)
 {
     SWSS_LOG_ENTER();
@@ -69,7 +67,9 @@ MACsecForwarder::MACsecForwarder(
                 m_macsecInterfaceName.c_str());
     }
 
-    m_forwardThread = std::make_shared<std::thread>(&MACsecForwarder::forward, this);
+    m_engine = PacketForwardingEngine::getInstance();
+
+    m_index = m_engine->registerFd(m_macsecfd, this);
 
     SWSS_LOG_NOTICE(
             "setup MACsec forward rule for %s succeeded",
@@ -80,9 +80,7 @@ MACsecForwarder::~MACsecForwarder()
 {
     SWSS_LOG_ENTER();
 
-    m_runThread = false;
-    m_exitEvent.notify();
-    m_forwardThread->join();
+    m_engine->unregisterFd(m_index);
 
     int err = close(m_macsecfd);
 
@@ -102,97 +100,65 @@ int MACsecForwarder::get_macsecfd() const
     return m_macsecfd;
 }
 
-void MACsecForwarder::forward()
+bool MACsecForwarder::onReadable(
+        _In_ int fd,
+        _In_ PacketBatch& batch)
 {
     SWSS_LOG_ENTER();
 
-    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
-    swss::Select s;
-    SelectableFd fd(m_macsecfd);
+    batch.prepareRecv();
 
-    s.addSelectable(&m_exitEvent);
-    s.addSelectable(&fd);
+    int count = recvmmsg(m_macsecfd, batch.m_msgs, PacketBatch::BATCH_SIZE, MSG_DONTWAIT, nullptr);
 
-    while (m_runThread)
+    if (count < 0)
     {
-        struct msghdr msg;
-        memset(&msg, 0, sizeof(struct msghdr));
-
-        struct sockaddr_storage srcAddr;
-
-        struct iovec iov[1];
-
-        iov[0].iov_base = buffer; // buffer for message
-        iov[0].iov_len = sizeof(buffer);
-
-        char control[CONTROL_MESSAGE_BUFFER_SIZE]; // buffer for control messages
-
-        msg.msg_name = &srcAddr;
-        msg.msg_namelen = sizeof(srcAddr);
-        msg.msg_iov = iov;
-        msg.msg_iovlen = 1;
-        msg.msg_control = control;
-        msg.msg_controllen = sizeof(control);
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return true;
+        }
 
-        swss::Selectable *sel = NULL;
-        int result = s.select(&sel);
+        SWSS_LOG_WARN(
+                "failed to read from macsec device %s fd %d, errno(%d): %s",
+                m_macsecInterfaceName.c_str(),
+                m_macsecfd,
+                errno,
+                strerror(errno));
 
-        if (result != swss::Select::OBJECT)
+        if (errno == EBADF)
         {
-            SWSS_LOG_ERROR(
-                    "selectable failed: %d, ending thread for %s",
-                    result,
+            // bad file descriptor, just stop forwarding
+            SWSS_LOG_NOTICE(
+                    "ending forwarding for macsec device %s",
                     m_macsecInterfaceName.c_str());
 
-            break;
+            return false;
         }
 
-        if (sel == &m_exitEvent) // thread end event
-            break;
+        return true;
+    }
 
-        ssize_t size = recvmsg(m_macsecfd, &msg, 0);
+    for (unsigned int idx = 0; idx < (unsigned int)count; idx++)
+    {
+        unsigned char* buffer = batch.getBuffer(idx);
 
-        if (size < 0)
-        {
-            SWSS_LOG_WARN(
-                    "failed to read from macsec device %s fd %d, errno(%d): %s",
-                    m_macsecInterfaceName.c_str(),
-                    m_macsecfd,
-                    errno,
-                    strerror(errno));
-
-            if (errno == EBADF)
-            {
-                // bad file descriptor, just close the thread
-                SWSS_LOG_NOTICE(
-                        "ending thread for macsec device %s",
-                        m_macsecInterfaceName.c_str());
-
-                break;
-            }
+        size_t length = batch.m_msgs[idx].msg_len;
 
-            continue;
-        }
-        else if (size < (ssize_t)sizeof(ethhdr))
+        if (length < sizeof(ethhdr))
         {
-            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", msg.msg_controllen);
+            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
 
             continue;
         }
 
-        size_t length = static_cast<size_t>(size);
-
-        addVlanTag(buffer, length, msg);
+        addVlanTag(buffer, length, batch.m_msgs[idx].msg_hdr);
 
         m_info->async_process_packet_for_fdb_event(buffer, length);
 
         if (!sendTo(m_info->m_tapfd, buffer, length))
         {
-            break;
+            return false;
         }
     }
 
-    SWSS_LOG_NOTICE(
-            "ending thread proc for %s",
-            m_macsecInterfaceName.c_str());
+    return true;
 }
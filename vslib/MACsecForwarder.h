@@ -2,18 +2,18 @@
 
 #include "HostInterfaceInfo.h"
 #include "TrafficForwarder.h"
+#include "PacketForwardingEngine.h"
 
 #include "swss/sal.h"
-#include "swss/selectableevent.h"
 
 #include <string>
 #include <memory>
-#include <thread>
 
 namespace saivs
 {
     class MACsecForwarder :
-        public TrafficForwarder
+        public TrafficForwarder,
+        public PacketHandler
     {
         public:
 
@@ -25,7 +25,9 @@ namespace saivs
 
             int get_macsecfd() const;
 
-            void forward();
+            virtual bool onReadable(
+                    _In_ int fd,
+                    _In_ PacketBatch& batch) override;
 
         private:
 
@@ -33,11 +35,9 @@ namespace saivs
 
             const std::string m_macsecInterfaceName;
 
-            bool m_runThread;
+            std::shared_ptr<PacketForwardingEngine> m_engine;
 
-            swss::SelectableEvent m_exitEvent;
-
-            std::shared_ptr<std::thread> m_forwardThread;
+            uint64_t m_index;
 
             std::shared_ptr<HostInterfaceInfo> m_info;
     };
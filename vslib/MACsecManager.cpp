@@ -6,17 +6,21 @@
 #include <swss/exec.h>
 
 #include <unistd.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <linux/if_macsec.h>
 
 #include <regex>
 #include <cstring>
 #include <system_error>
 #include <cinttypes>
 #include <string>
+#include <sstream>
+#include <set>
+#include <algorithm>
 
 using namespace saivs;
 
-static constexpr macsec_an_t MAX_MACSEC_SA_NUMBER = 3;
-
 MACsecManager::MACsecManager()
 {
     SWSS_LOG_ENTER();
@@ -292,89 +296,227 @@ bool MACsecManager::enable_macsec_filter(
     return true;
 }
 
+// Update MACsec SA packet number
+// $ ip macsec set <MACSEC_NAME> tx sa <AN> pn <PN>
+// $ ip macsec set <MACSEC_NAME> rx sci <SCI> sa <AN> pn <PN>
 bool MACsecManager::update_macsec_sa_pn(
         _In_ const MACsecAttr &attr,
         _In_ sai_uint64_t pn)
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec set "
-        << shellquote(attr.m_macsecName);
+    MACsecNetLinkRequest request;
 
-    if (attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS)
+    if (!get_macsec_sa_request(
+                attr,
+                attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS ? MACSEC_CMD_UPD_TXSA : MACSEC_CMD_UPD_RXSA,
+                request))
     {
-        ostream << " tx";
+        return false;
     }
-    else
+
+    request.m_setPn = true;
+    request.m_pn = pn;
+
+    SWSS_LOG_NOTICE(
+            "Update MACsec SA %s:%u at the device %s, %s %" PRIu64,
+            attr.m_sci.c_str(),
+            static_cast<std::uint32_t>(attr.m_an),
+            attr.m_macsecName.c_str(),
+            attr.is_xpn() ? "xpn" : "pn",
+            pn);
+
+    return m_netlink.execute(request);
+}
+
+bool MACsecManager::get_macsec_sa_pn(
+        _In_ const MACsecAttr &attr,
+        _Out_ sai_uint64_t &pn) const
+{
+    SWSS_LOG_ENTER();
+
+    pn = 1;
+
+    MACsecSaState state;
+
+    if (!get_macsec_sa_state(attr.m_macsecName, attr.m_direction, attr.m_sci, attr.m_an, state))
     {
-        ostream << " rx sci " << attr.m_sci;
+        SWSS_LOG_WARN(
+                "The packet number isn't in the MACsec SA %s:%u at the device %s.",
+                attr.m_sci.c_str(),
+                static_cast<std::uint32_t>(attr.m_an),
+                attr.m_macsecName.c_str());
+
+        return false;
     }
 
-    ostream << " sa " << attr.m_an;
+    pn = state.m_pn;
 
-    if (attr.is_xpn())
+    return true;
+}
+
+bool MACsecManager::get_macsec_sa_stats(
+        _In_ const MACsecAttr &attr,
+        _Out_ std::map<int, std::uint64_t> &stats) const
+{
+    SWSS_LOG_ENTER();
+
+    stats.clear();
+
+    MACsecSaState state;
+
+    if (!get_macsec_sa_state(attr.m_macsecName, attr.m_direction, attr.m_sci, attr.m_an, state))
     {
-        ostream << " ssci " << attr.m_ssci;
+        return false;
     }
 
-    ostream << ( attr.is_xpn() ? " xpn " : " pn " ) << pn;
-
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    stats = state.m_stats;
 
-    return exec(ostream.str());
+    return true;
 }
 
-bool MACsecManager::get_macsec_sa_pn(
-        _In_ const MACsecAttr &attr,
-        _Out_ sai_uint64_t &pn) const
+bool MACsecManager::create_macsec_sa(
+        _In_ const std::vector<MACsecAttr> &attrs,
+        _Out_ std::vector<bool> &results)
 {
     SWSS_LOG_ENTER();
 
-    pn = 1;
-    std::string macsecSaInfo;
+    // Batched rekey, all SAs (and missing ingress SCs) are installed by
+    // single netlink batch, then egress encoding SAs are switched
 
-    if (!get_macsec_sa_info( attr.m_macsecName, attr.m_direction, attr.m_sci, attr.m_an, macsecSaInfo))
+    results.assign(attrs.size(), false);
+
+    std::map<std::uint32_t, MACsecSecYState> states;
+
+    if (!m_netlink.dump(states))
     {
         return false;
     }
 
-    // Here is an example of MACsec SA
-    //     0: PN 28, state on, key ebe9123ecbbfd96bee92c8ab01000000
-    // Use pattern 'PN\s*(\d+)'
-    // to extract packet number from MACsec SA
+    std::vector<MACsecNetLinkRequest> requests;
+    std::vector<size_t> requestAttrs;
+    std::vector<size_t> egress;
+    std::vector<size_t> fallback;
+    std::map<std::pair<std::uint32_t, std::uint64_t>, size_t> rxScs;
 
-    const std::regex pattern("PN\\s*(\\d+)");
-    std::smatch matches;
+    for (size_t idx = 0; idx < attrs.size(); idx++)
+    {
+        const auto &attr = attrs[idx];
+
+        MACsecNetLinkRequest request;
+
+        if (!get_macsec_sa_request(
+                    attr,
+                    attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS ? MACSEC_CMD_ADD_TXSA : MACSEC_CMD_ADD_RXSA,
+                    request))
+        {
+            // device is created together with egress SC, single SA path does it
+
+            fallback.push_back(idx);
+
+            continue;
+        }
+
+        auto it = states.find(request.m_ifindex);
+
+        if (it == states.end())
+        {
+            fallback.push_back(idx);
+
+            continue;
+        }
+
+        if (attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS)
+        {
+            if (it->second.m_txSas.find(static_cast<std::uint8_t>(attr.m_an)) != it->second.m_txSas.end())
+            {
+                results[idx] = true;
+
+                continue;
+            }
+
+            egress.push_back(idx);
+        }
+        else
+        {
+            auto sc = it->second.m_rxScs.find(request.m_sci);
+
+            if (sc == it->second.m_rxScs.end())
+            {
+                auto key = std::make_pair(request.m_ifindex, request.m_sci);
+
+                if (rxScs.find(key) == rxScs.end())
+                {
+                    MACsecNetLinkRequest scRequest;
+
+                    scRequest.m_cmd = MACSEC_CMD_ADD_RXSC;
+                    scRequest.m_ifindex = request.m_ifindex;
+                    scRequest.m_sci = request.m_sci;
+                    scRequest.m_setActive = true;
+                    scRequest.m_active = true;
+
+                    rxScs[key] = requests.size();
+
+                    requests.push_back(scRequest);
+                    requestAttrs.push_back(idx);
+                }
+            }
+            else if (sc->second.m_sas.find(static_cast<std::uint8_t>(attr.m_an)) != sc->second.m_sas.end())
+            {
+                results[idx] = true;
+
+                continue;
+            }
+        }
+
+        requests.push_back(request);
+        requestAttrs.push_back(idx);
+    }
+
+    std::vector<bool> requestResults;
+
+    m_netlink.execute(requests, requestResults);
+
+    // SA is created only if its request and request of its rx SC succeeded
 
-    if (std::regex_search(macsecSaInfo, matches, pattern))
+    for (size_t idx = 0; idx < requests.size(); idx++)
     {
-        if (matches.size() != 2)
+        if (requests[idx].m_cmd == MACSEC_CMD_ADD_RXSC)
         {
-            SWSS_LOG_ERROR(
-                    "Wrong match result %s in %s",
-                    matches.str().c_str(),
-                    macsecSaInfo.c_str());
+            continue;
+        }
 
-            return false;
+        bool success = requestResults[idx];
+
+        if (requests[idx].m_cmd == MACSEC_CMD_ADD_RXSA)
+        {
+            auto sc = rxScs.find(std::make_pair(requests[idx].m_ifindex, requests[idx].m_sci));
+
+            if (sc != rxScs.end())
+            {
+                success = success && requestResults[sc->second];
+            }
         }
 
-        std::istringstream iss(matches[1].str());
-        iss >> pn;
-        return true;
+        results[requestAttrs[idx]] = success;
     }
-    else
+
+    for (auto idx: egress)
     {
-        SWSS_LOG_WARN(
-                "The packet number isn't in the MACsec SA %s:%u at the device %s.",
-                attr.m_sci.c_str(),
-                static_cast<std::uint32_t>(attr.m_an),
-                attr.m_macsecName.c_str());
+        if (results[idx])
+        {
+            results[idx] = m_netlink.setEncodingSa(
+                    if_nametoindex(attrs[idx].m_macsecName.c_str()),
+                    static_cast<std::uint8_t>(attrs[idx].m_an));
+        }
+    }
 
-        return false;
+    for (auto idx: fallback)
+    {
+        results[idx] = create_macsec_sa(attrs[idx]);
     }
 
+    return std::find(results.begin(), results.end(), false) == results.end();
 }
 
 // Create MACsec Egress SC
@@ -386,24 +528,38 @@ bool MACsecManager::create_macsec_egress_sc(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip link add link "
-        << shellquote(attr.m_vethName)
-        << " name "
-        << shellquote(attr.m_macsecName)
-        << " type macsec "
-        << " sci " << attr.m_sci
-        << " encrypt " << (attr.m_encryptionEnable ? " on " : " off ")
-        << " cipher " << attr.m_cipher
-        << " send_sci " << (attr.m_sendSci ? " on " : " off ")
-        << " && ip link set dev "
-        << shellquote(attr.m_macsecName)
-        << " up";
+    std::uint64_t sci;
+
+    if (!MACsecNetLink::parseSci(attr.m_sci, sci))
+    {
+        SWSS_LOG_ERROR("Invalid MACsec SCI %s", attr.m_sci.c_str());
+
+        return false;
+    }
+
+    auto parent = if_nametoindex(attr.m_vethName.c_str());
+
+    if (parent == 0)
+    {
+        SWSS_LOG_ERROR("Cannot find device %s", attr.m_vethName.c_str());
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+        return false;
+    }
 
-    if (!exec(ostream.str()))
+    SWSS_LOG_NOTICE(
+            "Create MACsec device %s on %s, sci %s, cipher %s",
+            attr.m_macsecName.c_str(),
+            attr.m_vethName.c_str(),
+            attr.m_sci.c_str(),
+            attr.m_cipher.c_str());
+
+    if (!m_netlink.createSecY(
+                parent,
+                attr.m_macsecName,
+                sci,
+                get_macsec_cipher_suite(attr.m_cipher),
+                attr.m_encryptionEnable,
+                attr.m_sendSci))
     {
         return false;
     }
@@ -414,23 +570,28 @@ bool MACsecManager::create_macsec_egress_sc(
 }
 
 // Create MACsec Ingress SC
-// $ ip macsec add <MACSEC_NAME> rx sci <SCI>
+// $ ip macsec add <MACSEC_NAME> rx sci <SCI> on
 bool MACsecManager::create_macsec_ingress_sc(
         _In_ const MACsecAttr &attr)
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec add "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci
-        << " on";
+    MACsecNetLinkRequest request;
+
+    if (!get_macsec_sc_request(attr, MACSEC_CMD_ADD_RXSC, request))
+    {
+        return false;
+    }
+
+    request.m_setActive = true;
+    request.m_active = true;
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    SWSS_LOG_NOTICE(
+            "Create MACsec ingress SC %s at the device %s",
+            attr.m_sci.c_str(),
+            attr.m_macsecName.c_str());
 
-    return exec(ostream.str());
+    return m_netlink.execute(request);
 }
 
 // Create MACsec Egress SA
@@ -441,32 +602,22 @@ bool MACsecManager::create_macsec_egress_sa(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec add "
-        << shellquote(attr.m_macsecName)
-        << " tx sa "
-        << attr.m_an
-        << ( attr.is_xpn() ? " xpn " : " pn ")
-        << attr.m_pn
-        << ( attr.is_xpn() ? " ssci " : "" )
-        << ( attr.is_xpn() ? attr.m_ssci : "" )
-        << ( attr.is_xpn() ? " salt " : "" )
-        << ( attr.is_xpn() ? attr.m_salt : "" )
-        << " on key "
-        << attr.m_authKey
-        << " "
-        << attr.m_sak
-        << " && ip link set link "
-        << attr.m_vethName
-        << " name "
-        << attr.m_macsecName
-        << " type macsec encodingsa "
-        << attr.m_an;
+    MACsecNetLinkRequest request;
+
+    if (!get_macsec_sa_request(attr, MACSEC_CMD_ADD_TXSA, request))
+    {
+        return false;
+    }
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    SWSS_LOG_NOTICE(
+            "Create MACsec egress SA %s:%u at the device %s",
+            attr.m_sci.c_str(),
+            static_cast<std::uint32_t>(attr.m_an),
+            attr.m_macsecName.c_str());
 
-    return exec(ostream.str());
+    return
+        m_netlink.execute(request)
+        && m_netlink.setEncodingSa(request.m_ifindex, request.m_an);
 }
 
 // Create MACsec Ingress SA
@@ -476,28 +627,20 @@ bool MACsecManager::create_macsec_ingress_sa(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec add "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci
-        << " sa "
-        << attr.m_an
-        << ( attr.is_xpn() ? " xpn " : " pn " )
-        << attr.m_pn
-        << ( attr.is_xpn() ? " ssci " : "" )
-        << ( attr.is_xpn() ? attr.m_ssci : "" )
-        << ( attr.is_xpn() ? " salt " : "" )
-        << ( attr.is_xpn() ? attr.m_salt : "" )
-        << " on key "
-        << attr.m_authKey
-        << " "
-        << attr.m_sak;
+    MACsecNetLinkRequest request;
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    if (!get_macsec_sa_request(attr, MACSEC_CMD_ADD_RXSA, request))
+    {
+        return false;
+    }
 
-    return exec(ostream.str());
+    SWSS_LOG_NOTICE(
+            "Create MACsec ingress SA %s:%u at the device %s",
+            attr.m_sci.c_str(),
+            static_cast<std::uint32_t>(attr.m_an),
+            attr.m_macsecName.c_str());
+
+    return m_netlink.execute(request);
 }
 
 // Delete MACsec Egress SC
@@ -508,19 +651,12 @@ bool MACsecManager::delete_macsec_egress_sc(
     SWSS_LOG_ENTER();
 
     bool result = true;
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip link del link "
-        << shellquote(attr.m_vethName)
-        << " name "
-        << shellquote(attr.m_macsecName)
-        << " type macsec";
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    SWSS_LOG_NOTICE("Delete MACsec device %s", attr.m_macsecName.c_str());
 
     result &= delete_macsec_forwarder(attr.m_macsecName);
     result &= enable_macsec_filter(attr.m_macsecName, false);
-    result &= exec(ostream.str());
+    result &= m_netlink.deleteSecY(attr.m_macsecName);
 
     return result;
 }
@@ -533,21 +669,31 @@ bool MACsecManager::delete_macsec_ingress_sc(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec set "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci
-        << " off"
-        << " && ip macsec del "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci;
+    MACsecNetLinkRequest request;
+
+    if (!get_macsec_sc_request(attr, MACSEC_CMD_UPD_RXSC, request))
+    {
+        return false;
+    }
+
+    request.m_setActive = true;
+    request.m_active = false;
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    std::vector<MACsecNetLinkRequest> requests{ request };
 
-    return exec(ostream.str());
+    request.m_cmd = MACSEC_CMD_DEL_RXSC;
+    request.m_setActive = false;
+
+    requests.push_back(request);
+
+    SWSS_LOG_NOTICE(
+            "Delete MACsec ingress SC %s at the device %s",
+            attr.m_sci.c_str(),
+            attr.m_macsecName.c_str());
+
+    std::vector<bool> results;
+
+    return m_netlink.execute(requests, results);
 }
 
 // Delete MACsec Egress SA
@@ -558,22 +704,7 @@ bool MACsecManager::delete_macsec_egress_sa(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec set "
-        << shellquote(attr.m_macsecName)
-        << " tx sa "
-        << attr.m_an
-        << " off"
-        << " && ip macsec del "
-        << shellquote(attr.m_macsecName)
-        << " tx sa "
-        << attr.m_an
-        ;
-
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
-
-    return exec(ostream.str());
+    return delete_macsec_sa_request(attr, MACSEC_CMD_UPD_TXSA, MACSEC_CMD_DEL_TXSA);
 }
 
 // Delete MACsec Ingress SA
@@ -584,25 +715,153 @@ bool MACsecManager::delete_macsec_ingress_sa(
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec set "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci
-        << " sa "
-        << attr.m_an
-        << " off"
-        << " && ip macsec del "
-        << shellquote(attr.m_macsecName)
-        << " rx sci "
-        << attr.m_sci
-        << " sa "
-        << attr.m_an;
+    return delete_macsec_sa_request(attr, MACSEC_CMD_UPD_RXSA, MACSEC_CMD_DEL_RXSA);
+}
+
+bool MACsecManager::delete_macsec_sa_request(
+        _In_ const MACsecAttr &attr,
+        _In_ std::uint8_t updateCmd,
+        _In_ std::uint8_t deleteCmd)
+{
+    SWSS_LOG_ENTER();
+
+    MACsecNetLinkRequest request;
+
+    if (!get_macsec_sc_request(attr, updateCmd, request))
+    {
+        return false;
+    }
+
+    // SA needs to be deactivated before it can be deleted
+
+    request.m_an = static_cast<std::uint8_t>(attr.m_an);
+    request.m_setActive = true;
+    request.m_active = false;
+
+    std::vector<MACsecNetLinkRequest> requests{ request };
+
+    request.m_cmd = deleteCmd;
+    request.m_setActive = false;
+
+    requests.push_back(request);
+
+    SWSS_LOG_NOTICE(
+            "Delete MACsec SA %s:%u at the device %s",
+            attr.m_sci.c_str(),
+            static_cast<std::uint32_t>(attr.m_an),
+            attr.m_macsecName.c_str());
+
+    std::vector<bool> results;
+
+    return m_netlink.execute(requests, results);
+}
+
+bool MACsecManager::get_macsec_sc_request(
+        _In_ const MACsecAttr &attr,
+        _In_ std::uint8_t cmd,
+        _Out_ MACsecNetLinkRequest &request) const
+{
+    SWSS_LOG_ENTER();
+
+    request = MACsecNetLinkRequest();
+
+    request.m_cmd = cmd;
+    request.m_ifindex = if_nametoindex(attr.m_macsecName.c_str());
+
+    if (request.m_ifindex == 0)
+    {
+        SWSS_LOG_WARN("MACsec device %s is nonexisting", attr.m_macsecName.c_str());
+
+        return false;
+    }
+
+    if (attr.m_direction != SAI_MACSEC_DIRECTION_EGRESS && !MACsecNetLink::parseSci(attr.m_sci, request.m_sci))
+    {
+        SWSS_LOG_ERROR("Invalid MACsec SCI %s", attr.m_sci.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecManager::get_macsec_sa_request(
+        _In_ const MACsecAttr &attr,
+        _In_ std::uint8_t cmd,
+        _Out_ MACsecNetLinkRequest &request) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!get_macsec_sc_request(attr, cmd, request))
+    {
+        return false;
+    }
+
+    request.m_an = static_cast<std::uint8_t>(attr.m_an);
+    request.m_xpn = attr.is_xpn();
+
+    if (cmd != MACSEC_CMD_ADD_TXSA && cmd != MACSEC_CMD_ADD_RXSA)
+    {
+        return true;
+    }
+
+    request.m_setActive = true;
+    request.m_active = true;
+    request.m_setPn = true;
+    request.m_pn = attr.m_pn;
+
+    if (!MACsecNetLink::parseHex(attr.m_sak, request.m_key) ||
+            !MACsecNetLink::parseHex(attr.m_authKey, request.m_keyId))
+    {
+        SWSS_LOG_ERROR("Invalid MACsec key of SA %s:%u", attr.m_sci.c_str(), static_cast<std::uint32_t>(attr.m_an));
+
+        return false;
+    }
+
+    // key id is always MACSEC_KEYID_LEN bytes, padded with zeros
+
+    request.m_keyId.resize(MACSEC_KEYID_LEN, 0);
+
+    if (attr.is_xpn())
+    {
+        // SSCI is used by kernel to XOR with the salt that is network order
+
+        request.m_ssci = htonl(static_cast<std::uint32_t>(strtoul(attr.m_ssci.c_str(), nullptr, 16)));
+
+        if (!MACsecNetLink::parseHex(attr.m_salt, request.m_salt))
+        {
+            SWSS_LOG_ERROR("Invalid MACsec salt of SA %s:%u", attr.m_sci.c_str(), static_cast<std::uint32_t>(attr.m_an));
+
+            return false;
+        }
+
+        request.m_salt.resize(MACSEC_SALT_LEN, 0);
+    }
+
+    return true;
+}
+
+std::uint64_t MACsecManager::get_macsec_cipher_suite(
+        _In_ const std::string &cipher)
+{
+    SWSS_LOG_ENTER();
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_256)
+    {
+        return MACSEC_CIPHER_ID_GCM_AES_256;
+    }
 
-    SWSS_LOG_NOTICE("%s", ostream.str().c_str());
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_XPN_128)
+    {
+        return MACSEC_CIPHER_ID_GCM_AES_XPN_128;
+    }
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_XPN_256)
+    {
+        return MACSEC_CIPHER_ID_GCM_AES_XPN_256;
+    }
 
-    return exec(ostream.str());
+    return MACSEC_CIPHER_ID_GCM_AES_128;
 }
 
 bool MACsecManager::add_macsec_forwarder(
@@ -710,18 +969,24 @@ bool MACsecManager::delete_macsec_manager(
 
 // Query MACsec session
 // $ ip macsec show <MACSEC_NAME>
-bool MACsecManager::get_macsec_device_info(
+bool MACsecManager::get_macsec_secy_state(
         _In_ const std::string &macsecDevice,
-        _Out_ std::string &info) const
+        _Out_ MACsecSecYState &state) const
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream ostream;
-    ostream
-        << "/sbin/ip macsec show "
-        << shellquote(macsecDevice);
+    auto ifindex = if_nametoindex(macsecDevice.c_str());
 
-    return exec(ostream.str(), info);
+    if (ifindex == 0)
+    {
+        SWSS_LOG_DEBUG(
+                "MACsec device %s is nonexisting",
+                macsecDevice.c_str());
+
+        return false;
+    }
+
+    return m_netlink.dump(ifindex, state);
 }
 
 bool MACsecManager::is_macsec_device_existing(
@@ -729,58 +994,59 @@ bool MACsecManager::is_macsec_device_existing(
 {
     SWSS_LOG_ENTER();
 
-    std::string macsec_info;
+    MACsecSecYState state;
 
-    return get_macsec_device_info(macsecDevice, macsec_info);
+    return get_macsec_secy_state(macsecDevice, state);
 }
 
-bool MACsecManager::get_macsec_sc_info(
+bool MACsecManager::get_macsec_sa_list(
         _In_ const std::string &macsecDevice,
         _In_ sai_int32_t direction,
         _In_ const std::string &sci,
-        _Out_ std::string &info) const
+        _Out_ std::map<std::uint8_t, MACsecSaState> &sas) const
 {
     SWSS_LOG_ENTER();
 
-    std::string macsec_info;
+    sas.clear();
 
-    if (!get_macsec_device_info(macsecDevice, macsec_info))
-    {
-        SWSS_LOG_DEBUG(
-                "MACsec device %s is nonexisting",
-                macsecDevice.c_str());
+    MACsecSecYState state;
 
+    if (!get_macsec_secy_state(macsecDevice, state))
+    {
         return false;
     }
 
-    const char *strDirection = (direction == SAI_MACSEC_DIRECTION_EGRESS) ? "TXSC" : "RXSC";
+    std::uint64_t nsci;
 
-    // Here is an example of MACsec device information
-    // cipher suite: GCM-AES-128, using ICV length 16
-    // TXSC: fe5400bd9b360001 on SA 0
-    //     0: PN 84, state on, key ebe9123ecbbfd96bee92c8ab01000000
-    //     1: PN 0, state on, key ebe9123ecbbfd96bee92c8ab01000001
-    // RXSC: 5254001234560001, state on
-    //     0: PN 28, state on, key ebe9123ecbbfd96bee92c8ab01000000
-    // Use pattern '<DIRECTION>:\s*<SCI>[ \w,]+\n?(?:\s*\d:[,\w ]+\n?)*'
-    // to extract MACsec SC information
-    std::ostringstream ostream;
-    ostream
-        << strDirection
-        << ":\\s*"
-        << sci
-        << "[ \\w,]+\n?(?:\\s*\\d:[,\\w ]+\n?)*";
-
-    const std::regex pattern(ostream.str());
-    std::smatch matches;
+    if (!MACsecNetLink::parseSci(sci, nsci))
+    {
+        SWSS_LOG_ERROR("Invalid MACsec SCI %s", sci.c_str());
+
+        return false;
+    }
 
-    if (std::regex_search(macsec_info, matches, pattern))
+    if (direction == SAI_MACSEC_DIRECTION_EGRESS)
     {
-        info = matches[0].str();
+        if (state.m_sci != nsci)
+        {
+            return false;
+        }
+
+        sas = state.m_txSas;
+
         return true;
     }
 
-    return false;
+    auto it = state.m_rxScs.find(nsci);
+
+    if (it == state.m_rxScs.end())
+    {
+        return false;
+    }
+
+    sas = it->second.m_sas;
+
+    return true;
 }
 
 bool MACsecManager::is_macsec_sc_existing(
@@ -790,23 +1056,23 @@ bool MACsecManager::is_macsec_sc_existing(
 {
     SWSS_LOG_ENTER();
 
-    std::string macsec_sc_info;
+    std::map<std::uint8_t, MACsecSaState> sas;
 
-    return get_macsec_sc_info(macsecDevice, direction, sci, macsec_sc_info);
+    return get_macsec_sa_list(macsecDevice, direction, sci, sas);
 }
 
-bool MACsecManager::get_macsec_sa_info(
+bool MACsecManager::get_macsec_sa_state(
         _In_ const std::string &macsecDevice,
         _In_ sai_int32_t direction,
         _In_ const std::string &sci,
         _In_ macsec_an_t an,
-        _Out_ std::string &info) const
+        _Out_ MACsecSaState &state) const
 {
     SWSS_LOG_ENTER();
 
-    std::string macsec_sc_info;
+    std::map<std::uint8_t, MACsecSaState> sas;
 
-    if (!get_macsec_sc_info(macsecDevice, direction, sci, macsec_sc_info))
+    if (!get_macsec_sa_list(macsecDevice, direction, sci, sas))
     {
         SWSS_LOG_DEBUG(
                 "The MACsec SC %s at the device %s is nonexisting.",
@@ -816,26 +1082,16 @@ bool MACsecManager::get_macsec_sa_info(
         return false;
     }
 
-    // Here is an example of MACsec SA
-    //     0: PN 28, state on, key ebe9123ecbbfd96bee92c8ab01000000
-    // Use pattern '\s*<AN>:\s*PN\s*\d+[,\w ]+\n?'
-    // to extract MACsec SA information from MACsec SC
-    std::ostringstream ostream;
-    ostream
-        << "\\s*"
-        << an
-        << ":\\s*PN\\s*\\d+[,\\w ]+\n?";
-
-    const std::regex pattern(ostream.str());
-    std::smatch matches;
+    auto it = sas.find(static_cast<std::uint8_t>(an));
 
-    if (std::regex_search(macsec_sc_info, matches, pattern))
+    if (it == sas.end())
     {
-        info = matches[0].str();
-        return true;
+        return false;
     }
 
-    return false;
+    state = it->second;
+
+    return true;
 }
 
 bool MACsecManager::is_macsec_sa_existing(
@@ -846,9 +1102,9 @@ bool MACsecManager::is_macsec_sa_existing(
 {
     SWSS_LOG_ENTER();
 
-    std::string macsecSaInfo;
+    MACsecSaState state;
 
-    return get_macsec_sa_info( macsecDevice, direction, sci, an, macsecSaInfo);
+    return get_macsec_sa_state(macsecDevice, direction, sci, an, state);
 }
 
 size_t MACsecManager::get_macsec_sa_count(
@@ -858,17 +1114,11 @@ size_t MACsecManager::get_macsec_sa_count(
 {
     SWSS_LOG_ENTER();
 
-    size_t sa_count = 0;
+    std::map<std::uint8_t, MACsecSaState> sas;
 
-    for (macsec_an_t an = 0; an <= MAX_MACSEC_SA_NUMBER; an++) // lgtm [cpp/constant-comparison]
-    {
-        if (is_macsec_sa_existing(macsecDevice, direction, sci, an))
-        {
-            sa_count++;
-        }
-    }
+    get_macsec_sa_list(macsecDevice, direction, sci, sas);
 
-    return sa_count;
+    return sas.size();
 }
 
 void MACsecManager::cleanup_macsec_device() const
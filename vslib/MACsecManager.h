@@ -3,6 +3,10 @@
 #include "MACsecAttr.h"
 #include "MACsecFilter.h"
 #include "MACsecForwarder.h"
+#include "MACsecNetLink.h"
+
+#include <map>
+#include <vector>
 
 namespace saivs
 {
@@ -40,10 +44,26 @@ namespace saivs
                     _In_ const MACsecAttr &attr,
                     _In_ sai_uint64_t pn);
 
+            /**
+             * @brief Install multiple SAs (rekey across ports) in single netlink batch.
+             *
+             * SAs of nonexisting devices are created one by one, like by
+             * single SA create. Result of each SA is returned in results.
+             *
+             * @return True if all SAs were created.
+             */
+            bool create_macsec_sa(
+                    _In_ const std::vector<MACsecAttr> &attrs,
+                    _Out_ std::vector<bool> &results);
+
             bool get_macsec_sa_pn(
                     _In_ const MACsecAttr &attr,
                     _Out_ sai_uint64_t &pn) const;
 
+            bool get_macsec_sa_stats(
+                    _In_ const MACsecAttr &attr,
+                    _Out_ std::map<int, std::uint64_t> &stats) const;
+
             void cleanup_macsec_device() const;
 
         protected:
@@ -88,30 +108,48 @@ namespace saivs
             bool delete_macsec_manager(
                     _In_ const std::string &macsecInterface);
 
-            bool get_macsec_device_info(
+            bool delete_macsec_sa_request(
+                    _In_ const MACsecAttr &attr,
+                    _In_ std::uint8_t updateCmd,
+                    _In_ std::uint8_t deleteCmd);
+
+            bool get_macsec_sc_request(
+                    _In_ const MACsecAttr &attr,
+                    _In_ std::uint8_t cmd,
+                    _Out_ MACsecNetLinkRequest &request) const;
+
+            bool get_macsec_sa_request(
+                    _In_ const MACsecAttr &attr,
+                    _In_ std::uint8_t cmd,
+                    _Out_ MACsecNetLinkRequest &request) const;
+
+            static std::uint64_t get_macsec_cipher_suite(
+                    _In_ const std::string &cipher);
+
+            bool get_macsec_secy_state(
                     _In_ const std::string &macsecDevice,
-                    _Out_ std::string &info) const;
+                    _Out_ MACsecSecYState &state) const;
 
             bool is_macsec_device_existing(
                     _In_ const std::string &macsecDevice) const;
 
-            bool get_macsec_sc_info(
+            bool get_macsec_sa_list(
                     _In_ const std::string &macsecDevice,
                     _In_ sai_int32_t direction,
                     _In_ const std::string &sci,
-                    _Out_ std::string &info) const;
+                    _Out_ std::map<std::uint8_t, MACsecSaState> &sas) const;
 
             bool is_macsec_sc_existing(
                     _In_ const std::string &macsecDevice,
                     _In_ sai_int32_t direction,
                     _In_ const std::string &sci) const;
 
-            bool get_macsec_sa_info(
+            bool get_macsec_sa_state(
                     _In_ const std::string &macsecDevice,
                     _In_ sai_int32_t direction,
                     _In_ const std::string &sci,
                     _In_ macsec_an_t an,
-                    _Out_ std::string &info) const;
+                    _Out_ MACsecSaState &state) const;
 
             bool is_macsec_sa_existing(
                     _In_ const std::string &macsecDevice,
@@ -143,5 +181,7 @@ namespace saivs
             };
 
             std::map<std::string, MACsecTrafficManager> m_macsecTrafficManagers;
+
+            mutable MACsecNetLink m_netlink;
     };
 }
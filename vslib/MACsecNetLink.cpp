@@ -0,0 +1,790 @@
+#include "MACsecNetLink.h"
+
+#include "swss/logger.h"
+
+#include <netlink/genl/ctrl.h>
+#include <netlink/route/link.h>
+#include <netlink/route/link/macsec.h>
+
+#include <linux/if_macsec.h>
+#include <linux/if_link.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+
+#include <cstring>
+
+using namespace saivs;
+
+MACsecNetLinkRequest::MACsecNetLinkRequest():
+    m_cmd(MACSEC_CMD_GET_TXSC),
+    m_ifindex(0),
+    m_sci(0),
+    m_an(0),
+    m_setActive(false),
+    m_active(false),
+    m_setPn(false),
+    m_xpn(false),
+    m_pn(0),
+    m_ssci(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty intentionally
+}
+
+MACsecNetLink::MACsecNetLink():
+    m_genlSocket(nullptr),
+    m_routeSocket(nullptr),
+    m_family(-1)
+{
+    SWSS_LOG_ENTER();
+
+    // empty, sockets will be connected on first request
+}
+
+MACsecNetLink::~MACsecNetLink()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_genlSocket)
+    {
+        nl_socket_free(m_genlSocket);
+    }
+
+    if (m_routeSocket)
+    {
+        nl_socket_free(m_routeSocket);
+    }
+}
+
+bool MACsecNetLink::connect()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_genlSocket == nullptr)
+    {
+        m_genlSocket = nl_socket_alloc();
+
+        if (m_genlSocket == nullptr)
+        {
+            SWSS_LOG_ERROR("failed to allocate generic netlink socket");
+            return false;
+        }
+
+        int err = genl_connect(m_genlSocket);
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("failed to connect generic netlink socket: %s", nl_geterror(err));
+
+            nl_socket_free(m_genlSocket);
+
+            m_genlSocket = nullptr;
+
+            return false;
+        }
+
+        // acknowledges of batched requests arrive in order, so strict
+        // sequence check is not needed
+
+        nl_socket_disable_seq_check(m_genlSocket);
+    }
+
+    if (m_family < 0)
+    {
+        m_family = genl_ctrl_resolve(m_genlSocket, MACSEC_GENL_NAME);
+
+        if (m_family < 0)
+        {
+            SWSS_LOG_ERROR("failed to resolve generic netlink family %s: %s",
+                    MACSEC_GENL_NAME,
+                    nl_geterror(m_family));
+
+            return false;
+        }
+    }
+
+    if (m_routeSocket == nullptr)
+    {
+        m_routeSocket = nl_socket_alloc();
+
+        if (m_routeSocket == nullptr)
+        {
+            SWSS_LOG_ERROR("failed to allocate route netlink socket");
+            return false;
+        }
+
+        int err = nl_connect(m_routeSocket, NETLINK_ROUTE);
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("failed to connect route netlink socket: %s", nl_geterror(err));
+
+            nl_socket_free(m_routeSocket);
+
+            m_routeSocket = nullptr;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool MACsecNetLink::createSecY(
+        _In_ std::uint32_t parentIfindex,
+        _In_ const std::string &name,
+        _In_ std::uint64_t sci,
+        _In_ std::uint64_t cipherSuite,
+        _In_ bool encrypt,
+        _In_ bool sendSci)
+{
+    SWSS_LOG_ENTER();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    // $ ip link add link <VETH_NAME> name <MACSEC_NAME> type macsec sci <SCI> ... && ip link set <MACSEC_NAME> up
+
+    struct rtnl_link *link = rtnl_link_macsec_alloc();
+
+    if (link == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate macsec link %s", name.c_str());
+        return false;
+    }
+
+    rtnl_link_set_link(link, static_cast<int>(parentIfindex));
+    rtnl_link_set_name(link, name.c_str());
+    rtnl_link_set_flags(link, IFF_UP);
+
+    rtnl_link_macsec_set_sci(link, sci);
+    rtnl_link_macsec_set_cipher_suite(link, cipherSuite);
+    rtnl_link_macsec_set_encrypt(link, encrypt ? 1 : 0);
+    rtnl_link_macsec_set_send_sci(link, sendSci ? 1 : 0);
+
+    int err = rtnl_link_add(m_routeSocket, link, NLM_F_CREATE | NLM_F_EXCL);
+
+    rtnl_link_put(link);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to create macsec link %s: %s", name.c_str(), nl_geterror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetLink::deleteSecY(
+        _In_ const std::string &name)
+{
+    SWSS_LOG_ENTER();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    struct rtnl_link *link = rtnl_link_alloc();
+
+    if (link == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate link %s", name.c_str());
+        return false;
+    }
+
+    rtnl_link_set_name(link, name.c_str());
+
+    int err = rtnl_link_delete(m_routeSocket, link);
+
+    rtnl_link_put(link);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to delete macsec link %s: %s", name.c_str(), nl_geterror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetLink::setEncodingSa(
+        _In_ std::uint32_t ifindex,
+        _In_ std::uint8_t an)
+{
+    SWSS_LOG_ENTER();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    // $ ip link set link <VETH_NAME> name <MACSEC_NAME> type macsec encodingsa <AN>
+
+    struct nl_msg *msg = nlmsg_alloc_simple(RTM_NEWLINK, NLM_F_REQUEST);
+
+    if (msg == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink message");
+        return false;
+    }
+
+    struct ifinfomsg ifi;
+
+    memset(&ifi, 0, sizeof(ifi));
+
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_index = static_cast<int>(ifindex);
+
+    struct nlattr *linkInfo = nullptr;
+    struct nlattr *infoData = nullptr;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0 ||
+            (linkInfo = nla_nest_start(msg, IFLA_LINKINFO)) == nullptr ||
+            nla_put_string(msg, IFLA_INFO_KIND, "macsec") < 0 ||
+            (infoData = nla_nest_start(msg, IFLA_INFO_DATA)) == nullptr ||
+            nla_put_u8(msg, IFLA_MACSEC_ENCODING_SA, an) < 0)
+    {
+        SWSS_LOG_ERROR("failed to build encoding sa message for ifindex %u", ifindex);
+
+        nlmsg_free(msg);
+
+        return false;
+    }
+
+    nla_nest_end(msg, infoData);
+    nla_nest_end(msg, linkInfo);
+
+    return sendRoute(msg);
+}
+
+bool MACsecNetLink::sendRoute(
+        _In_ struct nl_msg *msg)
+{
+    SWSS_LOG_ENTER();
+
+    int err = nl_send_auto(m_routeSocket, msg);
+
+    nlmsg_free(msg);
+
+    if (err >= 0)
+    {
+        err = nl_wait_for_ack(m_routeSocket);
+    }
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("route netlink request failed: %s", nl_geterror(err));
+        return false;
+    }
+
+    return true;
+}
+
+struct nl_msg* MACsecNetLink::buildRequest(
+        _In_ const MACsecNetLinkRequest &request) const
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink message");
+        return nullptr;
+    }
+
+    bool rxsc = false;
+    bool sa = false;
+
+    switch (request.m_cmd)
+    {
+        case MACSEC_CMD_ADD_RXSC:
+        case MACSEC_CMD_DEL_RXSC:
+        case MACSEC_CMD_UPD_RXSC:
+            rxsc = true;
+            break;
+
+        case MACSEC_CMD_ADD_TXSA:
+        case MACSEC_CMD_DEL_TXSA:
+        case MACSEC_CMD_UPD_TXSA:
+            sa = true;
+            break;
+
+        case MACSEC_CMD_ADD_RXSA:
+        case MACSEC_CMD_DEL_RXSA:
+        case MACSEC_CMD_UPD_RXSA:
+            rxsc = true;
+            sa = true;
+            break;
+
+        default:
+            SWSS_LOG_ERROR("unsupported macsec command %u", request.m_cmd);
+            nlmsg_free(msg);
+            return nullptr;
+    }
+
+    bool ok = genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, request.m_cmd, MACSEC_GENL_VERSION) != nullptr;
+
+    ok = ok && nla_put_u32(msg, MACSEC_ATTR_IFINDEX, request.m_ifindex) >= 0;
+
+    if (ok && rxsc)
+    {
+        struct nlattr *nest = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        ok = nest != nullptr;
+        ok = ok && nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, request.m_sci) >= 0;
+
+        // active flag of RX SC is only set by RX SC commands, RX SA
+        // commands use it for SA
+
+        if (!sa && request.m_setActive)
+        {
+            ok = ok && nla_put_u8(msg, MACSEC_RXSC_ATTR_ACTIVE, request.m_active) >= 0;
+        }
+
+        if (ok)
+        {
+            nla_nest_end(msg, nest);
+        }
+    }
+
+    if (ok && sa)
+    {
+        struct nlattr *nest = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+        ok = nest != nullptr;
+        ok = ok && nla_put_u8(msg, MACSEC_SA_ATTR_AN, request.m_an) >= 0;
+
+        if (request.m_setActive)
+        {
+            ok = ok && nla_put_u8(msg, MACSEC_SA_ATTR_ACTIVE, request.m_active) >= 0;
+        }
+
+        if (request.m_setPn)
+        {
+            ok = ok && (request.m_xpn
+                    ? nla_put_u64(msg, MACSEC_SA_ATTR_PN, request.m_pn)
+                    : nla_put_u32(msg, MACSEC_SA_ATTR_PN, static_cast<std::uint32_t>(request.m_pn))) >= 0;
+        }
+
+        if (!request.m_key.empty())
+        {
+            ok = ok && nla_put(msg, MACSEC_SA_ATTR_KEY, static_cast<int>(request.m_key.size()), request.m_key.data()) >= 0;
+        }
+
+        if (!request.m_keyId.empty())
+        {
+            ok = ok && nla_put(msg, MACSEC_SA_ATTR_KEYID, static_cast<int>(request.m_keyId.size()), request.m_keyId.data()) >= 0;
+        }
+
+        if (request.m_xpn && !request.m_salt.empty())
+        {
+            ok = ok && nla_put_u32(msg, MACSEC_SA_ATTR_SSCI, request.m_ssci) >= 0;
+            ok = ok && nla_put(msg, MACSEC_SA_ATTR_SALT, static_cast<int>(request.m_salt.size()), request.m_salt.data()) >= 0;
+        }
+
+        if (ok)
+        {
+            nla_nest_end(msg, nest);
+        }
+    }
+
+    if (!ok)
+    {
+        SWSS_LOG_ERROR("failed to build macsec command %u for ifindex %u", request.m_cmd, request.m_ifindex);
+
+        nlmsg_free(msg);
+
+        return nullptr;
+    }
+
+    return msg;
+}
+
+bool MACsecNetLink::execute(
+        _In_ const std::vector<MACsecNetLinkRequest> &requests,
+        _Out_ std::vector<bool> &results)
+{
+    SWSS_LOG_ENTER();
+
+    results.assign(requests.size(), false);
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    // write all requests first, kernel processes them in order and
+    // acknowledges each one, so collecting acknowledges afterwards costs
+    // single round trip for the whole batch
+
+    std::vector<bool> sent(requests.size(), false);
+
+    for (size_t idx = 0; idx < requests.size(); idx++)
+    {
+        struct nl_msg *msg = buildRequest(requests[idx]);
+
+        if (msg == nullptr)
+        {
+            continue;
+        }
+
+        int err = nl_send_auto(m_genlSocket, msg);
+
+        nlmsg_free(msg);
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("failed to send macsec command %u: %s", requests[idx].m_cmd, nl_geterror(err));
+            continue;
+        }
+
+        sent[idx] = true;
+    }
+
+    bool success = true;
+
+    for (size_t idx = 0; idx < requests.size(); idx++)
+    {
+        if (!sent[idx])
+        {
+            success = false;
+            continue;
+        }
+
+        int err = nl_wait_for_ack(m_genlSocket);
+
+        if (err < 0)
+        {
+            SWSS_LOG_WARN("macsec command %u on ifindex %u failed: %s",
+                    requests[idx].m_cmd,
+                    requests[idx].m_ifindex,
+                    nl_geterror(err));
+
+            success = false;
+            continue;
+        }
+
+        results[idx] = true;
+    }
+
+    return success;
+}
+
+bool MACsecNetLink::execute(
+        _In_ const MACsecNetLinkRequest &request)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<bool> results;
+
+    return execute(std::vector<MACsecNetLinkRequest>{ request }, results);
+}
+
+static std::uint64_t nla_get_uint(
+        _In_ const struct nlattr *attr)
+{
+    SWSS_LOG_ENTER();
+
+    switch (nla_len(attr))
+    {
+        case sizeof(std::uint8_t):
+            return nla_get_u8(attr);
+
+        case sizeof(std::uint32_t):
+            return nla_get_u32(attr);
+
+        case sizeof(std::uint64_t):
+            return nla_get_u64(attr);
+
+        default:
+            return 0;
+    }
+}
+
+static void parse_stats(
+        _In_ const struct nlattr *nest,
+        _Out_ std::map<int, std::uint64_t> &stats)
+{
+    SWSS_LOG_ENTER();
+
+    struct nlattr *attr;
+    int rem;
+
+    nla_for_each_nested(attr, nest, rem)
+    {
+        int len = nla_len(attr);
+
+        if (len == sizeof(std::uint32_t) || len == sizeof(std::uint64_t))
+        {
+            stats[nla_type(attr)] = nla_get_uint(attr);
+        }
+    }
+}
+
+static void parse_sa_list(
+        _In_ const struct nlattr *nest,
+        _Out_ std::map<std::uint8_t, MACsecSaState> &sas)
+{
+    SWSS_LOG_ENTER();
+
+    struct nlattr *attr;
+    int rem;
+
+    nla_for_each_nested(attr, nest, rem)
+    {
+        struct nlattr *sa[MACSEC_SA_ATTR_MAX + 1];
+
+        if (nla_parse_nested(sa, MACSEC_SA_ATTR_MAX, attr, nullptr) < 0 || !sa[MACSEC_SA_ATTR_AN])
+        {
+            continue;
+        }
+
+        auto &state = sas[nla_get_u8(sa[MACSEC_SA_ATTR_AN])];
+
+        state.m_active = sa[MACSEC_SA_ATTR_ACTIVE] && nla_get_u8(sa[MACSEC_SA_ATTR_ACTIVE]);
+        state.m_pn = sa[MACSEC_SA_ATTR_PN] ? nla_get_uint(sa[MACSEC_SA_ATTR_PN]) : 0;
+
+        if (sa[MACSEC_SA_ATTR_STATS])
+        {
+            parse_stats(sa[MACSEC_SA_ATTR_STATS], state.m_stats);
+        }
+    }
+}
+
+int MACsecNetLink::onDumpMsg(
+        _In_ struct nl_msg *msg,
+        _In_ void *arg)
+{
+    SWSS_LOG_ENTER();
+
+    auto &states = *static_cast<std::map<std::uint32_t, MACsecSecYState>*>(arg);
+
+    struct nlattr *attrs[MACSEC_ATTR_MAX + 1];
+
+    if (genlmsg_parse(nlmsg_hdr(msg), 0, attrs, MACSEC_ATTR_MAX, nullptr) < 0 || !attrs[MACSEC_ATTR_IFINDEX])
+    {
+        SWSS_LOG_WARN("failed to parse macsec dump message");
+
+        return NL_SKIP;
+    }
+
+    auto ifindex = nla_get_u32(attrs[MACSEC_ATTR_IFINDEX]);
+
+    auto &state = states[ifindex];
+
+    state.m_ifindex = ifindex;
+    state.m_sci = 0;
+    state.m_encodingSa = 0;
+
+    if (attrs[MACSEC_ATTR_SECY])
+    {
+        struct nlattr *secy[MACSEC_SECY_ATTR_MAX + 1];
+
+        if (nla_parse_nested(secy, MACSEC_SECY_ATTR_MAX, attrs[MACSEC_ATTR_SECY], nullptr) >= 0)
+        {
+            if (secy[MACSEC_SECY_ATTR_SCI])
+            {
+                state.m_sci = nla_get_u64(secy[MACSEC_SECY_ATTR_SCI]);
+            }
+
+            if (secy[MACSEC_SECY_ATTR_ENCODING_SA])
+            {
+                state.m_encodingSa = nla_get_u8(secy[MACSEC_SECY_ATTR_ENCODING_SA]);
+            }
+        }
+    }
+
+    if (attrs[MACSEC_ATTR_TXSA_LIST])
+    {
+        parse_sa_list(attrs[MACSEC_ATTR_TXSA_LIST], state.m_txSas);
+    }
+
+    if (attrs[MACSEC_ATTR_RXSC_LIST])
+    {
+        struct nlattr *attr;
+        int rem;
+
+        nla_for_each_nested(attr, attrs[MACSEC_ATTR_RXSC_LIST], rem)
+        {
+            struct nlattr *rxsc[MACSEC_RXSC_ATTR_MAX + 1];
+
+            if (nla_parse_nested(rxsc, MACSEC_RXSC_ATTR_MAX, attr, nullptr) < 0 || !rxsc[MACSEC_RXSC_ATTR_SCI])
+            {
+                continue;
+            }
+
+            auto &sc = state.m_rxScs[nla_get_u64(rxsc[MACSEC_RXSC_ATTR_SCI])];
+
+            sc.m_active = rxsc[MACSEC_RXSC_ATTR_ACTIVE] && nla_get_u8(rxsc[MACSEC_RXSC_ATTR_ACTIVE]);
+
+            if (rxsc[MACSEC_RXSC_ATTR_SA_LIST])
+            {
+                parse_sa_list(rxsc[MACSEC_RXSC_ATTR_SA_LIST], sc.m_sas);
+            }
+
+            if (rxsc[MACSEC_RXSC_ATTR_STATS])
+            {
+                parse_stats(rxsc[MACSEC_RXSC_ATTR_STATS], sc.m_stats);
+            }
+        }
+    }
+
+    if (attrs[MACSEC_ATTR_TXSC_STATS])
+    {
+        parse_stats(attrs[MACSEC_ATTR_TXSC_STATS], state.m_txScStats);
+    }
+
+    if (attrs[MACSEC_ATTR_SECY_STATS])
+    {
+        parse_stats(attrs[MACSEC_ATTR_SECY_STATS], state.m_secyStats);
+    }
+
+    return NL_OK;
+}
+
+bool MACsecNetLink::dump(
+        _Out_ std::map<std::uint32_t, MACsecSecYState> &states)
+{
+    SWSS_LOG_ENTER();
+
+    states.clear();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink message");
+        return false;
+    }
+
+    if (genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, NLM_F_DUMP, MACSEC_CMD_GET_TXSC, MACSEC_GENL_VERSION) == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to build macsec dump message");
+
+        nlmsg_free(msg);
+
+        return false;
+    }
+
+    int err = nl_send_auto(m_genlSocket, msg);
+
+    nlmsg_free(msg);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to send macsec dump: %s", nl_geterror(err));
+        return false;
+    }
+
+    struct nl_cb *cb = nl_cb_clone(nl_socket_get_cb(m_genlSocket));
+
+    if (cb == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink callback");
+        return false;
+    }
+
+    nl_cb_set(cb, NL_CB_VALID, NL_CB_CUSTOM, &MACsecNetLink::onDumpMsg, &states);
+
+    err = nl_recvmsgs(m_genlSocket, cb);
+
+    nl_cb_put(cb);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to receive macsec dump: %s", nl_geterror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetLink::dump(
+        _In_ std::uint32_t ifindex,
+        _Out_ MACsecSecYState &state)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::uint32_t, MACsecSecYState> states;
+
+    if (!dump(states))
+    {
+        return false;
+    }
+
+    auto it = states.find(ifindex);
+
+    if (it == states.end())
+    {
+        return false;
+    }
+
+    state = it->second;
+
+    return true;
+}
+
+bool MACsecNetLink::parseHex(
+        _In_ const std::string &hex,
+        _Out_ std::vector<std::uint8_t> &bytes)
+{
+    SWSS_LOG_ENTER();
+
+    bytes.clear();
+
+    if (hex.size() % 2)
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; idx < hex.size(); idx += 2)
+    {
+        char *end = nullptr;
+
+        std::string byte = hex.substr(idx, 2);
+
+        unsigned long value = strtoul(byte.c_str(), &end, 16);
+
+        if (*end != 0)
+        {
+            return false;
+        }
+
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    return true;
+}
+
+bool MACsecNetLink::parseSci(
+        _In_ const std::string &hex,
+        _Out_ std::uint64_t &sci)
+{
+    SWSS_LOG_ENTER();
+
+    sci = 0;
+
+    std::vector<std::uint8_t> bytes;
+
+    if (!parseHex(hex, bytes) || bytes.size() != sizeof(sci))
+    {
+        return false;
+    }
+
+    // SCI string is in wire order, kernel expects it in network byte order
+
+    memcpy(&sci, bytes.data(), sizeof(sci));
+
+    return true;
+}
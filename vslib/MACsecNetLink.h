@@ -0,0 +1,185 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <netlink/netlink.h>
+#include <netlink/genl/genl.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace saivs
+{
+    /**
+     * @brief MACsec generic netlink request.
+     *
+     * Describes single MACSEC_CMD_* command sent to the kernel MACsec
+     * family. RX SC commands use SCI, SA commands use AN and optional PN,
+     * key and XPN parameters.
+     */
+    struct MACsecNetLinkRequest
+    {
+        MACsecNetLinkRequest();
+
+        std::uint8_t m_cmd;
+
+        std::uint32_t m_ifindex;
+
+        // network byte order
+        std::uint64_t m_sci;
+
+        std::uint8_t m_an;
+
+        bool m_setActive;
+        bool m_active;
+
+        bool m_setPn;
+        bool m_xpn;
+        std::uint64_t m_pn;
+
+        std::vector<std::uint8_t> m_key;
+        std::vector<std::uint8_t> m_keyId;
+
+        // network byte order, XPN only
+        std::uint32_t m_ssci;
+        std::vector<std::uint8_t> m_salt;
+    };
+
+    struct MACsecSaState
+    {
+        bool m_active;
+
+        std::uint64_t m_pn;
+
+        std::map<int, std::uint64_t> m_stats;
+    };
+
+    struct MACsecRxScState
+    {
+        bool m_active;
+
+        std::map<std::uint8_t, MACsecSaState> m_sas;
+
+        std::map<int, std::uint64_t> m_stats;
+    };
+
+    struct MACsecSecYState
+    {
+        std::uint32_t m_ifindex;
+
+        // network byte order
+        std::uint64_t m_sci;
+
+        std::uint8_t m_encodingSa;
+
+        std::map<std::uint8_t, MACsecSaState> m_txSas;
+
+        // key is SCI in network byte order
+        std::map<std::uint64_t, MACsecRxScState> m_rxScs;
+
+        std::map<int, std::uint64_t> m_txScStats;
+
+        std::map<int, std::uint64_t> m_secyStats;
+    };
+
+    /**
+     * @brief MACsec netlink control plane.
+     *
+     * Talks directly to kernel MACsec generic netlink family and rtnetlink
+     * instead of forking /sbin/ip for each SC/SA operation. Multiple requests
+     * can be sent in one batch, and acknowledges are collected after all
+     * requests are written to the socket.
+     */
+    class MACsecNetLink
+    {
+        private:
+
+            MACsecNetLink(const MACsecNetLink&) = delete;
+            MACsecNetLink& operator=(const MACsecNetLink&) = delete;
+
+        public:
+
+            MACsecNetLink();
+
+            virtual ~MACsecNetLink();
+
+        public: // SecY device, rtnetlink
+
+            bool createSecY(
+                    _In_ std::uint32_t parentIfindex,
+                    _In_ const std::string &name,
+                    _In_ std::uint64_t sci,
+                    _In_ std::uint64_t cipherSuite,
+                    _In_ bool encrypt,
+                    _In_ bool sendSci);
+
+            bool deleteSecY(
+                    _In_ const std::string &name);
+
+            bool setEncodingSa(
+                    _In_ std::uint32_t ifindex,
+                    _In_ std::uint8_t an);
+
+        public: // SC and SA, generic netlink
+
+            /**
+             * @brief Send all requests in single batch.
+             *
+             * All requests are written first and then acknowledges are
+             * collected in order. Result of each request is stored in
+             * results vector.
+             *
+             * @return True if all requests succeeded.
+             */
+            bool execute(
+                    _In_ const std::vector<MACsecNetLinkRequest> &requests,
+                    _Out_ std::vector<bool> &results);
+
+            bool execute(
+                    _In_ const MACsecNetLinkRequest &request);
+
+            /**
+             * @brief Dump all SecY devices with SC, SA packet numbers and statistics.
+             */
+            bool dump(
+                    _Out_ std::map<std::uint32_t, MACsecSecYState> &states);
+
+            bool dump(
+                    _In_ std::uint32_t ifindex,
+                    _Out_ MACsecSecYState &state);
+
+        public:
+
+            static bool parseHex(
+                    _In_ const std::string &hex,
+                    _Out_ std::vector<std::uint8_t> &bytes);
+
+            static bool parseSci(
+                    _In_ const std::string &hex,
+                    _Out_ std::uint64_t &sci);
+
+        private:
+
+            bool connect();
+
+            struct nl_msg* buildRequest(
+                    _In_ const MACsecNetLinkRequest &request) const;
+
+            bool sendRoute(
+                    _In_ struct nl_msg *msg);
+
+            static int onDumpMsg(
+                    _In_ struct nl_msg *msg,
+                    _In_ void *arg);
+
+        private:
+
+            struct nl_sock* m_genlSocket;
+
+            struct nl_sock* m_routeSocket;
+
+            int m_family;
+    };
+}
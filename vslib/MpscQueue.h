@@ -0,0 +1,117 @@
+#pragma once
+
+#include "swss/sal.h"
+#include "swss/logger.h"
+
+#include <atomic>
+
+namespace saivs
+{
+    /**
+     * @brief Multiple producer single consumer queue.
+     *
+     * Producers are lock free (single atomic exchange per push), items are
+     * linked list nodes, first node is always stub node which value was
+     * already consumed. Only one thread can call pop at a time.
+     */
+    template <typename T>
+    class MpscQueue
+    {
+        private:
+
+            MpscQueue(const MpscQueue&) = delete;
+            MpscQueue& operator=(const MpscQueue&) = delete;
+
+        public:
+
+            MpscQueue():
+                m_head(new Node()),
+                m_tail(m_head.load())
+            {
+                SWSS_LOG_ENTER();
+
+                // empty
+            }
+
+            virtual ~MpscQueue()
+            {
+                SWSS_LOG_ENTER();
+
+                T value;
+
+                while (pop(value))
+                {
+                    // discard
+                }
+
+                delete m_tail;
+            }
+
+        public:
+
+            void push(
+                    _In_ const T& value)
+            {
+                SWSS_LOG_ENTER();
+
+                Node* node = new Node(value);
+
+                Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+
+                // between exchange and store consumer will see queue as
+                // empty at prev node, producer must notify consumer after
+                // push returns
+
+                prev->m_next.store(node, std::memory_order_release);
+            }
+
+            bool pop(
+                    _Out_ T& value)
+            {
+                SWSS_LOG_ENTER();
+
+                Node* tail = m_tail;
+
+                Node* next = tail->m_next.load(std::memory_order_acquire);
+
+                if (next == nullptr)
+                {
+                    return false;
+                }
+
+                value = next->m_value;
+
+                m_tail = next;
+
+                delete tail;
+
+                return true;
+            }
+
+        private:
+
+            struct Node
+            {
+                Node():
+                    m_next(nullptr),
+                    m_value()
+                {
+                }
+
+                Node(
+                        _In_ const T& value):
+                    m_next(nullptr),
+                    m_value(value)
+                {
+                }
+
+                std::atomic<Node*> m_next;
+
+                T m_value;
+            };
+
+            std::atomic<Node*> m_head;
+
+            Node* m_tail;
+    };
+}
@@ -0,0 +1,159 @@
+#include "NetLinkStats.h"
+
+#include "swss/logger.h"
+
+#include <netlink/netlink.h>
+#include <netlink/cache.h>
+
+using namespace saivs;
+
+NetLinkStats::NetLinkStats(
+        _In_ std::chrono::milliseconds epoch):
+    m_epoch(epoch),
+    m_valid(false),
+    m_socket(nullptr),
+    m_cache(nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    // empty, socket will be connected on first refresh
+}
+
+NetLinkStats::~NetLinkStats()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_cache)
+    {
+        nl_cache_free(m_cache);
+    }
+
+    if (m_socket)
+    {
+        nl_socket_free(m_socket);
+    }
+}
+
+bool NetLinkStats::connect()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_socket)
+    {
+        return true;
+    }
+
+    m_socket = nl_socket_alloc();
+
+    if (m_socket == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink socket");
+        return false;
+    }
+
+    int err = nl_connect(m_socket, NETLINK_ROUTE);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to connect netlink socket: %s", nl_geterror(err));
+
+        nl_socket_free(m_socket);
+
+        m_socket = nullptr;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool NetLinkStats::refresh()
+{
+    SWSS_LOG_ENTER();
+
+    m_valid = false;
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    // single RTM_GETLINK dump, kernel returns IFLA_STATS64 for every link
+
+    int err = (m_cache == nullptr)
+        ? rtnl_link_alloc_cache(m_socket, AF_UNSPEC, &m_cache)
+        : nl_cache_refill(m_socket, m_cache);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to dump links: %s", nl_geterror(err));
+        return false;
+    }
+
+    m_counters.clear();
+
+    for (auto* obj = nl_cache_get_first(m_cache); obj; obj = nl_cache_get_next(obj))
+    {
+        auto* link = (struct rtnl_link*)obj;
+
+        const char* name = rtnl_link_get_name(link);
+
+        if (name == nullptr)
+        {
+            continue;
+        }
+
+        auto& counters = m_counters[name];
+
+        counters.resize(RTNL_LINK_STATS_MAX + 1);
+
+        for (int id = 0; id <= RTNL_LINK_STATS_MAX; id++)
+        {
+            counters[id] = rtnl_link_get_stat(link, (rtnl_link_stat_id_t)id);
+        }
+    }
+
+    m_lastRefresh = std::chrono::steady_clock::now();
+
+    m_valid = true;
+
+    SWSS_LOG_DEBUG("dumped stats of %zu links", m_counters.size());
+
+    return true;
+}
+
+bool NetLinkStats::getStat(
+        _In_ const std::string& ifName,
+        _In_ rtnl_link_stat_id_t statId,
+        _Out_ uint64_t& counter)
+{
+    SWSS_LOG_ENTER();
+
+    counter = 0;
+
+    if (!m_valid || (std::chrono::steady_clock::now() - m_lastRefresh) >= m_epoch)
+    {
+        if (!refresh())
+        {
+            return false;
+        }
+    }
+
+    auto it = m_counters.find(ifName);
+
+    if (it == m_counters.end())
+    {
+        SWSS_LOG_ERROR("interface %s not found in netlink link dump", ifName.c_str());
+        return false;
+    }
+
+    if ((size_t)statId >= it->second.size())
+    {
+        SWSS_LOG_ERROR("invalid netlink stat id %d", statId);
+        return false;
+    }
+
+    counter = it->second[statId];
+
+    return true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <netlink/route/link.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace saivs
+{
+    /**
+     * @brief Netlink link statistics cache.
+     *
+     * Fetches counters of all host interfaces using single RTM_GETLINK dump
+     * (IFLA_STATS64) instead of reading /sys/class/net/<if>/statistics files
+     * one by one. Dump result is cached for a single poll epoch, so all
+     * counters of all ports queried within that epoch cost one netlink
+     * request.
+     */
+    class NetLinkStats
+    {
+        private:
+
+            NetLinkStats(const NetLinkStats&) = delete;
+            NetLinkStats& operator=(const NetLinkStats&) = delete;
+
+        public:
+
+            NetLinkStats(
+                    _In_ std::chrono::milliseconds epoch = std::chrono::milliseconds(100));
+
+            virtual ~NetLinkStats();
+
+        public:
+
+            /**
+             * @brief Perform RTM_GETLINK dump and update cached counters.
+             *
+             * Starts new poll epoch.
+             */
+            bool refresh();
+
+            /**
+             * @brief Get cached counter of given interface.
+             *
+             * If current epoch expired, dump is performed first.
+             */
+            bool getStat(
+                    _In_ const std::string& ifName,
+                    _In_ rtnl_link_stat_id_t statId,
+                    _Out_ uint64_t& counter);
+
+        private:
+
+            bool connect();
+
+        private:
+
+            typedef std::vector<uint64_t> LinkCounters;
+
+            std::chrono::milliseconds m_epoch;
+
+            std::chrono::steady_clock::time_point m_lastRefresh;
+
+            bool m_valid;
+
+            struct nl_sock* m_socket;
+
+            struct nl_cache* m_cache;
+
+            std::unordered_map<std::string, LinkCounters> m_counters;
+    };
+}
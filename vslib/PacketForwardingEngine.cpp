@@ -0,0 +1,326 @@
+#include "PacketForwardingEngine.h"
+
+#include "swss/logger.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <string.h>
+
+using namespace saivs;
+
+#define MAX_EPOLL_EVENTS 64
+
+// epoll data 0 is reserved for worker stop event
+#define STOP_EVENT_INDEX 0
+
+PacketBatch::PacketBatch():
+    m_buffers(BATCH_SIZE * ETH_FRAME_BUFFER_SIZE),
+    m_controls(BATCH_SIZE * CONTROL_MESSAGE_BUFFER_SIZE)
+{
+    SWSS_LOG_ENTER();
+
+    prepareRecv();
+}
+
+unsigned char* PacketBatch::getBuffer(
+        _In_ unsigned int index)
+{
+    SWSS_LOG_ENTER();
+
+    return m_buffers.data() + index * ETH_FRAME_BUFFER_SIZE;
+}
+
+void PacketBatch::prepareRecv()
+{
+    SWSS_LOG_ENTER();
+
+    memset(m_msgs, 0, sizeof(m_msgs));
+
+    for (unsigned int idx = 0; idx < BATCH_SIZE; idx++)
+    {
+        m_iovs[idx].iov_base = getBuffer(idx);
+        m_iovs[idx].iov_len = ETH_FRAME_BUFFER_SIZE;
+
+        auto& hdr = m_msgs[idx].msg_hdr;
+
+        hdr.msg_name = &m_addrs[idx];
+        hdr.msg_namelen = sizeof(m_addrs[idx]);
+        hdr.msg_iov = &m_iovs[idx];
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = m_controls.data() + idx * CONTROL_MESSAGE_BUFFER_SIZE;
+        hdr.msg_controllen = CONTROL_MESSAGE_BUFFER_SIZE;
+    }
+}
+
+void PacketBatch::prepareSend()
+{
+    SWSS_LOG_ENTER();
+
+    memset(m_msgs, 0, sizeof(m_msgs));
+
+    for (unsigned int idx = 0; idx < BATCH_SIZE; idx++)
+    {
+        m_msgs[idx].msg_hdr.msg_iov = &m_iovs[idx];
+        m_msgs[idx].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+PacketForwardingEngine::Worker::Worker():
+    m_run(true),
+    m_activeIndex(STOP_EVENT_INDEX)
+{
+    SWSS_LOG_ENTER();
+
+    m_epollfd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (m_epollfd < 0)
+    {
+        SWSS_LOG_THROW("epoll_create1 failed, errno(%d): %s", errno, strerror(errno));
+    }
+
+    m_eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (m_eventfd < 0)
+    {
+        close(m_epollfd);
+
+        SWSS_LOG_THROW("eventfd failed, errno(%d): %s", errno, strerror(errno));
+    }
+
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.u64 = STOP_EVENT_INDEX;
+
+    if (epoll_ctl(m_epollfd, EPOLL_CTL_ADD, m_eventfd, &ev) < 0)
+    {
+        close(m_eventfd);
+        close(m_epollfd);
+
+        SWSS_LOG_THROW("failed to add eventfd to epoll, errno(%d): %s", errno, strerror(errno));
+    }
+
+    m_thread = std::make_shared<std::thread>(&Worker::run, this);
+}
+
+PacketForwardingEngine::Worker::~Worker()
+{
+    SWSS_LOG_ENTER();
+
+    m_run = false;
+
+    uint64_t val = 1;
+
+    if (write(m_eventfd, &val, sizeof(val)) < 0)
+    {
+        SWSS_LOG_ERROR("failed to notify worker, errno(%d): %s", errno, strerror(errno));
+    }
+
+    m_thread->join();
+
+    close(m_eventfd);
+    close(m_epollfd);
+}
+
+void PacketForwardingEngine::Worker::run()
+{
+    SWSS_LOG_ENTER();
+
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+
+    while (m_run)
+    {
+        int count = epoll_wait(m_epollfd, events, MAX_EPOLL_EVENTS, -1);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SWSS_LOG_ERROR("epoll_wait failed, errno(%d): %s, ending forwarding worker", errno, strerror(errno));
+            break;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            uint64_t index = events[idx].data.u64;
+
+            if (index == STOP_EVENT_INDEX)
+            {
+                continue;
+            }
+
+            // registration is looked up under lock, so stale events are
+            // ignored, and handler is called after lock is released, so
+            // registering and removing other fds is not blocked by
+            // packet forwarding
+
+            Registration registration;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                auto it = m_registrations.find(index);
+
+                if (it == m_registrations.end())
+                {
+                    continue;
+                }
+
+                registration = it->second;
+
+                m_activeIndex = index;
+            }
+
+            bool watch = registration.handler->onReadable(registration.fd, m_batch);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_activeIndex = STOP_EVENT_INDEX;
+
+                auto it = m_registrations.find(index);
+
+                if (!watch && it != m_registrations.end())
+                {
+                    SWSS_LOG_NOTICE("ending forwarding for fd %d", registration.fd);
+
+                    epoll_ctl(m_epollfd, EPOLL_CTL_DEL, registration.fd, nullptr);
+
+                    m_registrations.erase(it);
+                }
+            }
+
+            m_cvActive.notify_all();
+        }
+    }
+
+    SWSS_LOG_NOTICE("forwarding worker ended");
+}
+
+PacketForwardingEngine::PacketForwardingEngine(
+        _In_ size_t workerCount):
+    m_index(STOP_EVENT_INDEX)
+{
+    SWSS_LOG_ENTER();
+
+    if (workerCount == 0)
+    {
+        SWSS_LOG_THROW("at least one forwarding worker is required");
+    }
+
+    for (size_t idx = 0; idx < workerCount; idx++)
+    {
+        m_workers.push_back(std::make_shared<Worker>());
+    }
+
+    SWSS_LOG_NOTICE("packet forwarding engine started with %zu workers", workerCount);
+}
+
+PacketForwardingEngine::~PacketForwardingEngine()
+{
+    SWSS_LOG_ENTER();
+
+    m_workers.clear(); // joins all workers
+}
+
+std::shared_ptr<PacketForwardingEngine> PacketForwardingEngine::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    static std::shared_ptr<PacketForwardingEngine> instance = std::make_shared<PacketForwardingEngine>();
+
+    return instance;
+}
+
+size_t PacketForwardingEngine::getWorkerCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_workers.size();
+}
+
+PacketForwardingEngine::Worker& PacketForwardingEngine::getWorker(
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return *m_workers.at(index % m_workers.size());
+}
+
+uint64_t PacketForwardingEngine::registerFd(
+        _In_ int fd,
+        _In_ PacketHandler* handler)
+{
+    SWSS_LOG_ENTER();
+
+    if (handler == nullptr)
+    {
+        SWSS_LOG_ERROR("handler is NULL");
+        return STOP_EVENT_INDEX;
+    }
+
+    uint64_t index = ++m_index;
+
+    auto& worker = getWorker(index);
+
+    std::lock_guard<std::mutex> lock(worker.m_mutex);
+
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.u64 = index;
+
+    if (epoll_ctl(worker.m_epollfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+        SWSS_LOG_ERROR("failed to add fd %d to epoll, errno(%d): %s", fd, errno, strerror(errno));
+
+        return STOP_EVENT_INDEX;
+    }
+
+    worker.m_registrations[index] = { fd, handler };
+
+    return index;
+}
+
+void PacketForwardingEngine::unregisterFd(
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index == STOP_EVENT_INDEX)
+    {
+        return;
+    }
+
+    auto& worker = getWorker(index);
+
+    std::unique_lock<std::mutex> lock(worker.m_mutex);
+
+    auto it = worker.m_registrations.find(index);
+
+    if (it == worker.m_registrations.end())
+    {
+        return;
+    }
+
+    // fd could be already closed, which removes it from epoll set
+
+    epoll_ctl(worker.m_epollfd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+
+    worker.m_registrations.erase(it);
+
+    // wait for handler in progress, unless handler unregisters itself
+
+    if (std::this_thread::get_id() != worker.m_thread->get_id())
+    {
+        worker.m_cvActive.wait(lock, [&]{ return worker.m_activeIndex != index; });
+    }
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "TrafficForwarder.h"
+
+#include "swss/sal.h"
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief Packet batch scratch buffers.
+     *
+     * Each forwarding worker owns single batch, which is passed to packet
+     * handlers, so recvmmsg/sendmmsg can be used without per interface
+     * buffers.
+     */
+    class PacketBatch
+    {
+        private:
+
+            PacketBatch(const PacketBatch&) = delete;
+            PacketBatch& operator=(const PacketBatch&) = delete;
+
+        public:
+
+            static constexpr unsigned int BATCH_SIZE = 32;
+
+        public:
+
+            PacketBatch();
+
+            virtual ~PacketBatch() = default;
+
+        public:
+
+            /**
+             * @brief Prepare message headers for recvmmsg, each message is
+             * pointing to its own frame, source address and control buffer.
+             */
+            void prepareRecv();
+
+            /**
+             * @brief Prepare message headers for sendmmsg.
+             */
+            void prepareSend();
+
+            unsigned char* getBuffer(
+                    _In_ unsigned int index);
+
+        public:
+
+            struct mmsghdr m_msgs[BATCH_SIZE];
+
+            struct iovec m_iovs[BATCH_SIZE];
+
+            struct sockaddr_storage m_addrs[BATCH_SIZE];
+
+        private:
+
+            std::vector<unsigned char> m_buffers;
+
+            std::vector<char> m_controls;
+    };
+
+    class PacketHandler
+    {
+        public:
+
+            virtual ~PacketHandler() = default;
+
+        public:
+
+            /**
+             * @brief Called by forwarding worker when fd is readable.
+             *
+             * Handler should read at most one batch of packets, since epoll
+             * is level triggered remaining packets will be reported again.
+             *
+             * @return False if fd should not be watched any more.
+             */
+            virtual bool onReadable(
+                    _In_ int fd,
+                    _In_ PacketBatch& batch) = 0;
+    };
+
+    /**
+     * @brief Shared packet forwarding engine.
+     *
+     * Small fixed pool of workers multiplexes all host interface tap/veth
+     * (and MACsec) fds over epoll, instead of dedicated thread pair per host
+     * interface. Each registered fd is served by single worker, so packet
+     * order per direction is preserved.
+     */
+    class PacketForwardingEngine
+    {
+        private:
+
+            PacketForwardingEngine(const PacketForwardingEngine&) = delete;
+            PacketForwardingEngine& operator=(const PacketForwardingEngine&) = delete;
+
+        public:
+
+            static constexpr size_t DEFAULT_WORKER_COUNT = 4;
+
+        public:
+
+            PacketForwardingEngine(
+                    _In_ size_t workerCount = DEFAULT_WORKER_COUNT);
+
+            virtual ~PacketForwardingEngine();
+
+        public:
+
+            /**
+             * @brief Get process wide engine.
+             *
+             * Engine is shared, so users can keep it alive until they
+             * unregister.
+             */
+            static std::shared_ptr<PacketForwardingEngine> getInstance();
+
+            /**
+             * @brief Register fd for read events.
+             *
+             * @return Registration index, 0 on failure.
+             */
+            uint64_t registerFd(
+                    _In_ int fd,
+                    _In_ PacketHandler* handler);
+
+            /**
+             * @brief Unregister fd.
+             *
+             * When this function returns, handler is not executing and
+             * will not be called any more for this registration.
+             */
+            void unregisterFd(
+                    _In_ uint64_t index);
+
+            size_t getWorkerCount() const;
+
+        private:
+
+            class Worker
+            {
+                public:
+
+                    Worker();
+
+                    ~Worker();
+
+                public:
+
+                    void run();
+
+                public:
+
+                    struct Registration
+                    {
+                        int fd;
+
+                        PacketHandler* handler;
+                    };
+
+                    int m_epollfd;
+
+                    int m_eventfd;
+
+                    std::atomic<bool> m_run;
+
+                    std::mutex m_mutex;
+
+                    std::unordered_map<uint64_t, Registration> m_registrations;
+
+                    /**
+                     * @brief Registration which handler is executing,
+                     * handler is called without holding mutex.
+                     */
+                    uint64_t m_activeIndex;
+
+                    std::condition_variable m_cvActive;
+
+                    std::shared_ptr<std::thread> m_thread;
+
+                    PacketBatch m_batch;
+            };
+
+            Worker& getWorker(
+                    _In_ uint64_t index);
+
+        private:
+
+            std::vector<std::shared_ptr<Worker>> m_workers;
+
+            std::atomic<uint64_t> m_index;
+    };
+}
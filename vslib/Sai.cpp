@@ -43,6 +43,8 @@ Sai::Sai()
     m_apiInitialized = false;
 
     m_globalContext = 0;
+
+    m_warm_boot_text_format = false;
 }
 
 Sai::~Sai()
@@ -134,6 +136,10 @@ sai_status_t Sai::apiInitialize(
     m_warm_boot_read_file   = service_method_table->profile_get_value(0, SAI_KEY_WARM_BOOT_READ_FILE);
     m_warm_boot_write_file  = service_method_table->profile_get_value(0, SAI_KEY_WARM_BOOT_WRITE_FILE);
 
+    const char *warm_boot_text_format = service_method_table->profile_get_value(0, SAI_KEY_VS_WARM_BOOT_TEXT_FORMAT);
+
+    m_warm_boot_text_format = SwitchConfig::parseBool(warm_boot_text_format);
+
     sai_vs_boot_type_t bootType;
 
     if (!SwitchConfig::parseBootType(boot_type, bootType))
@@ -219,6 +225,9 @@ sai_status_t Sai::apiInitialize(
 
     m_eventQueue = std::make_shared<EventQueue>(m_signal);
 
+    m_fdbLearner = std::make_shared<FdbLearner>(
+            std::bind(&Sai::syncProcessFdbLearnBatch, this, std::placeholders::_1));
+
     for (auto& sc: scc->getSwitchConfigs())
     {
         // NOTE: switch index and hardware info is already populated
@@ -244,6 +253,7 @@ sai_status_t Sai::apiInitialize(
         }
 
         sc->m_eventQueue = m_eventQueue;
+        sc->m_fdbLearner = m_fdbLearner;
         sc->m_resourceLimiter = m_resourceLimiterContainer->getResourceLimiter(sc->m_switchIndex);
         sc->m_corePortIndexMap = m_corePortIndexMapContainer->getCorePortIndexMap(sc->m_switchIndex);
     }
@@ -273,6 +283,8 @@ sai_status_t Sai::apiInitialize(
 
     startEventQueueThread();
 
+    startFdbLearner();
+
     startUnittestThread();
 
     if (saiSwitchType == SAI_SWITCH_TYPE_NPU)
@@ -300,6 +312,8 @@ sai_status_t Sai::apiUninitialize(void)
 
     stopUnittestThread();
 
+    stopFdbLearner();
+
     stopFdbAgingThread();
 
     stopEventQueueThread();
@@ -311,7 +325,7 @@ sai_status_t Sai::apiUninitialize(void)
 
     // clear state after ending all threads
 
-    m_vsSai->writeWarmBootFile(m_warm_boot_write_file);
+    m_vsSai->writeWarmBootFile(m_warm_boot_write_file, m_warm_boot_text_format);
 
     m_vsSai = nullptr;
     m_meta = nullptr;
@@ -560,7 +574,18 @@ sai_status_t Sai::bulkGetStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    // meta don't validate bulk stats yet, so pass directly to switch state
+
+    return m_vsSai->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -4,6 +4,7 @@
 #include "LaneMapContainer.h"
 #include "EventQueue.h"
 #include "EventPayloadNotification.h"
+#include "FdbLearner.h"
 #include "ResourceLimiterContainer.h"
 #include "CorePortIndexMapContainer.h"
 #include "Context.h"
@@ -244,6 +245,15 @@ namespace saivs
 
             void stopFdbAgingThread();
 
+        private: // FDB learning
+
+            void syncProcessFdbLearnBatch(
+                    _In_ const std::vector<FdbLearnEvent>& events);
+
+            void startFdbLearner();
+
+            void stopFdbLearner();
+
         private: // event queue
 
             void startEventQueueThread();
@@ -284,6 +294,10 @@ namespace saivs
 
             std::shared_ptr<std::thread> m_fdbAgingThread;
 
+        private: // FDB learning
+
+            std::shared_ptr<FdbLearner> m_fdbLearner;
+
         private: // event queue
 
             bool m_eventQueueThreadRun;
@@ -315,6 +329,8 @@ namespace saivs
 
             const char *m_warm_boot_write_file;
 
+            bool m_warm_boot_text_format;
+
             std::shared_ptr<LaneMapContainer> m_laneMapContainer;
 
             std::shared_ptr<LaneMapContainer> m_fabricLaneMapContainer;
@@ -0,0 +1,39 @@
+#include "Sai.h"
+#include "SaiInternal.h"
+
+#include "swss/logger.h"
+
+using namespace saivs;
+
+void Sai::startFdbLearner()
+{
+    SWSS_LOG_ENTER();
+
+    m_fdbLearner->start();
+}
+
+void Sai::stopFdbLearner()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    // hostif interfaces may still hold learner, events enqueued after
+    // this point will not be processed
+
+    m_fdbLearner->stop();
+
+    SWSS_LOG_NOTICE("end, dropped %" PRIu64 " learn events", m_fdbLearner->getDroppedCount());
+}
+
+void Sai::syncProcessFdbLearnBatch(
+        _In_ const std::vector<FdbLearnEvent>& events)
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+
+    // must be executed under mutex since
+    // this call comes from learner thread
+
+    m_vsSai->syncProcessFdbLearnBatch(events);
+}
@@ -2,6 +2,7 @@
 
 #include "LaneMap.h"
 #include "EventQueue.h"
+#include "FdbLearner.h"
 #include "ResourceLimiter.h"
 #include "CorePortIndexMap.h"
 
@@ -96,6 +97,8 @@ namespace saivs
 
             std::shared_ptr<EventQueue> m_eventQueue;
 
+            std::shared_ptr<FdbLearner> m_fdbLearner;
+
             std::shared_ptr<ResourceLimiter> m_resourceLimiter;
 
             std::shared_ptr<CorePortIndexMap> m_corePortIndexMap;
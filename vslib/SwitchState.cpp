@@ -17,16 +17,16 @@ using namespace saivs;
 
 #define VS_COUNTERS_COUNT_MSB (0x80000000)
 
-const std::map<sai_stat_id_t, std::string> SwitchState::m_statIdMap =
+const std::map<sai_stat_id_t, rtnl_link_stat_id_t> SwitchState::m_statIdMap =
 {
-        { SAI_PORT_STAT_IF_IN_OCTETS, "rx_bytes" },
-        { SAI_PORT_STAT_IF_IN_UCAST_PKTS, "rx_packets" },
-        { SAI_PORT_STAT_IF_IN_ERRORS, "rx_errors" },
-        { SAI_PORT_STAT_IF_IN_DISCARDS, "rx_dropped" },
-        { SAI_PORT_STAT_IF_OUT_OCTETS, "tx_bytes" },
-        { SAI_PORT_STAT_IF_OUT_UCAST_PKTS, "tx_packets" },
-        { SAI_PORT_STAT_IF_OUT_ERRORS, "tx_errors" },
-        { SAI_PORT_STAT_IF_OUT_DISCARDS, "tx_dropped" }
+        { SAI_PORT_STAT_IF_IN_OCTETS, RTNL_LINK_RX_BYTES },
+        { SAI_PORT_STAT_IF_IN_UCAST_PKTS, RTNL_LINK_RX_PACKETS },
+        { SAI_PORT_STAT_IF_IN_ERRORS, RTNL_LINK_RX_ERRORS },
+        { SAI_PORT_STAT_IF_IN_DISCARDS, RTNL_LINK_RX_DROPPED },
+        { SAI_PORT_STAT_IF_OUT_OCTETS, RTNL_LINK_TX_BYTES },
+        { SAI_PORT_STAT_IF_OUT_UCAST_PKTS, RTNL_LINK_TX_PACKETS },
+        { SAI_PORT_STAT_IF_OUT_ERRORS, RTNL_LINK_TX_ERRORS },
+        { SAI_PORT_STAT_IF_OUT_DISCARDS, RTNL_LINK_TX_DROPPED }
 };
 
 SwitchState::SwitchState(
@@ -213,7 +213,7 @@ void SwitchState::asyncOnLinkMsg(
 
 sai_status_t SwitchState::getNetStat(
         _In_ sai_stat_id_t counterId,
-        _In_ std::string& ifName,
+        _In_ const std::string& ifName,
         _Out_ uint64_t& counter)
 {
     SWSS_LOG_ENTER();
@@ -222,16 +222,11 @@ sai_status_t SwitchState::getNetStat(
 
     if (mapit != SwitchState::m_statIdMap.end())
     {
-        std::string filename = "/sys/class/net/" + ifName + "/statistics/" + mapit->second;
-        std::ifstream istrm(filename.c_str(), std::ifstream::in);
+        // all host interfaces are fetched by single netlink dump per poll epoch
 
-        if (istrm.good())
+        if (!m_netLinkStats.getStat(ifName, mapit->second, counter))
         {
-            istrm >> counter;
-        }
-        else
-        {
-            SWSS_LOG_ERROR("failed to open ifstream in file %s", filename.c_str());
+            SWSS_LOG_ERROR("failed to get netlink stat %d on %s", mapit->second, ifName.c_str());
             counter = -1;
             return SAI_STATUS_FAILURE;
         }
@@ -363,6 +358,66 @@ sai_status_t SwitchState::getStatsExt(
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t SwitchState::bulkGetStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    sai_stats_mode_t objectMode;
+
+    switch (mode)
+    {
+        case SAI_STATS_MODE_BULK_READ:
+            objectMode = SAI_STATS_MODE_READ;
+            break;
+
+        case SAI_STATS_MODE_BULK_READ_AND_CLEAR:
+            objectMode = SAI_STATS_MODE_READ_AND_CLEAR;
+            break;
+
+        default:
+            SWSS_LOG_ERROR("unsupported bulk stats mode %d", mode);
+            return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    if (object_type == SAI_OBJECT_TYPE_PORT)
+    {
+        /*
+         * Start new poll epoch, so counters of all ports in this bulk are
+         * served from single netlink dump.
+         */
+
+        m_netLinkStats.refresh();
+    }
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = getStatsExt(
+                object_type,
+                object_key[idx].key.object_id,
+                number_of_counters,
+                counter_ids,
+                objectMode,
+                &counters[(size_t)idx * number_of_counters]);
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
 sai_status_t SwitchState::queryStatsCapability(
         _In_ sai_object_id_t switchId,
         _In_ sai_object_type_t objectType,
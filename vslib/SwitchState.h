@@ -6,6 +6,7 @@ extern "C" {
 
 #include "SaiAttrWrap.h"
 #include "SwitchConfig.h"
+#include "NetLinkStats.h"
 
 #include "meta/Meta.h"
 
@@ -56,6 +57,16 @@ namespace saivs
                     _In_ sai_stats_mode_t mode,
                     _Out_ uint64_t *counters);
 
+            virtual sai_status_t bulkGetStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
             sai_status_t queryStatsCapability(
                     _In_ sai_object_id_t switchId,
                     _In_ sai_object_type_t objectType,
@@ -98,10 +109,10 @@ namespace saivs
                     _In_ const sai_stat_id_t counterId,
                     _Out_ uint64_t& counter);
 
-           sai_status_t getNetStat(
-                   _In_ sai_stat_id_t counterId,
-                   _In_ std::string& ifName,
-                   _Out_ uint64_t& counter);
+            sai_status_t getNetStat(
+                    _In_ sai_stat_id_t counterId,
+                    _In_ const std::string& ifName,
+                    _Out_ uint64_t& counter);
 
         protected:
 
@@ -137,7 +148,9 @@ namespace saivs
 
         private : // port counter mapping
 
-            static const std::map<sai_stat_id_t, std::string> m_statIdMap;
+            static const std::map<sai_stat_id_t, rtnl_link_stat_id_t> m_statIdMap;
+
+            NetLinkStats m_netLinkStats;
 
         protected:
 
@@ -4,6 +4,7 @@
 #include "meta/sai_serialize.h"
 #include "meta/NotificationTamTelTypeConfigChange.h"
 #include "EventPayloadNotification.h"
+#include "WarmBootSnapshot.h"
 
 #include <net/if.h>
 #include <unistd.h>
@@ -3233,40 +3234,26 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
 {
     SWSS_LOG_ENTER();
 
-    std::stringstream ss;
+    return WarmBootSnapshot::toText(get_warm_boot_state());
+}
 
-    const auto& objectHash = m_objectHash;
+WarmBootState SwitchStateBase::get_warm_boot_state() const
+{
+    SWSS_LOG_ENTER();
 
-    // dump all objects and attributes to file
+    WarmBootState state;
 
-    size_t count = 0;
+    state.m_switchId = m_switch_id;
 
-    for (auto kvp: objectHash)
-    {
-        auto singleTypeObjectMap = kvp.second;
+    // attributes are shared, switch is about to be removed
 
-        count += singleTypeObjectMap.size();
+    state.m_objectHash = m_objectHash;
 
-        for (auto o: singleTypeObjectMap)
-        {
-            // if object don't have attributes, size can be zero
-            if (o.second.size() == 0)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " " << o.first << " NULL NULL" << std::endl;
-                continue;
-            }
+    size_t count = 0;
 
-            for (auto a: o.second)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " ";
-                ss << o.first.c_str();
-                ss << " ";
-                ss << a.first.c_str();
-                ss << " ";
-                ss << a.second->getAttrStrValue();
-                ss << std::endl;
-            }
-        }
+    for (auto& kvp: m_objectHash)
+    {
+        count += kvp.second.size();
     }
 
     if (m_switchConfig->m_useTapDevice)
@@ -3276,10 +3263,7 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
          * data and restore it on warm start.
          */
 
-        for (auto fi: m_fdb_info_set)
-        {
-            ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
-        }
+        state.m_fdbInfoSet = m_fdb_info_set;
 
         SWSS_LOG_NOTICE("dumped %zu fdb infos for switch %s",
                 m_fdb_info_set.size(),
@@ -3290,7 +3274,7 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
             count,
             sai_serialize_object_id(m_switch_id).c_str());
 
-    return ss.str();
+    return state;
 }
 
 sai_object_type_t SwitchStateBase::objectTypeQuery(
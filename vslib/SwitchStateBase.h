@@ -2,6 +2,7 @@
 
 #include "SwitchState.h"
 #include "FdbInfo.h"
+#include "FdbLearner.h"
 #include "HostInterfaceInfo.h"
 #include "WarmBootState.h"
 #include "SwitchConfig.h"
@@ -383,6 +384,17 @@ namespace saivs
             bool isLagOrPortRifBased(
                     _In_ sai_object_id_t lag_or_port_id);
 
+            /**
+             * @brief Learn MAC from event, updates timestamp of already
+             * learned entry.
+             *
+             * @return True if new entry was learned and notification
+             * should be sent.
+             */
+            bool learnFdbEntry(
+                    _In_ const FdbLearnEvent& event,
+                    _Out_ FdbInfo& fi);
+
         public:
 
             void process_packet_for_fdb_event(
@@ -391,6 +403,13 @@ namespace saivs
                     _In_ const uint8_t *buffer,
                     _In_ size_t size);
 
+            /**
+             * @brief Learn batch of events from FDB learner, single FDB
+             * event notification is sent for all learned entries.
+             */
+            void process_fdb_learn_batch(
+                    _In_ const std::vector<FdbLearnEvent>& events);
+
             void debugSetStats(
                     _In_ sai_object_id_t oid,
                     _In_ const std::map<sai_stat_id_t, uint64_t>& stats);
@@ -543,12 +562,23 @@ namespace saivs
 
             std::string dump_switch_database_for_warm_restart() const;
 
+            /**
+             * @brief Get copy of switch state which is saved on warm restart.
+             *
+             * FDB infos are included only when tap devices are used.
+             */
+            WarmBootState get_warm_boot_state() const;
+
             void syncOnLinkMsg(
                     _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload);
 
             void send_fdb_event_notification(
                     _In_ const sai_fdb_event_notification_data_t& data);
 
+            void send_fdb_event_notification(
+                    _In_ uint32_t count,
+                    _In_ const sai_fdb_event_notification_data_t* data);
+
         protected: // Telemetry and Monitor
 
             void send_tam_tel_type_config_change(
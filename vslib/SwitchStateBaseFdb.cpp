@@ -7,9 +7,6 @@
 #include "meta/sai_serialize.h"
 #include "meta/NotificationFdbEvent.h"
 
-#include <linux/if_ether.h>
-#include <arpa/inet.h>
-
 using namespace saivs;
 
 void SwitchStateBase::updateLocalDB(
@@ -395,47 +392,88 @@ void SwitchStateBase::process_packet_for_fdb_event(
     // we would need hostif info here and maybe interface index, then we can
     // find host info from index
 
-    uint32_t frametime = (uint32_t)time(NULL);
-
-    /*
-     * We add +2 in case if frame contains 1Q VLAN tag.
-     */
+    FdbLearnEvent event;
 
-    if (size < (sizeof(ethhdr) + 2))
+    if (!FdbLearner::parseFrame(buffer, size, event))
     {
-        SWSS_LOG_WARN("ethernet frame is too small: %zu", size);
+        SWSS_LOG_WARN("skipping mac learn for invalid ethernet frame on %s", name.c_str());
         return;
     }
 
-    const ethhdr *eh = (const ethhdr*)buffer;
+    event.portId = portId;
+    event.timestamp = (uint32_t)time(NULL);
 
-    uint16_t proto = htons(eh->h_proto);
-
-    uint16_t vlan_id = DEFAULT_VLAN_NUMBER;
-
-    bool tagged = (proto == ETH_P_8021Q);
+    FdbInfo fi;
 
-    if (tagged)
+    if (learnFdbEntry(event, fi))
     {
-        // this is tagged frame, get vlan id from frame
+        processFdbInfo(fi, SAI_FDB_EVENT_LEARNED);
+    }
+}
 
-        uint16_t tci = htons(((const uint16_t*)&eh->h_proto)[1]); // tag is after h_proto field
+void SwitchStateBase::process_fdb_learn_batch(
+        _In_ const std::vector<FdbLearnEvent>& events)
+{
+    SWSS_LOG_ENTER();
 
-        vlan_id = tci & 0xfff;
+    std::vector<FdbInfo> learned;
 
-        if (vlan_id == 0xfff)
-        {
-            SWSS_LOG_WARN("invalid vlan id %u in ethernet frame on %s", vlan_id, name.c_str());
-            return;
-        }
+    for (auto& event: events)
+    {
+        FdbInfo fi;
 
-        if (vlan_id == 0)
+        if (learnFdbEntry(event, fi))
         {
-            // priority packet, frame should be treated as non tagged
-            tagged = false;
+            learned.push_back(fi);
         }
     }
 
+    if (learned.empty())
+    {
+        return;
+    }
+
+    std::vector<sai_attribute_t> attrs(2 * learned.size());
+
+    std::vector<sai_fdb_event_notification_data_t> data(learned.size());
+
+    for (size_t idx = 0; idx < learned.size(); idx++)
+    {
+        sai_attribute_t* attr = &attrs[2 * idx];
+
+        attr[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+        attr[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+        attr[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+        attr[1].value.oid = learned[idx].getBridgePortId();
+
+        data[idx].event_type = SAI_FDB_EVENT_LEARNED;
+        data[idx].fdb_entry = learned[idx].getFdbEntry();
+        data[idx].attr_count = 2;
+        data[idx].attr = attr;
+
+        updateLocalDB(data[idx], SAI_FDB_EVENT_LEARNED);
+    }
+
+    // single notification for whole batch
+
+    send_fdb_event_notification((uint32_t)data.size(), data.data());
+}
+
+bool SwitchStateBase::learnFdbEntry(
+        _In_ const FdbLearnEvent& event,
+        _Out_ FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t portId = event.portId;
+
+    uint32_t frametime = event.timestamp;
+
+    uint16_t vlan_id = event.tagged ? event.vlanId : DEFAULT_VLAN_NUMBER;
+
+    bool tagged = event.tagged;
+
     if (tagged == false)
     {
         // untagged ethernet frame
@@ -458,7 +496,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
             {
                 SWSS_LOG_WARN("failed to get lag vlan id from lag %s",
                         sai_serialize_object_id(lag_id).c_str());
-                return;
+                return false;
             }
 
             vlan_id = attr.value.u16;
@@ -466,7 +504,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
             if (isLagOrPortRifBased(lag_id))
             {
                 // this lag is router interface based, skip mac learning
-                return;
+                return false;
             }
         }
         else
@@ -480,7 +518,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
             {
                 SWSS_LOG_WARN("failed to get port vlan id from port %s",
                         sai_serialize_object_id(portId).c_str());
-                return;
+                return false;
             }
 
             // untagged port vlan (default is 1, but may change setting port attr)
@@ -494,25 +532,25 @@ void SwitchStateBase::process_packet_for_fdb_event(
         SWSS_LOG_DEBUG("lag %s is rif based, skip mac learning for port %s",
                 sai_serialize_object_id(lag_id).c_str(),
                 sai_serialize_object_id(portId).c_str());
-        return;
+        return false;
     }
 
     if (isLagOrPortRifBased(portId))
     {
         SWSS_LOG_DEBUG("port %s is rif based, skip mac learning",
                 sai_serialize_object_id(portId).c_str());
-        return;
+        return false;
     }
 
     // we have vlan and mac address which is KEY, so just see if that is already defined
 
-    FdbInfo fi;
+    fi = FdbInfo();
 
     fi.setPortId((lag_id != SAI_NULL_OBJECT_ID) ? lag_id : portId);
 
     fi.setVlanId(vlan_id);
 
-    memcpy(fi.m_fdbEntry.mac_address, eh->h_source, sizeof(sai_mac_t));
+    memcpy(fi.m_fdbEntry.mac_address, event.mac, sizeof(sai_mac_t));
 
     std::set<FdbInfo>::iterator it = m_fdb_info_set.find(fi);
 
@@ -527,7 +565,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
         m_fdb_info_set.insert(fi);
 
-        return;
+        return false;
     }
 
     // key was not found, get additional information
@@ -544,7 +582,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
                 sai_serialize_fdb_entry(fi.getFdbEntry()).c_str());
 
         // bridge was not found, skip mac learning
-        return;
+        return false;
     }
 
     sai_attribute_t attr;
@@ -563,7 +601,7 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
             m_fdb_info_set.insert(fi);
 
-            processFdbInfo(fi, SAI_FDB_EVENT_LEARNED);
+            return true;
         }
         else if (attr.value.s32 == SAI_BRIDGE_PORT_FDB_LEARNING_MODE_DISABLE)
         {
@@ -582,6 +620,8 @@ void SwitchStateBase::process_packet_for_fdb_event(
                 sai_serialize_object_id(fi.getBridgePortId()).c_str(),
                 sai_serialize_status(status).c_str());
     }
+
+    return false;
 }
 
 void SwitchStateBase::send_fdb_event_notification(
@@ -589,11 +629,20 @@ void SwitchStateBase::send_fdb_event_notification(
 {
     SWSS_LOG_ENTER();
 
+    send_fdb_event_notification(1, &data);
+}
+
+void SwitchStateBase::send_fdb_event_notification(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t* data)
+{
+    SWSS_LOG_ENTER();
+
     auto meta = getMeta();
 
     if (meta)
     {
-        meta->meta_sai_on_fdb_event(1, &data);
+        meta->meta_sai_on_fdb_event(count, data);
     }
 
     sai_attribute_t attr;
@@ -610,7 +659,7 @@ void SwitchStateBase::send_fdb_event_notification(
         return;
     }
 
-    auto str = sai_serialize_fdb_event_ntf(1, &data);
+    auto str = sai_serialize_fdb_event_ntf(count, data);
 
     sai_switch_notifications_t sn = { };
 
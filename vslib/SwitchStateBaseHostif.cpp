@@ -506,9 +506,10 @@ bool SwitchStateBase::hostif_create_tap_veth_forwarding(
                 tapfd,
                 tapname,
                 port_id,
-                m_switchConfig->m_eventQueue);
+                m_switchConfig->m_eventQueue,
+                m_switchConfig->m_fdbLearner);
 
-    m_hostif_info_map[tapname]->runThreads();
+    m_hostif_info_map[tapname]->startForwarding();
 
     SWSS_LOG_NOTICE("setup forward rule for %s succeeded", tapname.c_str());
 
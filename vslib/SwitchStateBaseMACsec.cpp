@@ -67,38 +67,53 @@ sai_status_t SwitchStateBase::setAclEntryMACsecFlowActive(
 
         if (loadMACsecAttrsFromACLEntry(entryId, attr, SAI_OBJECT_TYPE_MACSEC_SA, macsecAttrs) == SAI_STATUS_SUCCESS)
         {
-            // In Linux MACsec model, Egress SA need to be created before ingress SA
+            std::vector<MACsecAttr> egressAttrs;
+            std::vector<MACsecAttr> ingressAttrs;
+
             for (auto &macsecAttr : macsecAttrs)
             {
                 if (macsecAttr.m_direction == SAI_MACSEC_DIRECTION_EGRESS)
                 {
-                    if (m_macsecManager.create_macsec_sa(macsecAttr))
-                    {
-                        SWSS_LOG_NOTICE(
-                            "Enable MACsec SA %s:%u at the device %s",
-                            macsecAttr.m_sci.c_str(),
-                            static_cast<std::uint32_t>(macsecAttr.m_an),
-                            macsecAttr.m_macsecName.c_str());
-                    }
+                    egressAttrs.push_back(macsecAttr);
+                }
+                else
+                {
+                    ingressAttrs.push_back(macsecAttr);
                 }
             }
 
-            for (auto &macsecAttr : macsecAttrs)
+            std::vector<bool> results;
+
+            // In Linux MACsec model, Egress SA need to be created before ingress SA
+            m_macsecManager.create_macsec_sa(egressAttrs, results);
+
+            for (size_t idx = 0; idx < egressAttrs.size(); idx++)
             {
-                if (macsecAttr.m_direction == SAI_MACSEC_DIRECTION_INGRESS)
+                if (results[idx])
                 {
-                    if (m_macsecManager.create_macsec_sa(macsecAttr))
-                    {
-                        SWSS_LOG_NOTICE(
-                            "Enable MACsec SA %s:%u at the device %s",
-                            macsecAttr.m_sci.c_str(),
-                            static_cast<std::uint32_t>(macsecAttr.m_an),
-                            macsecAttr.m_macsecName.c_str());
-                    }
-                    else
-                    {
-                        m_uncreatedIngressMACsecSAs.insert(macsecAttr);
-                    }
+                    SWSS_LOG_NOTICE(
+                        "Enable MACsec SA %s:%u at the device %s",
+                        egressAttrs[idx].m_sci.c_str(),
+                        static_cast<std::uint32_t>(egressAttrs[idx].m_an),
+                        egressAttrs[idx].m_macsecName.c_str());
+                }
+            }
+
+            m_macsecManager.create_macsec_sa(ingressAttrs, results);
+
+            for (size_t idx = 0; idx < ingressAttrs.size(); idx++)
+            {
+                if (results[idx])
+                {
+                    SWSS_LOG_NOTICE(
+                        "Enable MACsec SA %s:%u at the device %s",
+                        ingressAttrs[idx].m_sci.c_str(),
+                        static_cast<std::uint32_t>(ingressAttrs[idx].m_an),
+                        ingressAttrs[idx].m_macsecName.c_str());
+                }
+                else
+                {
+                    m_uncreatedIngressMACsecSAs.insert(ingressAttrs[idx]);
                 }
             }
         }
@@ -926,23 +941,32 @@ void SwitchStateBase::retryCreateIngressMaCsecSAs()
 {
     SWSS_LOG_ENTER();
 
-    auto itr = m_uncreatedIngressMACsecSAs.begin();
+    if (m_uncreatedIngressMACsecSAs.empty())
+    {
+        return;
+    }
+
+    // Pending SAs of all ports are retried in single batch
 
-    while (itr != m_uncreatedIngressMACsecSAs.end())
+    std::vector<MACsecAttr> macsecAttrs(
+            m_uncreatedIngressMACsecSAs.begin(),
+            m_uncreatedIngressMACsecSAs.end());
+
+    std::vector<bool> results;
+
+    m_macsecManager.create_macsec_sa(macsecAttrs, results);
+
+    for (size_t idx = 0; idx < macsecAttrs.size(); idx++)
     {
-        if (m_macsecManager.create_macsec_sa(*itr))
+        if (results[idx])
         {
             SWSS_LOG_NOTICE(
                 "Enable MACsec SA %s:%u at the device %s",
-                itr->m_sci.c_str(),
-                static_cast<std::uint32_t>(itr->m_an),
-                itr->m_macsecName.c_str());
+                macsecAttrs[idx].m_sci.c_str(),
+                static_cast<std::uint32_t>(macsecAttrs[idx].m_an),
+                macsecAttrs[idx].m_macsecName.c_str());
 
-            itr = m_uncreatedIngressMACsecSAs.erase(itr);
-        }
-        else
-        {
-            itr ++;
+            m_uncreatedIngressMACsecSAs.erase(macsecAttrs[idx]);
         }
     }
 }
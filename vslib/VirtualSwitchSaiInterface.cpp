@@ -10,6 +10,7 @@
 #include "meta/Globals.h"
 
 #include "SwitchStateBase.h"
+#include "WarmBootSnapshot.h"
 #include "SwitchBCM81724.h"
 #include "SwitchBCM56850.h"
 #include "SwitchBCM56971B0.h"
@@ -765,7 +766,7 @@ sai_status_t VirtualSwitchSaiInterface::remove(
 
             if (attr.value.booldata)
             {
-                m_warmBootData[switchId] = ss->dump_switch_database_for_warm_restart();
+                m_warmBootData[switchId] = ss->get_warm_boot_state();
             }
         }
         else
@@ -1164,7 +1165,46 @@ sai_status_t VirtualSwitchSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    if (object_count == 0 || object_key == nullptr || counter_ids == nullptr ||
+            object_statuses == nullptr || counters == nullptr)
+    {
+        SWSS_LOG_ERROR("invalid bulk get stats parameters");
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (switchId == SAI_NULL_OBJECT_ID)
+    {
+        // syncd passes null switch id, resolve it as in getStatsExt
+
+        if (m_switchStateMap.size() == 1)
+        {
+            switchId = m_switchStateMap.begin()->first;
+        }
+        else
+        {
+            switchId = switchIdQuery(object_key[0].key.object_id);
+        }
+    }
+
+    if (m_switchStateMap.find(switchId) == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    auto ss = m_switchStateMap.at(switchId);
+
+    return ss->bulkGetStats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
@@ -1391,10 +1431,21 @@ sai_status_t VirtualSwitchSaiInterface::queryApiVersion(
 }
 
 bool VirtualSwitchSaiInterface::writeWarmBootFile(
-        _In_ const char* warmBootFile) const
+        _In_ const char* warmBootFile,
+        _In_ bool textFormat) const
 {
     SWSS_LOG_ENTER();
 
+    if (warmBootFile && !textFormat)
+    {
+        if (m_warmBootData.size() == 0)
+        {
+            SWSS_LOG_WARN("warm boot data is empty, is that what you want?");
+        }
+
+        return WarmBootSnapshot::write(warmBootFile, m_warmBootData);
+    }
+
     if (warmBootFile)
     {
         std::ofstream ofs;
@@ -1414,7 +1465,7 @@ bool VirtualSwitchSaiInterface::writeWarmBootFile(
 
         for (auto& kvp: m_warmBootData)
         {
-            ofs << kvp.second;
+            ofs << WarmBootSnapshot::toText(kvp.second);
         }
 
         ofs.close();
@@ -1447,6 +1498,77 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
         SWSS_LOG_NOTICE("%s file size: %zu", warmBootFile, (size_t)in.tellg());
     }
 
+    bool success = WarmBootSnapshot::isSnapshot(warmBootFile)
+        ? readWarmBootSnapshot(warmBootFile)
+        : readWarmBootText(warmBootFile);
+
+    if (success)
+    {
+        logWarmBootState(warmBootFile);
+    }
+
+    return success;
+}
+
+bool VirtualSwitchSaiInterface::readWarmBootSnapshot(
+        _In_ const char* warmBootFile)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_id_t, WarmBootState> states;
+
+    if (!WarmBootSnapshot::read(warmBootFile, states))
+    {
+        SWSS_LOG_ERROR("failed to read warm boot snapshot %s", warmBootFile);
+
+        return false;
+    }
+
+    for (auto& kvp: states)
+    {
+        if (RealObjectIdManager::objectTypeQuery(kvp.first) != SAI_OBJECT_TYPE_SWITCH)
+        {
+            SWSS_LOG_ERROR("snapshot contains invalid switch id %s",
+                    sai_serialize_object_id(kvp.first).c_str());
+
+            return false;
+        }
+
+        for (auto& ot: kvp.second.m_objectHash)
+        {
+            auto info = sai_metadata_get_object_type_info(ot.first);
+
+            if (info == NULL || !info->isobjectid)
+            {
+                continue;
+            }
+
+            /*
+             * Same as in text format, we need biggest object index so new
+             * objects created after warm boot will not collide with loaded
+             * ones.
+             */
+
+            for (auto& o: ot.second)
+            {
+                sai_object_id_t oid;
+                sai_deserialize_object_id(o.first, oid);
+
+                m_realObjectIdManager->updateWarmBootObjectIndex(oid);
+            }
+        }
+    }
+
+    m_warmBootState.swap(states);
+
+    return true;
+}
+
+bool VirtualSwitchSaiInterface::readWarmBootText(
+        _In_ const char* warmBootFile)
+{
+    SWSS_LOG_ENTER();
+
     std::ifstream ifs;
 
     ifs.open(warmBootFile);
@@ -1552,6 +1674,14 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
 
     ifs.close();
 
+    return true;
+}
+
+void VirtualSwitchSaiInterface::logWarmBootState(
+        _In_ const char* warmBootFile) const
+{
+    SWSS_LOG_ENTER();
+
     SWSS_LOG_NOTICE("warm boot file %s stats, loaded switches: %zu", warmBootFile, m_warmBootState.size());
 
     for (auto& kvp: m_warmBootState)
@@ -1571,8 +1701,6 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
                 sai_serialize_object_id(kvp.first).c_str(),
                 kvp.second.m_fdbInfoSet.size());
     }
-
-    return true;
 }
 
 void VirtualSwitchSaiInterface::debugSetStats(
@@ -1633,6 +1761,38 @@ void VirtualSwitchSaiInterface::syncProcessEventPacket(
             buffer.getSize());
 }
 
+void VirtualSwitchSaiInterface::syncProcessFdbLearnBatch(
+        _In_ const std::vector<FdbLearnEvent>& events)
+{
+    SWSS_LOG_ENTER();
+
+    // this method is executed under mutex, but from learner thread so actual
+    // switch may not exists, events are grouped per switch to send single
+    // notification per switch
+
+    std::map<sai_object_id_t, std::vector<FdbLearnEvent>> switchEvents;
+
+    for (auto& event: events)
+    {
+        switchEvents[switchIdQuery(event.portId)].push_back(event);
+    }
+
+    for (auto& kvp: switchEvents)
+    {
+        auto it = m_switchStateMap.find(kvp.first);
+
+        if (it == m_switchStateMap.end())
+        {
+            SWSS_LOG_WARN("switch %s don't exists in switch state map",
+                    sai_serialize_object_id(kvp.first).c_str());
+
+            continue;
+        }
+
+        it->second->process_fdb_learn_batch(kvp.second);
+    }
+}
+
 void VirtualSwitchSaiInterface::syncProcessEventNetLinkMsg(
         _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload)
 {
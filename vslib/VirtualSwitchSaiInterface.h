@@ -309,12 +309,35 @@ namespace saivs
             void setMeta(
                     _In_ std::weak_ptr<saimeta::Meta> meta);
 
+            /**
+             * @brief Write warm boot file.
+             *
+             * By default binary snapshot is written, text format is kept
+             * for compatibility with older versions.
+             */
             bool writeWarmBootFile(
-                    _In_ const char* warmBootFile) const;
+                    _In_ const char* warmBootFile,
+                    _In_ bool textFormat = false) const;
 
+            /**
+             * @brief Read warm boot file, format is detected from file content.
+             */
             bool readWarmBootFile(
                     _In_ const char* warmBootFile);
 
+        private:
+
+            bool readWarmBootSnapshot(
+                    _In_ const char* warmBootFile);
+
+            bool readWarmBootText(
+                    _In_ const char* warmBootFile);
+
+            void logWarmBootState(
+                    _In_ const char* warmBootFile) const;
+
+        public:
+
             void ageFdbs();
 
             void debugSetStats(
@@ -327,11 +350,14 @@ namespace saivs
             void syncProcessEventNetLinkMsg(
                     _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload);
 
+            void syncProcessFdbLearnBatch(
+                    _In_ const std::vector<FdbLearnEvent>& events);
+
         private:
 
             std::weak_ptr<saimeta::Meta> m_meta;
 
-            std::map<sai_object_id_t, std::string> m_warmBootData;
+            std::map<sai_object_id_t, WarmBootState> m_warmBootData;
 
             std::map<sai_object_id_t, WarmBootState> m_warmBootState;
 
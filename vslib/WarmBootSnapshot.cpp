@@ -0,0 +1,401 @@
+#include "WarmBootSnapshot.h"
+#include "SwitchStateBase.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using namespace saivs;
+
+constexpr uint64_t WarmBootSnapshot::MAGIC;
+constexpr uint32_t WarmBootSnapshot::VERSION;
+
+static void appendU32(
+        _Inout_ std::string& buffer,
+        _In_ uint32_t value)
+{
+    SWSS_LOG_ENTER();
+
+    buffer.append((const char*)&value, sizeof(value));
+}
+
+static void appendU64(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    buffer.append((const char*)&value, sizeof(value));
+}
+
+static void appendString(
+        _Inout_ std::string& buffer,
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    appendU32(buffer, (uint32_t)str.size());
+
+    buffer.append(str);
+}
+
+static void readBytes(
+        _Inout_ const char*& ptr,
+        _In_ const char* end,
+        _Out_ void* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    if ((size_t)(end - ptr) < size)
+    {
+        SWSS_LOG_THROW("snapshot is truncated");
+    }
+
+    memcpy(data, ptr, size);
+
+    ptr += size;
+}
+
+static uint32_t readU32(
+        _Inout_ const char*& ptr,
+        _In_ const char* end)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t value;
+
+    readBytes(ptr, end, &value, sizeof(value));
+
+    return value;
+}
+
+static uint64_t readU64(
+        _Inout_ const char*& ptr,
+        _In_ const char* end)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value;
+
+    readBytes(ptr, end, &value, sizeof(value));
+
+    return value;
+}
+
+static std::string readString(
+        _Inout_ const char*& ptr,
+        _In_ const char* end)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t size = readU32(ptr, end);
+
+    if ((size_t)(end - ptr) < size)
+    {
+        SWSS_LOG_THROW("snapshot is truncated");
+    }
+
+    std::string str(ptr, size);
+
+    ptr += size;
+
+    return str;
+}
+
+uint64_t WarmBootSnapshot::checksum(
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    // FNV-1a 64 bit
+
+    auto bytes = (const uint8_t*)data;
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        hash ^= bytes[idx];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+bool WarmBootSnapshot::write(
+        _In_ const std::string& fileName,
+        _In_ const std::map<sai_object_id_t, WarmBootState>& states)
+{
+    SWSS_LOG_ENTER();
+
+    std::string buffer(sizeof(WarmBootSnapshotHeader), '\0');
+
+    for (auto& kvp: states)
+    {
+        auto& state = kvp.second;
+
+        appendU64(buffer, kvp.first);
+        appendU32(buffer, (uint32_t)state.m_objectHash.size());
+
+        for (auto& ot: state.m_objectHash)
+        {
+            appendU32(buffer, (uint32_t)ot.first);
+            appendU32(buffer, (uint32_t)ot.second.size());
+
+            for (auto& o: ot.second)
+            {
+                appendString(buffer, o.first);
+                appendU32(buffer, (uint32_t)o.second.size());
+
+                for (auto& a: o.second)
+                {
+                    appendString(buffer, a.first);
+                    appendString(buffer, a.second->getAttrStrValue());
+                }
+            }
+        }
+
+        appendU32(buffer, (uint32_t)state.m_fdbInfoSet.size());
+
+        for (auto& fi: state.m_fdbInfoSet)
+        {
+            appendString(buffer, fi.serialize());
+        }
+    }
+
+    WarmBootSnapshotHeader header;
+
+    memset(&header, 0, sizeof(header));
+
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.switchCount = (uint32_t)states.size();
+    header.payloadSize = buffer.size() - sizeof(header);
+    header.checksum = checksum(buffer.data() + sizeof(header), header.payloadSize);
+
+    memcpy(&buffer[0], &header, sizeof(header));
+
+    std::ofstream ofs(fileName, std::ofstream::binary | std::ofstream::trunc);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open: %s", fileName.c_str());
+        return false;
+    }
+
+    ofs.write(buffer.data(), (std::streamsize)buffer.size());
+
+    ofs.close();
+
+    if (ofs.fail())
+    {
+        SWSS_LOG_ERROR("failed to write snapshot %s", fileName.c_str());
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("written warm boot snapshot %s, switches: %zu, size: %zu",
+            fileName.c_str(),
+            states.size(),
+            buffer.size());
+
+    return true;
+}
+
+bool WarmBootSnapshot::isSnapshot(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(fileName, std::ifstream::binary);
+
+    uint64_t magic = 0;
+
+    ifs.read((char*)&magic, sizeof(magic));
+
+    return ifs.good() && magic == MAGIC;
+}
+
+bool WarmBootSnapshot::read(
+        _In_ const std::string& fileName,
+        _Out_ std::map<sai_object_id_t, WarmBootState>& states)
+{
+    SWSS_LOG_ENTER();
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open: %s", fileName.c_str());
+        return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(WarmBootSnapshotHeader))
+    {
+        SWSS_LOG_ERROR("snapshot %s is too small", fileName.c_str());
+
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("failed to mmap %s: %s", fileName.c_str(), strerror(errno));
+        return false;
+    }
+
+    const char* ptr = (const char*)addr;
+    const char* end = ptr + size;
+
+    WarmBootSnapshotHeader header;
+
+    readBytes(ptr, end, &header, sizeof(header));
+
+    if (header.magic != MAGIC ||
+            header.version != VERSION ||
+            header.payloadSize != size - sizeof(header))
+    {
+        SWSS_LOG_ERROR("snapshot %s has invalid header, version %u, payload size %" PRIu64 ", file size %zu",
+                fileName.c_str(),
+                header.version,
+                header.payloadSize,
+                size);
+
+        munmap(addr, size);
+        return false;
+    }
+
+    if (checksum(ptr, header.payloadSize) != header.checksum)
+    {
+        SWSS_LOG_ERROR("snapshot %s checksum mismatch", fileName.c_str());
+
+        munmap(addr, size);
+        return false;
+    }
+
+    std::map<sai_object_id_t, WarmBootState> result;
+
+    try
+    {
+        for (uint32_t s = 0; s < header.switchCount; s++)
+        {
+            sai_object_id_t switchId = readU64(ptr, end);
+
+            auto& state = result[switchId];
+
+            state.m_switchId = switchId;
+
+            uint32_t objectTypeCount = readU32(ptr, end);
+
+            for (uint32_t t = 0; t < objectTypeCount; t++)
+            {
+                auto objectType = (sai_object_type_t)readU32(ptr, end);
+
+                auto& objectHash = state.m_objectHash[objectType];
+
+                uint32_t objectCount = readU32(ptr, end);
+
+                for (uint32_t o = 0; o < objectCount; o++)
+                {
+                    auto& attrHash = objectHash[readString(ptr, end)];
+
+                    uint32_t attrCount = readU32(ptr, end);
+
+                    for (uint32_t a = 0; a < attrCount; a++)
+                    {
+                        auto attrId = readString(ptr, end);
+                        auto attrValue = readString(ptr, end);
+
+                        attrHash[attrId] = std::make_shared<SaiAttrWrap>(attrId, attrValue);
+                    }
+                }
+            }
+
+            uint32_t fdbInfoCount = readU32(ptr, end);
+
+            for (uint32_t f = 0; f < fdbInfoCount; f++)
+            {
+                state.m_fdbInfoSet.insert(FdbInfo::deserialize(readString(ptr, end)));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to parse snapshot %s: %s", fileName.c_str(), e.what());
+
+        munmap(addr, size);
+        return false;
+    }
+
+    munmap(addr, size);
+
+    if (ptr != end)
+    {
+        SWSS_LOG_ERROR("snapshot %s has %zu trailing bytes", fileName.c_str(), (size_t)(end - ptr));
+        return false;
+    }
+
+    states.swap(result);
+
+    return true;
+}
+
+std::string WarmBootSnapshot::toText(
+        _In_ const WarmBootState& state)
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    for (auto& kvp: state.m_objectHash)
+    {
+        auto strObjectType = sai_serialize_object_type(kvp.first);
+
+        for (auto& o: kvp.second)
+        {
+            // if object don't have attributes, size can be zero
+            if (o.second.size() == 0)
+            {
+                ss << strObjectType << " " << o.first << " NULL NULL" << std::endl;
+                continue;
+            }
+
+            for (auto& a: o.second)
+            {
+                ss << strObjectType << " ";
+                ss << o.first;
+                ss << " ";
+                ss << a.first;
+                ss << " ";
+                ss << a.second->getAttrStrValue();
+                ss << std::endl;
+            }
+        }
+    }
+
+    for (auto& fi: state.m_fdbInfoSet)
+    {
+        ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
+    }
+
+    return ss.str();
+}
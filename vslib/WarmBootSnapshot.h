@@ -0,0 +1,114 @@
+#pragma once
+
+#include "WarmBootState.h"
+
+#include <map>
+#include <string>
+
+namespace saivs
+{
+    /**
+     * @brief Binary snapshot header.
+     *
+     * File layout:
+     *
+     * WarmBootSnapshotHeader
+     * switchCount times:
+     *   uint64 switchId
+     *   uint32 objectTypeCount
+     *   objectTypeCount times:
+     *     int32 objectType
+     *     uint32 objectCount
+     *     objectCount times:
+     *       string objectId
+     *       uint32 attrCount
+     *       attrCount times:
+     *         string attrId
+     *         string attrValue
+     *   uint32 fdbInfoCount
+     *   fdbInfoCount times:
+     *     string fdbInfo
+     *
+     * Strings are stored as uint32 length followed by characters, all
+     * numbers are in host byte order.
+     */
+    typedef struct _WarmBootSnapshotHeader
+    {
+        uint64_t magic;
+
+        uint32_t version;
+
+        uint32_t switchCount;
+
+        /**
+         * @brief Size of data following header.
+         */
+        uint64_t payloadSize;
+
+        /**
+         * @brief FNV-1a checksum of data following header.
+         */
+        uint64_t checksum;
+
+    } WarmBootSnapshotHeader;
+
+    /**
+     * @brief Warm boot snapshot.
+     *
+     * Binary format of switch state saved on warm shutdown. Snapshot is
+     * written with single write and loaded using mmap, which is much
+     * faster than parsing text dump line by line for large switch
+     * state. Text format is still supported for compatibility.
+     */
+    class WarmBootSnapshot
+    {
+        private:
+
+            WarmBootSnapshot() = delete;
+            ~WarmBootSnapshot() = delete;
+
+        public:
+
+            static constexpr uint64_t MAGIC = 0x544E53424D575653; // "SVWMBSNT"
+
+            static constexpr uint32_t VERSION = 1;
+
+        public:
+
+            /**
+             * @brief Write binary snapshot of given switches state.
+             */
+            static bool write(
+                    _In_ const std::string& fileName,
+                    _In_ const std::map<sai_object_id_t, WarmBootState>& states);
+
+            /**
+             * @brief Read binary snapshot.
+             *
+             * Returns false if file can't be opened, has invalid header,
+             * checksum mismatch or is truncated, states are not modified
+             * in that case.
+             */
+            static bool read(
+                    _In_ const std::string& fileName,
+                    _Out_ std::map<sai_object_id_t, WarmBootState>& states);
+
+            /**
+             * @brief Check whether file starts with snapshot magic.
+             */
+            static bool isSnapshot(
+                    _In_ const std::string& fileName);
+
+            /**
+             * @brief Serialize switch state to text warm boot format.
+             *
+             * Each line has format: OBJECT_TYPE OBJECT_ID ATTR_ID ATTR_VALUE.
+             */
+            static std::string toText(
+                    _In_ const WarmBootState& state);
+
+            static uint64_t checksum(
+                    _In_ const void* data,
+                    _In_ size_t size);
+    };
+}
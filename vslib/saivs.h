@@ -92,6 +92,17 @@ extern "C" {
  */
 #define SAI_KEY_VS_CORE_PORT_INDEX_MAP_FILE  "SAI_VS_CORE_PORT_INDEX_MAP_FILE"
 
+/**
+ * @def SAI_KEY_VS_WARM_BOOT_TEXT_FORMAT
+ *
+ * Bool flag, (true/false). If set to true, warm boot write file will be
+ * written in text format instead of binary snapshot. Format of warm boot
+ * read file is detected automatically.
+ *
+ * By default this flag is set to false.
+ */
+#define SAI_KEY_VS_WARM_BOOT_TEXT_FORMAT     "SAI_VS_WARM_BOOT_TEXT_FORMAT"
+
 /**
  * @brief Context config.
  *